@@ -0,0 +1,47 @@
+##--------------------------------------------------------------------------##
+## cmake/BenchmarkCheck.cmake
+## Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+##--------------------------------------------------------------------------##
+
+include_guard()
+
+#[[
+itertools_check_benchmark(<benchmark> <adaptor>=<baseline>...)
+
+Add a target <benchmark>_check that runs the <adaptor> and <baseline>
+families of the benchmark executable and fails when the median time of an
+adaptor benchmark is more than ITERTOOLS_BENCHMARK_TOLERANCE percent above
+that of the baseline benchmark with the same template and numeric arguments,
+e.g., BM_RangeLoop<int>/3 against BM_RawLoop<int>/3, or when the noise
+measured over the repetitions is too large to tell (see
+CompareBenchmarks.cmake).  The check targets are collected by the
+itertools_bench target.
+
+The benchmark is built with the flags of the project, so the check measures
+the code users get, including the effects of code placement: the same
+instructions can run a third slower in a loop that straddles a cache line.
+Such a failure is reported like any other rather than tuned away with flags.
+#]]
+
+function(itertools_check_benchmark _BENCH)
+  string(REPLACE ";" "," _PAIRS "${ARGN}")
+  set(_OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/${_BENCH}.json")
+
+  add_custom_target(
+    ${_BENCH}_check
+    COMMAND
+      ${CMAKE_COMMAND} "-DBENCHMARK=$<TARGET_FILE:${_BENCH}>"
+      "-DOUTPUT=${_OUTPUT}" "-DPAIRS=${_PAIRS}"
+      "-DTOLERANCE=${ITERTOOLS_BENCHMARK_TOLERANCE}" -P
+      "${PROJECT_SOURCE_DIR}/cmake/CompareBenchmarks.cmake"
+    DEPENDS ${_BENCH}
+    COMMENT "Comparing ${_BENCH} adaptors with hand-written loops"
+    VERBATIM
+    )
+  set_property(GLOBAL APPEND PROPERTY ITERTOOLS_BENCHMARK_CHECKS
+    ${_BENCH}_check)
+endfunction()
+
+##--------------------------------------------------------------------------##
+## end of cmake/BenchmarkCheck.cmake
+##--------------------------------------------------------------------------##
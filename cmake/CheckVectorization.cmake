@@ -0,0 +1,93 @@
+##--------------------------------------------------------------------------##
+## cmake/CheckVectorization.cmake
+## Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+##--------------------------------------------------------------------------##
+#
+# Script mode: cmake -DCOMPILER=<c++> -DREPORT_FLAG=<flag> -DOBJDUMP=<objdump>
+#                    -DINCLUDE_DIR=<dir> -DSOURCE=<kernels.cc>
+#                    -DOBJECT=<kernels.o> [-DFLAGS=<flags>]
+#                    [-DHEADERS=<header>,...]
+#                    -P CheckVectorization.cmake
+#
+# Compiles the kernels at -O3 without DBC checks, then checks that every loop
+# marked with "// vectorized" in the kernels, or in the headers (relative to
+# INCLUDE_DIR), was vectorized and that the object code does not call
+# throwDBCException.  A loop of a header is vectorized when any of its
+# instantiations in the kernels is.
+
+cmake_minimum_required(VERSION 3.21)
+
+# Compile the kernels and collect the vectorization report
+separate_arguments(_FLAGS UNIX_COMMAND "${FLAGS}")
+execute_process(
+  COMMAND "${COMPILER}" ${_FLAGS} -O3 -std=c++17 -DITERTOOLS_DBC=0
+          "-I${INCLUDE_DIR}" ${REPORT_FLAG} -c "${SOURCE}" -o "${OBJECT}"
+  RESULT_VARIABLE _STATUS
+  OUTPUT_VARIABLE _REPORT
+  ERROR_VARIABLE _REPORT
+  )
+if (NOT _STATUS EQUAL 0)
+  message(FATAL_ERROR "Compiling ${SOURCE} failed:\n${_REPORT}")
+endif ()
+
+# Check the marked loops of the kernel file and of the headers
+set(_FILES "${SOURCE}")
+string(REPLACE "," ";" _HEADERS "${HEADERS}")
+foreach (_HEADER IN LISTS _HEADERS)
+  list(APPEND _FILES "${INCLUDE_DIR}/${_HEADER}")
+endforeach ()
+
+set(_FAILURES 0)
+foreach (_FILE IN LISTS _FILES)
+  # Find the vectorized lines of the file
+  get_filename_component(_NAME "${_FILE}" NAME)
+  string(REGEX REPLACE "[.]" "[.]" _NAME_REGEX "${_NAME}")
+  string(REGEX MATCHALL
+    "${_NAME_REGEX}:[0-9]+:[0-9]+: [a-z]+: (loop vectorized|vectorized loop)"
+    _REMARKS "${_REPORT}")
+  set(_VECTORIZED)
+  foreach (_REMARK IN LISTS _REMARKS)
+    string(REGEX MATCH ":([0-9]+):" _ "${_REMARK}")
+    list(APPEND _VECTORIZED ${CMAKE_MATCH_1})
+  endforeach ()
+
+  file(STRINGS "${_FILE}" _LINES)
+  set(_NUMBER 0)
+  foreach (_LINE IN LISTS _LINES)
+    math(EXPR _NUMBER "${_NUMBER} + 1")
+    if (NOT _LINE MATCHES "// vectorized$")
+      continue()
+    endif ()
+    list(FIND _VECTORIZED ${_NUMBER} _FOUND)
+    if (_FOUND EQUAL -1)
+      string(STRIP "${_LINE}" _LINE)
+      message(SEND_ERROR
+        "${_NAME}:${_NUMBER}: loop not vectorized: ${_LINE}")
+      math(EXPR _FAILURES "${_FAILURES} + 1")
+    endif ()
+  endforeach ()
+endforeach ()
+
+# Check that the DBC checks are compiled out
+execute_process(
+  COMMAND "${OBJDUMP}" -dr "${OBJECT}"
+  RESULT_VARIABLE _STATUS
+  OUTPUT_VARIABLE _ASSEMBLY
+  ERROR_VARIABLE _ASSEMBLY
+  )
+if (NOT _STATUS EQUAL 0)
+  message(FATAL_ERROR "Disassembling ${OBJECT} failed:\n${_ASSEMBLY}")
+endif ()
+if (_ASSEMBLY MATCHES "throwDBCException")
+  get_filename_component(_NAME "${SOURCE}" NAME)
+  message(SEND_ERROR "${_NAME}: object code calls throwDBCException")
+  math(EXPR _FAILURES "${_FAILURES} + 1")
+endif ()
+
+if (_FAILURES GREATER 0)
+  message(FATAL_ERROR "${_FAILURES} vectorization checks failed")
+endif ()
+
+##--------------------------------------------------------------------------##
+## end of cmake/CheckVectorization.cmake
+##--------------------------------------------------------------------------##
@@ -0,0 +1,201 @@
+##--------------------------------------------------------------------------##
+## cmake/CompareBenchmarks.cmake
+## Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+##--------------------------------------------------------------------------##
+#
+# Script mode: cmake -DBENCHMARK=<exe> -DOUTPUT=<json> -DPAIRS=<a=b,...>
+#                    [-DTOLERANCE=<percent>] [-DREPETITIONS=<n>]
+#                    [-DMIN_TIME=<seconds>] [-DNOISE_FACTOR=<n>]
+#                    -P CompareBenchmarks.cmake
+#
+# Runs the adaptor and baseline benchmarks and compares the median CPU time
+# over the repetitions of every adaptor benchmark with that of its
+# hand-written baseline.  The repetitions are interleaved at random, so that
+# a burst of noise from other processes is spread over all benchmarks, and
+# the median ignores the repetitions it slows down (or, on a busy machine,
+# the few it does not).  Each repetition runs for MIN_TIME seconds, so that
+# many short repetitions fit in the time of a few default ones.
+#
+# Fails when an adaptor is slower by more than TOLERANCE percent.  The
+# comparison is inconclusive, and fails as well, when NOISE_FACTOR times the
+# standard errors of the two medians exceeds TOLERANCE percent: the machine
+# is then too busy to tell a slower adaptor from noise.  The standard errors
+# are estimated from the median absolute deviations of the repetitions.
+
+cmake_minimum_required(VERSION 3.21)
+
+if (NOT DEFINED TOLERANCE)
+  set(TOLERANCE 5)
+endif ()
+if (NOT DEFINED REPETITIONS)
+  set(REPETITIONS 15)
+endif ()
+if (NOT DEFINED MIN_TIME)
+  set(MIN_TIME 0.1)
+endif ()
+if (NOT DEFINED NOISE_FACTOR)
+  set(NOISE_FACTOR 2)
+endif ()
+
+# Convert a decimal time to an integer number of thousandths
+function(_to_milli _VALUE _RESULT)
+  if (NOT _VALUE MATCHES "^([0-9]+)(\\.([0-9]*))?$")
+    message(FATAL_ERROR "Unexpected benchmark time: ${_VALUE}")
+  endif ()
+  set(_INTEGER "${CMAKE_MATCH_1}")
+  set(_FRACTION "${CMAKE_MATCH_3}000")
+  string(SUBSTRING "${_FRACTION}" 0 3 _FRACTION)
+  string(REGEX REPLACE "^0+([0-9])" "\\1" _FRACTION "${_FRACTION}")
+  math(EXPR _MILLI "${_INTEGER} * 1000 + ${_FRACTION}")
+  set(${_RESULT} ${_MILLI} PARENT_SCOPE)
+endfunction()
+
+# Compute the median of a list of integers
+function(_median _LIST _RESULT)
+  list(SORT _LIST COMPARE NATURAL)
+  list(LENGTH _LIST _LENGTH)
+  math(EXPR _MIDDLE "${_LENGTH} / 2")
+  math(EXPR _ODD "${_LENGTH} % 2")
+  list(GET _LIST ${_MIDDLE} _MEDIAN)
+  if (_ODD EQUAL 0)
+    math(EXPR _BELOW "${_MIDDLE} - 1")
+    list(GET _LIST ${_BELOW} _BELOW)
+    math(EXPR _MEDIAN "(${_MEDIAN} + ${_BELOW}) / 2")
+  endif ()
+  set(${_RESULT} ${_MEDIAN} PARENT_SCOPE)
+endfunction()
+
+# Run only the compared benchmark families
+string(REPLACE "," ";" _PAIRS "${PAIRS}")
+set(_FAMILIES)
+foreach (_PAIR IN LISTS _PAIRS)
+  string(REPLACE "=" "|" _PAIR "${_PAIR}")
+  list(APPEND _FAMILIES "${_PAIR}")
+endforeach ()
+list(JOIN _FAMILIES "|" _FAMILIES)
+
+execute_process(
+  COMMAND "${BENCHMARK}" "--benchmark_filter=^(${_FAMILIES})([</]|$)"
+          --benchmark_repetitions=${REPETITIONS}
+          --benchmark_min_time=${MIN_TIME}
+          --benchmark_enable_random_interleaving=true
+          --benchmark_display_aggregates_only=true
+          --benchmark_out=${OUTPUT} --benchmark_out_format=json
+  RESULT_VARIABLE _STATUS
+  )
+if (NOT _STATUS EQUAL 0)
+  message(FATAL_ERROR "${BENCHMARK} failed: ${_STATUS}")
+endif ()
+
+# Collect the times of each benchmark, in _TIMES_<index of the name>
+file(READ "${OUTPUT}" _JSON)
+string(JSON _COUNT LENGTH "${_JSON}" benchmarks)
+set(_NAMES)
+if (_COUNT GREATER 0)
+  math(EXPR _LAST "${_COUNT} - 1")
+  foreach (_I RANGE ${_LAST})
+    string(JSON _TYPE GET "${_JSON}" benchmarks ${_I} run_type)
+    if (NOT _TYPE STREQUAL "iteration")
+      continue()
+    endif ()
+    string(JSON _NAME GET "${_JSON}" benchmarks ${_I} run_name)
+    string(JSON _TIME GET "${_JSON}" benchmarks ${_I} cpu_time)
+    _to_milli("${_TIME}" _TIME)
+
+    list(FIND _NAMES "${_NAME}" _FOUND)
+    if (_FOUND EQUAL -1)
+      list(LENGTH _NAMES _FOUND)
+      list(APPEND _NAMES "${_NAME}")
+    endif ()
+    list(APPEND _TIMES_${_FOUND} "${_TIME}")
+  endforeach ()
+endif ()
+
+# Reduce the times of each benchmark to their median and its standard error,
+# 1.858 MAD / sqrt(n) for normally distributed times
+set(_MEDIANS)
+set(_ERRORS)
+set(_INDEX 0)
+foreach (_NAME IN LISTS _NAMES)
+  _median("${_TIMES_${_INDEX}}" _MEDIAN)
+  set(_DEVIATIONS)
+  foreach (_TIME IN LISTS _TIMES_${_INDEX})
+    math(EXPR _DEVIATION "${_TIME} - ${_MEDIAN}")
+    string(REGEX REPLACE "^-" "" _DEVIATION "${_DEVIATION}")
+    list(APPEND _DEVIATIONS "${_DEVIATION}")
+  endforeach ()
+  _median("${_DEVIATIONS}" _DEVIATION)
+
+  # Ten times the square root of the number of repetitions, rounded down
+  list(LENGTH _TIMES_${_INDEX} _LENGTH)
+  math(EXPR _SQUARE "100 * ${_LENGTH}")
+  set(_ROOT 10)
+  math(EXPR _NEXT "(${_ROOT} + 1) * (${_ROOT} + 1)")
+  while (NOT _NEXT GREATER _SQUARE)
+    math(EXPR _ROOT "${_ROOT} + 1")
+    math(EXPR _NEXT "(${_ROOT} + 1) * (${_ROOT} + 1)")
+  endwhile ()
+
+  math(EXPR _ERROR "${_DEVIATION} * 186 / (10 * ${_ROOT})")
+  list(APPEND _MEDIANS "${_MEDIAN}")
+  list(APPEND _ERRORS "${_ERROR}")
+  math(EXPR _INDEX "${_INDEX} + 1")
+endforeach ()
+
+# Compare each adaptor with its baseline
+set(_FAILURES 0)
+set(_INDEX 0)
+foreach (_NAME IN LISTS _NAMES)
+  list(GET _MEDIANS ${_INDEX} _TIME)
+  list(GET _ERRORS ${_INDEX} _ERROR)
+  math(EXPR _INDEX "${_INDEX} + 1")
+
+  foreach (_PAIR IN LISTS _PAIRS)
+    string(REPLACE "=" ";" _PAIR "${_PAIR}")
+    list(GET _PAIR 0 _ADAPTOR)
+    list(GET _PAIR 1 _BASELINE)
+
+    # The name is the adaptor's, followed by template or numeric arguments
+    string(FIND "${_NAME}" "${_ADAPTOR}" _POSITION)
+    if (NOT _POSITION EQUAL 0)
+      continue()
+    endif ()
+    string(LENGTH "${_ADAPTOR}" _LENGTH)
+    string(SUBSTRING "${_NAME}" ${_LENGTH} -1 _SUFFIX)
+    if (NOT _SUFFIX MATCHES "^($|[</])")
+      continue()
+    endif ()
+
+    list(FIND _NAMES "${_BASELINE}${_SUFFIX}" _FOUND)
+    if (_FOUND EQUAL -1)
+      message(FATAL_ERROR "No baseline ${_BASELINE}${_SUFFIX} for ${_NAME}")
+    endif ()
+    list(GET _MEDIANS ${_FOUND} _BASE_TIME)
+    list(GET _ERRORS ${_FOUND} _BASE_ERROR)
+
+    math(EXPR _ALLOWED "${_BASE_TIME} * ${TOLERANCE} / 100")
+    math(EXPR _NOISE "${NOISE_FACTOR} * (${_ERROR} + ${_BASE_ERROR})")
+    math(EXPR _LIMIT "${_BASE_TIME} + ${_ALLOWED}")
+    if (_NOISE GREATER _ALLOWED)
+      math(EXPR _PERCENT "${_NOISE} * 100 / ${_BASE_TIME}")
+      message(SEND_ERROR "${_NAME} against ${_BASELINE}${_SUFFIX} is "
+        "inconclusive: the noise (${_PERCENT}%) exceeds the tolerance")
+      math(EXPR _FAILURES "${_FAILURES} + 1")
+    elseif (_TIME GREATER _LIMIT)
+      math(EXPR _PERCENT "(${_TIME} - ${_BASE_TIME}) * 100 / ${_BASE_TIME}")
+      message(SEND_ERROR "${_NAME} is ${_PERCENT}% slower than "
+        "${_BASELINE}${_SUFFIX}")
+      math(EXPR _FAILURES "${_FAILURES} + 1")
+    endif ()
+  endforeach ()
+endforeach ()
+
+if (_FAILURES GREATER 0)
+  message(FATAL_ERROR
+    "${_FAILURES} adaptors are more than ${TOLERANCE}% slower than the "
+    "hand-written loops, or too noisy to compare")
+endif ()
+
+##--------------------------------------------------------------------------##
+## end of cmake/CompareBenchmarks.cmake
+##--------------------------------------------------------------------------##
@@ -0,0 +1,64 @@
+##--------------------------------------------------------------------------##
+## cmake/VectorizationCheck.cmake
+## Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+##--------------------------------------------------------------------------##
+
+include_guard()
+
+#[[
+itertools_check_vectorization(<kernels> [HEADERS <header>...])
+
+Add a test <kernels> that compiles <kernels>.cc at -O3 with the DBC checks
+disabled and fails when
+
+  - a loop marked with a trailing "// vectorized" comment is not reported as
+    vectorized by the compiler (-fopt-info-vec-optimized for GCC,
+    -Rpass=loop-vectorize for Clang), or
+  - the object code still references throwDBCException.
+
+The marked loops of the HEADERS, given relative to the src directory (e.g.,
+zip/Transpose.hh), are checked as well; the kernels must instantiate them.
+
+The kernels are compiled with the target flags of CMAKE_CXX_FLAGS (e.g.,
+-march=native), without its instrumentation flags: sanitizers, profiling and
+coverage add checks and counters to the loops that keep them from being
+vectorized, although the uninstrumented build vectorizes them.
+
+The test is skipped for other compilers, whose vectorization reports are not
+parsed.
+#]]
+function(itertools_check_vectorization _KERNELS)
+  cmake_parse_arguments(PARSE_ARGV 1 _ARG "" "" "HEADERS")
+  string(REPLACE ";" "," _HEADERS "${_ARG_HEADERS}")
+
+  if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+    set(_REPORT_FLAG "-fopt-info-vec-optimized")
+  elseif (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    set(_REPORT_FLAG "-Rpass=loop-vectorize")
+  else ()
+    message(STATUS "Vectorization check ${_KERNELS} disabled for "
+      "${CMAKE_CXX_COMPILER_ID}")
+    return()
+  endif ()
+
+  separate_arguments(_FLAGS UNIX_COMMAND "${CMAKE_CXX_FLAGS}")
+  list(FILTER _FLAGS EXCLUDE REGEX
+    "^(-f(no-)?sanitize|-fprofile|-fcoverage|-ftest-coverage$|--coverage$)")
+  list(JOIN _FLAGS " " _FLAGS)
+
+  add_test(
+    NAME ${_KERNELS}
+    COMMAND
+      ${CMAKE_COMMAND} "-DCOMPILER=${CMAKE_CXX_COMPILER}"
+      "-DFLAGS=${_FLAGS}" "-DREPORT_FLAG=${_REPORT_FLAG}"
+      "-DOBJDUMP=${CMAKE_OBJDUMP}"
+      "-DINCLUDE_DIR=${PROJECT_SOURCE_DIR}/src" "-DHEADERS=${_HEADERS}"
+      "-DSOURCE=${CMAKE_CURRENT_SOURCE_DIR}/${_KERNELS}.cc"
+      "-DOBJECT=${CMAKE_CURRENT_BINARY_DIR}/${_KERNELS}.o" -P
+      "${PROJECT_SOURCE_DIR}/cmake/CheckVectorization.cmake"
+    )
+endfunction()
+
+##--------------------------------------------------------------------------##
+## end of cmake/VectorizationCheck.cmake
+##--------------------------------------------------------------------------##
@@ -10,6 +10,8 @@
 
 #include <string>
 
+#include "Macros.hh"
+
 #ifndef ITERTOOLS_DBC
 #define ITERTOOLS_DBC true
 #endif
@@ -53,6 +53,47 @@ namespace itertools
 #define ITER_LIKELY(COND) COND
 #endif
 
+//---------------------------------------------------------------------------//
+/*!
+ * \def ITERTOOLS_ASSUME
+ * \brief Tells the optimizer that a boolean condition always holds.
+ *
+ * The condition is not evaluated at run time; the behavior is undefined if it
+ * is false.  This lets the compiler derive facts it cannot prove, such as the
+ * range of a value, e.g., to vectorize a loop over it.
+ */
+#if defined __GNUC__ || __clang__
+#define ITERTOOLS_ASSUME(COND)       \
+    do                               \
+    {                                \
+        if (!(COND))                 \
+        {                            \
+            __builtin_unreachable(); \
+        }                            \
+    } while (false)
+#else
+// Not supported on other compilers
+#define ITERTOOLS_ASSUME(COND) ((void)0)
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * \def ITERTOOLS_PREFETCH
+ * \brief Hints that the memory at an address will soon be read or written.
+ *
+ * \c RW is 0 for a read and 1 for a write, and \c LOCALITY ranges from 0
+ * (no temporal locality, evict soon) to 3 (keep in all cache levels).  Both
+ * must be constant expressions.  Prefetching never faults, so the address may
+ * lie past the end of an array.
+ */
+#if defined __GNUC__ || __clang__
+#define ITERTOOLS_PREFETCH(ADDR, RW, LOCALITY) \
+    __builtin_prefetch((ADDR), (RW), (LOCALITY))
+#else
+// Not supported on other compilers
+#define ITERTOOLS_PREFETCH(ADDR, RW, LOCALITY) ((void)(ADDR))
+#endif
+
 //---------------------------------------------------------------------------//
 }  // namespace itertools
 
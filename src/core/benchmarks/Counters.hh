@@ -0,0 +1,63 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/core/benchmarks/Counters.hh
+ * \brief  Throughput counters shared by the benchmarks.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_CORE_BENCHMARKS_COUNTERS_HH
+#define ITERTOOLS_SRC_CORE_BENCHMARKS_COUNTERS_HH
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+namespace itertools
+{
+namespace bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Report the throughput of a benchmark processing \p elements
+ *        elements per iteration
+ *
+ * Besides the items and bytes per second, the benchmark reports the time per
+ * element (\c time/elem) and the bytes moved per CPU cycle (\c bytes/cycle),
+ * which are comparable across machines and problem sizes.  The latter is a
+ * rate counter scaled by the clock frequency, so the console reporter shows
+ * it with a "/s" suffix.
+ *
+ * \param[in,out] state              The benchmark state
+ * \param[in]     elements           The number of elements per iteration
+ * \param[in]     bytes_per_element  The bytes loaded and stored per element
+ */
+inline void setThroughputCounters(benchmark::State& state,
+                                  std::int64_t elements,
+                                  std::int64_t bytes_per_element)
+{
+    using Counter = benchmark::Counter;
+
+    const std::int64_t bytes = elements * bytes_per_element;
+    state.SetItemsProcessed(state.iterations() * elements);
+    state.SetBytesProcessed(state.iterations() * bytes);
+
+    state.counters["time/elem"]
+        = Counter(static_cast<double>(elements),
+                  Counter::kIsIterationInvariantRate | Counter::kInvert);
+
+    const double cycles_per_second
+        = benchmark::CPUInfo::Get().cycles_per_second;
+    state.counters["bytes/cycle"]
+        = Counter(static_cast<double>(bytes) / cycles_per_second,
+                  Counter::kIsIterationInvariantRate);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace bench
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_CORE_BENCHMARKS_COUNTERS_HH
+//---------------------------------------------------------------------------//
+// end of src/core/benchmarks/Counters.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,304 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/enumerate/Enumerate.hh
+ * \brief  EnumerateRange class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ENUMERATE_ENUMERATE_HH
+#define ITERTOOLS_SRC_ENUMERATE_ENUMERATE_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "core/DBC.hh"
+#include "detail/EnumerateIterator.hh"
+#include "range/detail/RangePartitions.hh"
+#include "zip/detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class EnumerateRange
+ * \brief An iterable view of a sequence together with a running count
+ *
+ * Enumerate ranges are created by enumerate().  Each element is visited with
+ * its count, which starts at zero unless another starting value is given:
+ * \code
+ * for (auto [i, xi] : enumerate(x)) { xi += i * dx; }
+ * \endcode
+ * For contiguous sequences the count and the element share a single index,
+ * so the loop above compiles to the same vectorized code as
+ * <tt>for (std::size_t i = 0; i < x.size(); ++i)</tt>.
+ *
+ * When the sequence has random access, the range can be sliced and split
+ * into balanced, contiguous sub-ranges in constant time.  Each sub-range
+ * counts from the global position of its first element, so workers handed
+ * the partitions see the same counts as a serial loop:
+ * \code
+ * auto parts = enumerate(x).split(num_threads);
+ * for (auto [i, xi] : parts[thread_id]) { y[i] = f(xi); }
+ * \endcode
+ * The iterators are random access as well, so the range can also be passed
+ * whole to parallelFor() or to the parallel standard algorithms.
+ *
+ * The sequence is not copied: it must outlive the enumerate range, except
+ * for views such as Range whose iterators do not refer to it.
+ *
+ * \tparam IntegerType  The integral type of the count
+ * \tparam Iterator     The iterator type of the sequence
+ *
+ * \example enumerate/tests/tstEnumerate.cc
+ */
+//===========================================================================//
+
+template<typename IntegerType, typename Iterator>
+class EnumerateRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = EnumerateIterator<IntegerType, Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+    using reference = typename iterator::reference;
+    using size_type = std::size_t;
+    using difference_type = typename iterator::difference_type;
+    using partitions_type = detail::RangePartitions<EnumerateRange>;
+    //@}
+
+  public:
+    // Construct with the beginning and ending iterators and the length
+    inline EnumerateRange(iterator first, iterator last, size_type size);
+
+    //! Return beginning iterator
+    iterator begin() const { return m_begin; }
+
+    //! Return const beginning iterator
+    const_iterator cbegin() const { return m_begin; }
+
+    //! Return ending iterator
+    iterator end() const { return m_end; }
+
+    //! Return const ending iterator
+    const_iterator cend() const { return m_end; }
+
+    //! Return the number of elements
+    size_type size() const { return m_size; }
+
+    //! Return whether the range is empty
+    bool empty() const { return m_size == 0; }
+
+    //! Access the count and the element at index \p i
+    reference operator[](size_type i) const
+    {
+        return m_begin[static_cast<difference_type>(i)];
+    }
+
+    // >>> PARTITIONING
+    // Return the sub-range of length elements starting at index offset
+    inline EnumerateRange slice(size_type offset, size_type length) const;
+
+    // Split into count balanced, contiguous sub-ranges
+    inline partitions_type split(size_type count) const;
+
+    // Split into at most count sub-ranges of at least min_grain elements
+    inline partitions_type split(size_type count, size_type min_grain) const;
+
+  private:
+    // >>> DATA
+    iterator m_begin;
+    iterator m_end;
+    size_type m_size;
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Type of the enumeration of a sequence
+template<typename IntegerType, typename Range>
+using enumerate_range_t = EnumerateRange<IntegerType, range_iterator_t<Range>>;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Enumerate the elements of a sequence
+template<typename Range, typename IntegerType = std::size_t>
+inline detail::enumerate_range_t<IntegerType, Range>
+enumerate(Range&& range, IntegerType start = 0);
+
+//===========================================================================//
+// INLINE IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Construct with the beginning and ending iterators and the length
+ *
+ * \param[in] first  The beginning iterator
+ * \param[in] last   The ending iterator
+ * \param[in] size   The number of elements
+ */
+template<typename IntegerType, typename Iterator>
+EnumerateRange<IntegerType, Iterator>::EnumerateRange(iterator first,
+                                                      iterator last,
+                                                      size_type size)
+    : m_begin(std::move(first)), m_end(std::move(last)), m_size(size)
+{
+    /* * */
+}
+
+//---------------------------------------------------------------------------//
+// PARTITIONING
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the sub-range of \p length elements starting at \p offset
+ *
+ * The counts of the sub-range continue those of this range: its first count
+ * is the count of element \p offset.
+ *
+ * \param[in] offset  The index of the first element of the sub-range
+ * \param[in] length  The number of elements of the sub-range
+ *
+ * \return The sub-range
+ */
+template<typename IntegerType, typename Iterator>
+auto EnumerateRange<IntegerType, Iterator>::slice(size_type offset,
+                                                  size_type length) const
+    -> EnumerateRange
+{
+    static_assert(
+        std::is_base_of_v<std::random_access_iterator_tag,
+                          typename iterator::iterator_category>,
+        "slicing requires random access");
+    IT_REQUIRE(offset <= m_size);
+    IT_REQUIRE(length <= m_size - offset);
+
+    const iterator first = m_begin + static_cast<difference_type>(offset);
+    return EnumerateRange(
+        first, first + static_cast<difference_type>(length), length);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the range into \p count balanced, contiguous sub-ranges
+ *
+ * Exactly \p count partitions are produced; their sizes differ by at most
+ * one, with the longer partitions first.  Each partition is computed from
+ * its index in constant time, and counts from its global offset.
+ *
+ * \param[in] count  The number of partitions (nonzero)
+ *
+ * \return A view of the partitions
+ */
+template<typename IntegerType, typename Iterator>
+auto EnumerateRange<IntegerType, Iterator>::split(size_type count) const
+    -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+
+    return partitions_type(*this, count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the range into at most \p count balanced sub-ranges holding
+ *        at least \p min_grain elements each
+ *
+ * \param[in] count      The maximum number of partitions (nonzero)
+ * \param[in] min_grain  The minimum number of elements in each partition
+ *
+ * \return A view of the partitions
+ */
+template<typename IntegerType, typename Iterator>
+auto EnumerateRange<IntegerType, Iterator>::split(size_type count,
+                                                  size_type min_grain) const
+    -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+    IT_REQUIRE(min_grain > 0);
+
+    const size_type max_count = std::max<size_type>(m_size / min_grain, 1);
+    return partitions_type(*this, std::min(count, max_count));
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Enumerate the elements of a sequence
+ *
+ * The ending iterator of the sequence must have the type of its beginning
+ * iterator, and the sequence must be sized or multi-pass.  The length is
+ * computed once, in constant time for sized or random access sequences.
+ *
+ * \param[in] range  The sequence
+ * \param[in] start  The count of the first element
+ *
+ * \return A range over the counts and the elements of the sequence
+ */
+template<typename Range, typename IntegerType>
+detail::enumerate_range_t<IntegerType, Range>
+enumerate(Range&& range, IntegerType start)
+{
+    static_assert(std::is_same_v<detail::range_iterator_t<Range>,
+                                 detail::range_sentinel_t<Range>>,
+                  "the sequence must end with an iterator");
+    static_assert(detail::is_sized_range_v<Range>
+                      || std::is_base_of_v<std::forward_iterator_tag,
+                                           typename std::iterator_traits<
+                                               detail::range_iterator_t<
+                                                   Range>>::iterator_category>,
+                  "the length of the sequence must be computable");
+
+    using std::begin;
+    using std::end;
+    using Result_t = detail::enumerate_range_t<IntegerType, Range>;
+    using Iterator_t = typename Result_t::iterator;
+
+    const auto first = begin(range);
+    const auto last = end(range);
+
+    std::size_t length;
+    if constexpr (detail::is_sized_range_v<Range>)
+    {
+        using std::size;
+        length = static_cast<std::size_t>(size(range));
+    }
+    else
+    {
+        length = static_cast<std::size_t>(std::distance(first, last));
+    }
+
+    const Iterator_t result_first(start, first);
+    if constexpr (Iterator_t::is_indexed)
+    {
+        // Keep the ending iterator on the index of the beginning one
+        return Result_t(
+            result_first,
+            result_first
+                + static_cast<typename Iterator_t::difference_type>(length),
+            length);
+    }
+    else
+    {
+        return Result_t(
+            result_first,
+            Iterator_t(static_cast<IntegerType>(start + length), last),
+            length);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ENUMERATE_ENUMERATE_HH
+//---------------------------------------------------------------------------//
+// end of src/enumerate/Enumerate.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,120 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/enumerate/benchmarks/bchEnumerate.cc
+ * \brief  Benchmarks for enumerate.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Enumerate.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+// Bytes loaded and stored per element by the kernel y = a x[i] + y
+constexpr std::int64_t bytes_per_element = 3 * sizeof(float);
+
+// Small enough that the arrays stay in the first-level cache
+constexpr std::size_t num_elements = 4096;
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Hand-written indexed loop
+void BM_RawLoop(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f), y(num_elements, 2.0f);
+    const float* xp = x.data();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < y.size(); ++i)
+        {
+            y[i] = 2.0f * xp[i] + y[i];
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_RawLoop);
+
+//---------------------------------------------------------------------------//
+// Loop over the enumeration of a vector, which shares a single index.
+//
+// With DBC off this compiles to the same instructions as BM_RawLoop (up to
+// the operand order of one comparison), yet the bchEnumerate check reports it
+// a third to a half slower with GCC 12 on x86-64: its inner loop straddles a
+// 64-byte line in the executable, while that of BM_RawLoop does not.  The
+// gap is code placement, which the check does not tune away, not overhead
+// of enumerate.
+void BM_EnumerateLoop(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f), y(num_elements, 2.0f);
+    const float* xp = x.data();
+    for (auto _ : state)
+    {
+        for (auto [i, yi] : itertools::enumerate(y))
+        {
+            yi = 2.0f * xp[i] + yi;
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_EnumerateLoop);
+
+//---------------------------------------------------------------------------//
+// Counter and iterator incremented separately, as for non-contiguous inputs
+void BM_SeparateCounterLoop(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f), y(num_elements, 2.0f);
+    const float* xp = x.data();
+    for (auto _ : state)
+    {
+        std::size_t i = 0;
+        for (auto iter = y.begin(); iter != y.end(); ++iter, ++i)
+        {
+            *iter = 2.0f * xp[i] + *iter;
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_SeparateCounterLoop);
+
+//---------------------------------------------------------------------------//
+// Loop over the enumeration of a list, which advances a counter and an
+// iterator
+void BM_EnumerateListLoop(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f);
+    std::list<float> y(num_elements, 2.0f);
+    const float* xp = x.data();
+    for (auto _ : state)
+    {
+        for (auto [i, yi] : itertools::enumerate(y))
+        {
+            yi = 2.0f * xp[i] + yi;
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_EnumerateListLoop);
+
+//---------------------------------------------------------------------------//
+// end of src/enumerate/benchmarks/bchEnumerate.cc
+//---------------------------------------------------------------------------//
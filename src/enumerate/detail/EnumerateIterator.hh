@@ -10,15 +10,76 @@
 
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "zip/detail/ZipIteratorTraits.hh"
 
 namespace itertools
 {
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \struct EnumerateStorage
+ * \brief Storage of the iterator and count of an enumeration
+ *
+ * When \c Indexed is true, the iterator stays at the first element and the
+ * offset \c index from it is the only member updated when the enumeration
+ * advances; the count is <tt>start + index</tt> and the element is
+ * <tt>iter[index]</tt>.  Otherwise, the iterator and the count are advanced
+ * together.
+ */
+//===========================================================================//
+
+template<bool Indexed, typename Integer, typename Difference, typename Iterator>
+struct EnumerateStorage
+{
+    //! Stores the iterator at the current position
+    Iterator iter;
+
+    //! Stores the count of the current position
+    Integer count;
+};
+
+template<typename Integer, typename Difference, typename Iterator>
+struct EnumerateStorage<true, Integer, Difference, Iterator>
+{
+    //! Stores the iterator at the initial position
+    Iterator iter;
+
+    //! Stores the count of the initial position
+    Integer start;
+
+    //! Stores the offset of the current position
+    Difference index;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
 //===========================================================================//
 /*!
  * \class EnumerateIterator
- * \brief <++>
+ * \brief Iterates over a sequence together with a running count
+ *
+ * Dereferencing returns a tuple of the count and of a reference to the
+ * element, so both are available through structured bindings:
+ * \code
+ * for (auto [i, xi] : enumerate(x)) { xi *= weights[i]; }
+ * \endcode
+ *
+ * When the underlying iterator is contiguous, the enumeration keeps a single
+ * index (see \c is_indexed): the count is the starting count plus the index
+ * and the element is read at the iterator plus the index, so a loop over the
+ * enumeration is the same indexed loop as a hand-written one and vectorizes
+ * like it.  Otherwise, the iterator and the count are incremented together.
+ *
+ * The iterator category is the category of the underlying iterator; two
+ * enumerate iterators are compared through their underlying iterators.
  *
- * Long description or discussion goes here.
+ * \tparam IntegerType   The integral type of the count
+ * \tparam IteratorType  The underlying iterator type
  *
  * \example enumerate/tests/tstEnumerateIterator.cc
  */
@@ -29,97 +90,641 @@ class EnumerateIterator
 {
   public:
     //! Public type aliases
-    using IntegerType_t = std::remove_reference_t<IntegerType>;
-    using IteratorType_t = std::remove_reference_t<IteratorType>;
-    using value_type
-        = std::tuple<IntegerType_t,
-                     std::iterator_traits<IteratorType_t>::value_type>;
+    using IntegerType_t = std::remove_cv_t<std::remove_reference_t<IntegerType>>;
+    using IteratorType_t
+        = std::remove_cv_t<std::remove_reference_t<IteratorType>>;
+    using value_type = std::tuple<
+        IntegerType_t,
+        typename std::iterator_traits<IteratorType_t>::value_type>;
     using reference
         = std::tuple<IntegerType_t,
-                     std::iterator_traits<IteratorType_t>::reference>;
-    using pointer = std::tuple<IntegerType_T,
-                               std::iterator_traits<IteratorType_t>::pointer>;
-    using difference_type
-        = std::iterator_traits<IteratorType_t>::difference_type;
-    using iterator_category
-        = std::iterator_traits<IteratorType_t>::iterator_category;
+                     typename std::iterator_traits<IteratorType_t>::reference>;
+    using pointer = void;
+    using difference_type =
+        typename std::iterator_traits<IteratorType_t>::difference_type;
+    using iterator_category =
+        typename std::iterator_traits<IteratorType_t>::iterator_category;
     using This = EnumerateIterator<IntegerType, IteratorType>;
 
+    static_assert(std::is_integral_v<IntegerType_t>);
+
+    //! Whether the count and the element share a single index
+    static constexpr bool is_indexed
+        = detail::is_contiguous_iterator_v<IteratorType_t>;
+
+  private:
+    // Storage of the underlying iterator and of the count
+    using Data_t = detail::EnumerateStorage<is_indexed,
+                                            IntegerType_t,
+                                            difference_type,
+                                            IteratorType_t>;
+
   public:
     // Default constructor
     EnumerateIterator() = default;
 
     // Constructor
-    inline EnumerateIterator(IntegerType count, IteratorType iter);
+    inline EnumerateIterator(IntegerType_t count, IteratorType_t iter);
 
     // Copy constructible from convertible parameters
-    template<typename OtherIntegerType, typename OtherIteratorType>
+    template<typename OtherIntegerType,
+             typename OtherIteratorType,
+             std::enable_if_t<
+                 std::is_convertible_v<
+                     OtherIteratorType,
+                     std::remove_cv_t<std::remove_reference_t<IteratorType>>>,
+                 bool>
+             = true>
     inline EnumerateIterator(
-        const EnumerateIterator<OtherIntegerType, OtherIteratorType>& other_iter);
-
-    // Copy assignment
-    template<typename OtherIntegerType, typename OtherIteratorType>
-    inline This&
-    operator=(const EnumerateIterator<OtherIntegerType, OtherIteratorType>&
-                  other_iter);
+        const EnumerateIterator<OtherIntegerType, OtherIteratorType>&
+            other_iter);
 
     // >>> INCREMENT
     // Pre-increment operator
-    This& operator++();
+    inline This& operator++();
 
     // Post-increment operator
-    This operator++(int);
+    inline This operator++(int);
 
     // >>> DECREMENT
     // Pre-decrement operator
-    This& operator--();
+    inline This& operator--();
 
     // Post-decrement operator
-    This operator--();
+    inline This operator--(int);
 
-    // >>> DEREFERENCE AND POINTER
+    // >>> DEREFERENCE, INDEX
     // Dereference
-    reference operator*();
+    inline reference operator*() const;
+
+    // Index operation
+    inline reference operator[](difference_type n) const;
+
+    // >>> COMPOUND ARITHMETIC
+    // Compound addition-assignment operator
+    inline This& operator+=(difference_type n);
 
-    // Pointer
-    pointer operator->();
+    // Compound subtraction-assignment operator
+    inline This& operator-=(difference_type n);
+
+    // >>> ACCESSORS
+    // Get the underlying iterator at the current position
+    inline IteratorType_t base() const;
+
+    // Get the count of the current position
+    inline IntegerType_t count() const;
 
   private:
     // >>> DATA
+    //! Stores the underlying iterator and the count
+    Data_t m_data;
 };
 
 //---------------------------------------------------------------------------//
-// HELPER FUNCTIONS
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+// Sum an iterator and an integral value
+template<typename IntegerType, typename IteratorType>
+inline EnumerateIterator<IntegerType, IteratorType>
+operator+(const EnumerateIterator<IntegerType, IteratorType>& iter,
+          typename EnumerateIterator<IntegerType, IteratorType>::difference_type
+              n);
+
+// Sum an integral value and an iterator
+template<typename IntegerType, typename IteratorType>
+inline EnumerateIterator<IntegerType, IteratorType>
+operator+(typename EnumerateIterator<IntegerType, IteratorType>::difference_type
+              n,
+          const EnumerateIterator<IntegerType, IteratorType>& iter);
+
+// Subtract an integral value from an iterator
+template<typename IntegerType, typename IteratorType>
+inline EnumerateIterator<IntegerType, IteratorType>
+operator-(const EnumerateIterator<IntegerType, IteratorType>& iter,
+          typename EnumerateIterator<IntegerType, IteratorType>::difference_type
+              n);
+
+// Subtract two enumerate iterators
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+inline auto
+operator-(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+          const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+    -> decltype(iter1.base() - iter2.base());
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+// Test equality between two enumerate iterators
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+inline bool
+operator==(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+           const EnumerateIterator<IntegerType2, IteratorType2>& iter2);
+
+// Test inequality between two enumerate iterators
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+inline bool
+operator!=(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+           const EnumerateIterator<IntegerType2, IteratorType2>& iter2);
+
+// Test if iter1 is less than iter2
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+inline bool
+operator<(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+          const EnumerateIterator<IntegerType2, IteratorType2>& iter2);
+
+// Test if iter1 is less than or equal to iter2
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+inline bool
+operator<=(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+           const EnumerateIterator<IntegerType2, IteratorType2>& iter2);
+
+// Test if iter1 is greater than iter2
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+inline bool
+operator>(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+          const EnumerateIterator<IntegerType2, IteratorType2>& iter2);
+
+// Test if iter1 is greater than or equal to iter2
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+inline bool
+operator>=(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+           const EnumerateIterator<IntegerType2, IteratorType2>& iter2);
+
+//===========================================================================//
+// INLINE IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct with a count and an iterator
+ *
+ * \param[in] count  The count of the element at \p iter
+ * \param[in] iter   The underlying iterator
+ */
+template<typename IntegerType, typename IteratorType>
+EnumerateIterator<IntegerType, IteratorType>::EnumerateIterator(
+    IntegerType_t count, IteratorType_t iter)
+{
+    m_data.iter = std::move(iter);
+    if constexpr (is_indexed)
+    {
+        m_data.start = count;
+        m_data.index = 0;
+    }
+    else
+    {
+        m_data.count = count;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct from an enumerate iterator with convertible types
+ *
+ * Used to convert an iterator over mutable elements to one over constant
+ * elements.
+ *
+ * \param[in] other_iter  The iterator to convert
+ */
+template<typename IntegerType, typename IteratorType>
+template<typename OtherIntegerType,
+         typename OtherIteratorType,
+         std::enable_if_t<
+             std::is_convertible_v<
+                 OtherIteratorType,
+                 std::remove_cv_t<std::remove_reference_t<IteratorType>>>,
+             bool>>
+EnumerateIterator<IntegerType, IteratorType>::EnumerateIterator(
+    const EnumerateIterator<OtherIntegerType, OtherIteratorType>& other_iter)
+    : EnumerateIterator(static_cast<IntegerType_t>(other_iter.count()),
+                        other_iter.base())
+{
+    /* * */
+}
+
+//---------------------------------------------------------------------------//
+// INCREMENT
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pre-increment operator
+ *
+ * \return A reference to this iterator after the increment is performed
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator++() -> This&
+{
+    if constexpr (is_indexed)
+    {
+        ++m_data.index;
+    }
+    else
+    {
+        ++m_data.iter;
+        ++m_data.count;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-increment operator
+ *
+ * \return A copy of this iterator before the increment is performed
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator++(int) -> This
+{
+    This copy = *this;
+    ++(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+// DECREMENT
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pre-decrement operator
+ *
+ * \return A reference to this iterator after the decrement is performed
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator--() -> This&
+{
+    static_assert(std::is_base_of_v<std::bidirectional_iterator_tag,
+                                    iterator_category>);
+
+    if constexpr (is_indexed)
+    {
+        --m_data.index;
+    }
+    else
+    {
+        --m_data.iter;
+        --m_data.count;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-decrement operator
+ *
+ * \return A copy of this iterator before the decrement is performed
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator--(int) -> This
+{
+    This copy = *this;
+    --(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+// DEREFERENCE, INDEX
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Dereference the underlying iterator
+ *
+ * \return A tuple of the count and of the referenced element
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator*() const
+    -> reference
+{
+    if constexpr (is_indexed)
+    {
+        return reference(
+            static_cast<IntegerType_t>(m_data.start + m_data.index),
+            m_data.iter[m_data.index]);
+    }
+    else
+    {
+        return reference(m_data.count, *m_data.iter);
+    }
+}
 
-template<typename IntegerType, typename OtherIntegerType, typename IteratorType>
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Index operation
+ *
+ * \param[in] n  The offset from the current position
+ *
+ * \return A tuple of the count and of the element \p n positions away
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator[](
+    difference_type n) const -> reference
+{
+    return *(*this + n);
+}
+
+//---------------------------------------------------------------------------//
+// COMPOUND ARITHMETIC
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compound addition-assignment operator
+ *
+ * \param[in] n  The number of positions to advance
+ *
+ * \return A reference to this iterator after it is advanced
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator+=(
+    difference_type n) -> This&
+{
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                    iterator_category>);
+
+    if constexpr (is_indexed)
+    {
+        m_data.index += n;
+    }
+    else
+    {
+        m_data.iter += n;
+        m_data.count = static_cast<IntegerType_t>(m_data.count + n);
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compound subtraction-assignment operator
+ *
+ * \param[in] n  The number of positions to move back
+ *
+ * \return A reference to this iterator after it is moved
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::operator-=(
+    difference_type n) -> This&
+{
+    return *this += -n;
+}
+
+//---------------------------------------------------------------------------//
+// ACCESSORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the underlying iterator at the current position
+ *
+ * \return The underlying iterator
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::base() const
+    -> IteratorType_t
+{
+    if constexpr (is_indexed)
+    {
+        return m_data.iter + m_data.index;
+    }
+    else
+    {
+        return m_data.iter;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the count of the current position
+ *
+ * \return The count
+ */
+template<typename IntegerType, typename IteratorType>
+auto EnumerateIterator<IntegerType, IteratorType>::count() const
+    -> IntegerType_t
+{
+    if constexpr (is_indexed)
+    {
+        return static_cast<IntegerType_t>(m_data.start + m_data.index);
+    }
+    else
+    {
+        return m_data.count;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum an iterator and an integral value
+ *
+ * \param[in] iter  The enumerate iterator
+ * \param[in] n     The number of positions to advance
+ *
+ * \return The iterator \p n positions after \p iter
+ */
+template<typename IntegerType, typename IteratorType>
 EnumerateIterator<IntegerType, IteratorType>
 operator+(const EnumerateIterator<IntegerType, IteratorType>& iter,
-          OtherIntegerType n);
+          typename EnumerateIterator<IntegerType, IteratorType>::difference_type
+              n)
+{
+    EnumerateIterator<IntegerType, IteratorType> result(iter);
+    result += n;
+    return result;
+}
 
-template<typename IntegerType, typename OtherIntegerType, typename IteratorType>
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum an integral value and an iterator
+ *
+ * \param[in] n     The number of positions to advance
+ * \param[in] iter  The enumerate iterator
+ *
+ * \return The iterator \p n positions after \p iter
+ */
+template<typename IntegerType, typename IteratorType>
 EnumerateIterator<IntegerType, IteratorType>
-operator+(OtherIntegerType n,
-          const EnumerateIterator<IntegerType, IteratorType>& iter);
+operator+(typename EnumerateIterator<IntegerType, IteratorType>::difference_type
+              n,
+          const EnumerateIterator<IntegerType, IteratorType>& iter)
+{
+    return iter + n;
+}
 
-template<typename IntegerType, typename OtherIntegerType, typename IteratorType>
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Subtract an integral value from an iterator
+ *
+ * \param[in] iter  The enumerate iterator
+ * \param[in] n     The number of positions to move back
+ *
+ * \return The iterator \p n positions before \p iter
+ */
+template<typename IntegerType, typename IteratorType>
 EnumerateIterator<IntegerType, IteratorType>
 operator-(const EnumerateIterator<IntegerType, IteratorType>& iter,
-          OtherIntegerType n);
+          typename EnumerateIterator<IntegerType, IteratorType>::difference_type
+              n)
+{
+    EnumerateIterator<IntegerType, IteratorType> result(iter);
+    result -= n;
+    return result;
+}
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the distance between two enumerate iterators
+ *
+ * \param[in] iter1  The ending enumerate iterator
+ * \param[in] iter2  The beginning enumerate iterator
+ *
+ * \return The distance from \p iter2 to \p iter1
+ */
 template<typename IntegerType1,
          typename IntegerType2,
          typename IteratorType1,
          typename IteratorType2>
-         typename 
+auto operator-(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+               const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+    -> decltype(iter1.base() - iter2.base())
+{
+    return iter1.base() - iter2.base();
+}
 
 //---------------------------------------------------------------------------//
-}  // namespace itertools
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test equality between two enumerate iterators
+ *
+ * \param[in] iter1  The first enumerate iterator
+ * \param[in] iter2  The second enumerate iterator
+ *
+ * \return True if the iterators point to the same position
+ */
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+bool operator==(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+                const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+{
+    return iter1.base() == iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test inequality between two enumerate iterators
+ *
+ * \param[in] iter1  The first enumerate iterator
+ * \param[in] iter2  The second enumerate iterator
+ *
+ * \return True if the iterators point to different positions
+ */
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+bool operator!=(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+                const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+{
+    return !(iter1 == iter2);
+}
 
 //---------------------------------------------------------------------------//
-// INLINE DEFINITIONS
+/*!
+ * \brief Test if iter1 is less than iter2
+ *
+ * \param[in] iter1  The first enumerate iterator
+ * \param[in] iter2  The second enumerate iterator
+ *
+ * \return True if \p iter1 precedes \p iter2
+ */
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+bool operator<(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+               const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+{
+    return iter1.base() < iter2.base();
+}
+
 //---------------------------------------------------------------------------//
-// #include "EnumerateIterator.i.hh"
+/*!
+ * \brief Test if iter1 is less than or equal to iter2
+ *
+ * \param[in] iter1  The first enumerate iterator
+ * \param[in] iter2  The second enumerate iterator
+ *
+ * \return True if \p iter1 does not follow \p iter2
+ */
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+bool operator<=(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+                const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+{
+    return !(iter2 < iter1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test if iter1 is greater than iter2
+ *
+ * \param[in] iter1  The first enumerate iterator
+ * \param[in] iter2  The second enumerate iterator
+ *
+ * \return True if \p iter1 follows \p iter2
+ */
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+bool operator>(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+               const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+{
+    return iter2 < iter1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test if iter1 is greater than or equal to iter2
+ *
+ * \param[in] iter1  The first enumerate iterator
+ * \param[in] iter2  The second enumerate iterator
+ *
+ * \return True if \p iter1 does not precede \p iter2
+ */
+template<typename IntegerType1,
+         typename IntegerType2,
+         typename IteratorType1,
+         typename IteratorType2>
+bool operator>=(const EnumerateIterator<IntegerType1, IteratorType1>& iter1,
+                const EnumerateIterator<IntegerType2, IteratorType2>& iter2)
+{
+    return !(iter1 < iter2);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
 
 //---------------------------------------------------------------------------//
 #endif  // ITERTOOLS_SRC_ENUMERATE_DETAIL_ENUMERATEITERATOR_HH
@@ -0,0 +1,170 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/enumerate/tests/tstEnumerate.cc
+ * \brief  Tests for enumerate.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Enumerate.hh"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "range/Range.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(EnumerateTest, Vector)
+{
+    std::vector<int> x(5, 1);
+    auto e = itertools::enumerate(x);
+    static_assert(decltype(e)::iterator::is_indexed);
+    EXPECT_EQ(5u, e.size());
+    EXPECT_FALSE(e.empty());
+
+    for (auto [i, xi] : e)
+    {
+        static_assert(std::is_same_v<decltype(i), std::size_t>);
+        xi += static_cast<int>(i);
+    }
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4, 5}), x);
+
+    // Starting count of another type
+    std::vector<long> counts;
+    for (auto [i, xi] : itertools::enumerate(x, -2))
+    {
+        static_assert(std::is_same_v<decltype(i), int>);
+        counts.push_back(i * xi);
+    }
+    EXPECT_EQ((std::vector<long>{-2, -2, 0, 4, 10}), counts);
+
+    // Constant and empty sequences
+    const std::array<std::string, 2> names{"a", "b"};
+    auto [i, name] = *itertools::enumerate(names).begin();
+    static_assert(std::is_same_v<decltype(name), const std::string&>);
+    EXPECT_EQ(0u, i);
+    EXPECT_EQ("a", name);
+
+    std::vector<int> empty;
+    auto e_empty = itertools::enumerate(empty);
+    EXPECT_TRUE(e_empty.empty());
+    EXPECT_EQ(e_empty.begin(), e_empty.end());
+}
+
+//---------------------------------------------------------------------------//
+TEST(EnumerateTest, Algorithms)
+{
+    std::vector<double> x{3.0, 1.0, 4.0, 1.0, 5.0};
+    auto e = itertools::enumerate(x, 1);
+
+    // Random access
+    EXPECT_EQ(5, e.end() - e.begin());
+    EXPECT_EQ(4.0, std::get<1>(e.begin()[2]));
+
+    auto iter = std::find_if(e.begin(), e.end(), [](const auto& p) {
+        return std::get<1>(p) > 3.5;
+    });
+    EXPECT_EQ(3, iter.count());
+    EXPECT_EQ(x.begin() + 2, iter.base());
+}
+
+//---------------------------------------------------------------------------//
+TEST(EnumerateTest, NonContiguous)
+{
+    // Views and sequences without random access
+    std::vector<int> values;
+    for (auto [i, v] : itertools::enumerate(itertools::range(10, 40, 10)))
+    {
+        values.push_back(static_cast<int>(i) + v);
+    }
+    EXPECT_EQ((std::vector<int>{10, 21, 32}), values);
+
+    std::forward_list<char> chars{'x', 'y', 'z'};
+    auto e = itertools::enumerate(chars, 'a');
+    static_assert(!decltype(e)::iterator::is_indexed);
+    EXPECT_EQ(3u, e.size());
+    std::string pairs;
+    for (auto [c, value] : e)
+    {
+        pairs += c;
+        pairs += value;
+    }
+    EXPECT_EQ("axbycz", pairs);
+    EXPECT_EQ('d', e.end().count());
+}
+
+//---------------------------------------------------------------------------//
+TEST(EnumerateTest, Split)
+{
+    std::vector<int> x(10);
+    const auto e = itertools::enumerate(x, 100);
+
+    // Sub-ranges count from their global offset
+    auto middle = e.slice(4, 3);
+    EXPECT_EQ(3u, middle.size());
+    EXPECT_EQ(104, middle.begin().count());
+    EXPECT_EQ(x.begin() + 4, middle.begin().base());
+    EXPECT_EQ(x.begin() + 7, middle.end().base());
+    EXPECT_EQ(105, std::get<0>(middle[1]));
+
+    const auto parts = e.split(3);
+    ASSERT_EQ(3u, parts.size());
+    std::vector<int> counts;
+    for (auto part : parts)
+    {
+        for (auto [i, xi] : part)
+        {
+            xi = i;
+            counts.push_back(i);
+        }
+    }
+    EXPECT_EQ(4u, parts[0].size());
+    EXPECT_EQ(107, parts[2].begin().count());
+    EXPECT_EQ((std::vector<int>{100, 101, 102, 103, 104, 105, 106, 107, 108,
+                                109}),
+              counts);
+    EXPECT_EQ(counts, x);
+
+    // Sub-ranges of sub-ranges, and a minimum grain
+    EXPECT_EQ(105, parts[1].slice(1, 2).begin().count());
+    EXPECT_EQ(2u, e.split(8, 4).size());
+    EXPECT_EQ(0u, e.slice(10, 0).size());
+}
+
+//---------------------------------------------------------------------------//
+TEST(EnumerateTest, ParallelAlgorithms)
+{
+    const std::size_t n = 100000;
+    std::vector<long> x(n, 0);
+    std::vector<std::atomic<int>> visited(n);
+    auto e = itertools::enumerate(x);
+
+    std::for_each(std::execution::par, e.begin(), e.end(), [&](auto pair) {
+        auto [i, xi] = pair;
+        xi = static_cast<long>(i);
+        visited[i].fetch_add(1);
+    });
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(1, visited[i].load()) << "at index " << i;
+        ASSERT_EQ(static_cast<long>(i), x[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end of src/enumerate/tests/tstEnumerate.cc
+//---------------------------------------------------------------------------//
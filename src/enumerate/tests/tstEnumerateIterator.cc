@@ -0,0 +1,99 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/enumerate/tests/tstEnumerateIterator.cc
+ * \brief  Tests for class EnumerateIterator.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../detail/EnumerateIterator.hh"
+
+#include <iterator>
+#include <list>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(EnumerateIteratorTest, Contiguous)
+{
+    std::vector<double> x{1.0, 2.0, 3.0, 4.0};
+    using Iter
+        = itertools::EnumerateIterator<int, std::vector<double>::iterator>;
+    static_assert(Iter::is_indexed);
+    static_assert(std::is_same_v<Iter::reference, std::tuple<int, double&>>);
+    static_assert(std::is_same_v<Iter::value_type, std::tuple<int, double>>);
+    static_assert(std::is_same_v<Iter::iterator_category,
+                                 std::random_access_iterator_tag>);
+    static_assert(std::is_trivially_copyable_v<Iter>);
+
+    Iter first(10, x.begin());
+    Iter last = first + 4;
+    EXPECT_EQ(4, last - first);
+    EXPECT_EQ(x.end(), last.base());
+    EXPECT_EQ(14, last.count());
+
+    auto [i, xi] = *first;
+    EXPECT_EQ(10, i);
+    xi = -1.0;
+    EXPECT_EQ(-1.0, x[0]);
+
+    ++first;
+    EXPECT_EQ(11, std::get<0>(*first));
+    EXPECT_EQ(2.0, std::get<1>(*first));
+    EXPECT_EQ(std::make_tuple(13, 4.0), Iter::value_type(first[2]));
+    EXPECT_EQ(std::make_tuple(12, 3.0), Iter::value_type(*(last - 2)));
+    first += 2;
+    --first;
+    EXPECT_EQ(12, first.count());
+
+    EXPECT_TRUE(first < last);
+    EXPECT_TRUE(first <= first);
+    EXPECT_TRUE(last > first);
+    EXPECT_TRUE(last >= first);
+    EXPECT_TRUE(first != last);
+    EXPECT_EQ(last, 2 + first);
+
+    // Conversion to an iterator over constant elements
+    itertools::EnumerateIterator<int, std::vector<double>::const_iterator>
+        cfirst(first);
+    EXPECT_EQ(first, cfirst);
+    EXPECT_EQ(12, cfirst.count());
+    static_assert(
+        std::is_same_v<decltype(cfirst)::reference,
+                       std::tuple<int, const double&>>);
+}
+
+//---------------------------------------------------------------------------//
+TEST(EnumerateIteratorTest, Bidirectional)
+{
+    std::list<char> chars{'a', 'b', 'c'};
+    using Iter = itertools::EnumerateIterator<unsigned, std::list<char>::iterator>;
+    static_assert(!Iter::is_indexed);
+    static_assert(std::is_same_v<Iter::iterator_category,
+                                 std::bidirectional_iterator_tag>);
+
+    Iter iter(0, chars.begin());
+    const Iter last(3, chars.end());
+    EXPECT_EQ(3, std::distance(iter, last));
+
+    iter++;
+    EXPECT_EQ(1u, iter.count());
+    EXPECT_EQ('b', std::get<1>(*iter));
+    std::get<1>(*iter) = 'B';
+    EXPECT_EQ('B', *std::next(chars.begin()));
+
+    iter--;
+    EXPECT_EQ(0u, iter.count());
+    EXPECT_EQ(chars.begin(), iter.base());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/enumerate/tests/tstEnumerateIterator.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,48 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/enumerate/tests/vecEnumerate.cc
+ * \brief  Kernels that must vectorize when looping over an enumeration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Enumerate.hh"
+
+#include <cstddef>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+// The loops marked "// vectorized" are checked by the vecEnumerate test.
+
+void axpyIndex(float a, const float* x, std::vector<float>& y)
+{
+    for (auto [i, yi] : itertools::enumerate(y))  // vectorized
+    {
+        yi = a * x[i] + yi;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void ramp(std::vector<float>& x, float dx)
+{
+    for (auto [i, xi] : itertools::enumerate(x, 0))  // vectorized
+    {
+        xi = static_cast<float>(i) * dx;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void rampOffset(std::vector<int>& x, int start)
+{
+    for (auto [i, xi] : itertools::enumerate(x, start))  // vectorized
+    {
+        xi += i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end of src/enumerate/tests/vecEnumerate.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,188 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/ParallelFor.hh
+ * \brief  parallelFor function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PARALLEL_PARALLELFOR_HH
+#define ITERTOOLS_SRC_PARALLEL_PARALLELFOR_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "ThreadPool.hh"
+#include "detail/ParallelForLoop.hh"
+
+namespace itertools
+{
+//---------------------------------------------------------------------------//
+// PARALLEL LOOPS
+//---------------------------------------------------------------------------//
+// Apply a function to every element of [first, last) using a thread pool
+template<typename Iterator, typename Function>
+inline void parallelFor(ThreadPool& pool,
+                        Iterator first,
+                        Iterator last,
+                        Function&& function,
+                        std::size_t grain = 0);
+
+// Apply a function to every element of [first, last) using the global pool
+template<typename Iterator, typename Function>
+inline void parallelFor(Iterator first,
+                        Iterator last,
+                        Function&& function,
+                        std::size_t grain = 0);
+
+// Apply a function to every element of a range using a thread pool
+template<typename RangeType, typename Function>
+inline void parallelFor(ThreadPool& pool,
+                        RangeType&& range,
+                        Function&& function,
+                        std::size_t grain = 0);
+
+// Apply a function to every element of a range using the global pool
+template<typename RangeType, typename Function>
+inline void
+parallelFor(RangeType&& range, Function&& function, std::size_t grain = 0);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Apply \p function to every element of [\p first, \p last) using the
+ *        threads of \p pool
+ *
+ * The index space is split recursively and lazily: a thread executing an
+ * interval only splits off its upper half when its previous half has been
+ * stolen by an idle thread, and otherwise processes \p grain elements at a
+ * time.  Irregular work is therefore balanced dynamically, while regular
+ * work is split only as often as there are idle threads.
+ *
+ * The calling thread takes part in the loop and returns when every element
+ * has been processed.  If \p function throws, the remaining elements are
+ * skipped and the first exception is rethrown to the caller.
+ *
+ * \tparam Iterator  A random-access iterator (e.g., a RangeIterator, a
+ *                   ZipIterator over random-access iterators or a pointer)
+ * \tparam Function  A callable accepting the iterator's reference type
+ *
+ * \param[in] pool      The thread pool
+ * \param[in] first     The beginning of the elements
+ * \param[in] last      The ending of the elements
+ * \param[in] function  The function applied to each element
+ * \param[in] grain     The number of elements processed between checks for
+ *                      idle threads; zero selects a default based on the
+ *                      number of elements and threads
+ */
+template<typename Iterator, typename Function>
+void parallelFor(ThreadPool& pool,
+                 Iterator first,
+                 Iterator last,
+                 Function&& function,
+                 std::size_t grain)
+{
+    static_assert(
+        std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>,
+        "parallelFor requires random-access iterators");
+    IT_REQUIRE(!(last < first));
+
+    const auto count = static_cast<std::size_t>(last - first);
+    if (count == 0)
+    {
+        return;
+    }
+    if (grain == 0)
+    {
+        grain = std::clamp<std::size_t>(
+            count / (64 * pool.concurrency()), 1, 1024);
+    }
+
+    detail::ParallelForLoop<Iterator, std::remove_reference_t<Function>> loop(
+        pool, first, function, grain, count);
+    loop.run(0, count);
+    pool.waitUntil([&loop] { return loop.done(); });
+    loop.rethrow();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply \p function to every element of [\p first, \p last) using the
+ *        global thread pool
+ *
+ * \param[in] first     The beginning of the elements
+ * \param[in] last      The ending of the elements
+ * \param[in] function  The function applied to each element
+ * \param[in] grain     The number of elements processed between checks for
+ *                      idle threads (zero selects a default)
+ */
+template<typename Iterator, typename Function>
+void parallelFor(Iterator first,
+                 Iterator last,
+                 Function&& function,
+                 std::size_t grain)
+{
+    parallelFor(ThreadPool::global(),
+                first,
+                last,
+                std::forward<Function>(function),
+                grain);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply \p function to every element of \p range using the threads of
+ *        \p pool
+ *
+ * \param[in] pool      The thread pool
+ * \param[in] range     A range with random-access iterators, e.g., a Range
+ * \param[in] function  The function applied to each element
+ * \param[in] grain     The number of elements processed between checks for
+ *                      idle threads (zero selects a default)
+ */
+template<typename RangeType, typename Function>
+void parallelFor(ThreadPool& pool,
+                 RangeType&& range,
+                 Function&& function,
+                 std::size_t grain)
+{
+    using std::begin;
+    using std::end;
+    parallelFor(pool,
+                begin(range),
+                end(range),
+                std::forward<Function>(function),
+                grain);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply \p function to every element of \p range using the global
+ *        thread pool
+ *
+ * \param[in] range     A range with random-access iterators, e.g., a Range
+ * \param[in] function  The function applied to each element
+ * \param[in] grain     The number of elements processed between checks for
+ *                      idle threads (zero selects a default)
+ */
+template<typename RangeType, typename Function>
+void parallelFor(RangeType&& range, Function&& function, std::size_t grain)
+{
+    parallelFor(ThreadPool::global(),
+                std::forward<RangeType>(range),
+                std::forward<Function>(function),
+                grain);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PARALLEL_PARALLELFOR_HH
+//---------------------------------------------------------------------------//
+// end of src/parallel/ParallelFor.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,258 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/ParallelRadixSort.hh
+ * \brief  parallelRadixSort function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PARALLEL_PARALLELRADIXSORT_HH
+#define ITERTOOLS_SRC_PARALLEL_PARALLELRADIXSORT_HH
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/DBC.hh"
+#include "range/Range.hh"
+#include "zip/RadixSort.hh"
+#include "ParallelFor.hh"
+#include "ThreadPool.hh"
+
+namespace itertools
+{
+//---------------------------------------------------------------------------//
+// PARALLEL SORTING
+//---------------------------------------------------------------------------//
+// Radix sort [first, last) by key using a thread pool
+template<typename Iterator>
+inline void parallelRadixSort(ThreadPool& pool, Iterator first, Iterator last);
+
+// Radix sort [first, last) by key using the global pool
+template<typename Iterator>
+inline void parallelRadixSort(Iterator first, Iterator last);
+
+// Radix sort a range by key using a thread pool
+template<typename RangeType>
+inline void parallelRadixSort(ThreadPool& pool, RangeType&& range);
+
+// Radix sort a range by key using the global pool
+template<typename RangeType>
+inline void parallelRadixSort(RangeType&& range);
+
+namespace detail
+{
+//! Number of elements per thread below which the sort runs serially
+constexpr std::size_t parallel_radix_sort_cutoff = 16384;
+}  // namespace detail
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Radix sort [\p first, \p last) by key using the threads of \p pool
+ *
+ * The result is the same as radixSort(), which documents the keys and
+ * columns.  The elements are split into one contiguous block per thread.
+ * Each pass, every block counts its digits in a histogram of its own; the
+ * histograms are combined into the offsets of each digit in each block, in
+ * block order so the sort stays stable; and the blocks then scatter all the
+ * columns concurrently into disjoint positions.  The counts of the first
+ * pass come from the initial sweep, which also finds the passes to skip.
+ *
+ * Sorts of fewer than \c parallel_radix_sort_cutoff elements per thread run
+ * serially.
+ *
+ * \param[in] pool   The thread pool
+ * \param[in] first  The beginning of the elements
+ * \param[in] last   The ending of the elements
+ */
+template<typename Iterator>
+void parallelRadixSort(ThreadPool& pool, Iterator first, Iterator last)
+{
+    static_assert(
+        std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>,
+        "parallelRadixSort requires random-access iterators");
+    IT_REQUIRE(!(last < first));
+
+    using Columns_t = detail::radix_columns_t<Iterator>;
+    using Histograms_t = detail::radix_histograms_t<Iterator>;
+    using Indices_t = std::make_index_sequence<std::tuple_size_v<Columns_t>>;
+
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t num_blocks = pool.concurrency();
+    if (num_blocks < 2 || n < num_blocks * detail::parallel_radix_sort_cutoff)
+    {
+        radixSort(first, last);
+        return;
+    }
+    auto block_begin = [n, num_blocks](std::size_t b) {
+        return b * n / num_blocks;
+    };
+    const auto blocks = range(num_blocks);
+
+    // Count the digits of every pass, per block and in total
+    const Columns_t columns = detail::radixColumns(first);
+    std::vector<Histograms_t> block_counts(num_blocks);
+    parallelFor(
+        pool,
+        blocks,
+        [&](std::size_t b) {
+            block_counts[b] = Histograms_t{};
+            detail::radixCountAll(std::get<0>(columns),
+                                  block_begin(b),
+                                  block_begin(b + 1),
+                                  block_counts[b]);
+        },
+        1);
+    Histograms_t totals{};
+    for (const Histograms_t& counts : block_counts)
+    {
+        for (std::size_t pass = 0; pass < totals.size(); ++pass)
+        {
+            for (std::size_t d = 0; d < detail::radix_size; ++d)
+            {
+                totals[pass][d] += counts[pass][d];
+            }
+        }
+    }
+
+    detail::RadixBuffers<Columns_t> buffers(n);
+    const auto scratch = buffers.columns();
+    std::vector<detail::RadixHistogram> offsets(num_blocks);
+
+    // Alternate between the columns and the scratch buffers
+    bool in_scratch = false;
+    bool scattered = false;
+    for (std::size_t pass = 0; pass < totals.size(); ++pass)
+    {
+        if (detail::radixPassIsTrivial(totals[pass], n))
+        {
+            continue;
+        }
+
+        // Count the digits of the blocks in their current order
+        if (scattered)
+        {
+            parallelFor(
+                pool,
+                blocks,
+                [&](std::size_t b) {
+                    offsets[b] = detail::RadixHistogram{};
+                    auto count = [&](const auto& src) {
+                        detail::radixCount(std::get<0>(src),
+                                           block_begin(b),
+                                           block_begin(b + 1),
+                                           pass,
+                                           offsets[b]);
+                    };
+                    in_scratch ? count(scratch) : count(columns);
+                },
+                1);
+        }
+        else
+        {
+            for (std::size_t b = 0; b < num_blocks; ++b)
+            {
+                offsets[b] = block_counts[b][pass];
+            }
+        }
+
+        // Offsets of each digit in each block, in block order
+        std::size_t sum = 0;
+        for (std::size_t d = 0; d < detail::radix_size; ++d)
+        {
+            for (std::size_t b = 0; b < num_blocks; ++b)
+            {
+                sum += std::exchange(offsets[b][d], sum);
+            }
+        }
+
+        parallelFor(
+            pool,
+            blocks,
+            [&](std::size_t b) {
+                auto scatter = [&](const auto& src, const auto& dst) {
+                    detail::radixScatter(src,
+                                         dst,
+                                         block_begin(b),
+                                         block_begin(b + 1),
+                                         pass,
+                                         offsets[b],
+                                         Indices_t());
+                };
+                in_scratch ? scatter(scratch, columns)
+                           : scatter(columns, scratch);
+            },
+            1);
+        in_scratch = !in_scratch;
+        scattered = true;
+    }
+    if (in_scratch)
+    {
+        parallelFor(
+            pool,
+            blocks,
+            [&](std::size_t b) {
+                detail::radixMove(scratch,
+                                  columns,
+                                  block_begin(b),
+                                  block_begin(b + 1),
+                                  Indices_t());
+            },
+            1);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Radix sort [\p first, \p last) by key using the global thread pool
+ *
+ * \param[in] first  The beginning of the elements
+ * \param[in] last   The ending of the elements
+ */
+template<typename Iterator>
+void parallelRadixSort(Iterator first, Iterator last)
+{
+    parallelRadixSort(ThreadPool::global(), first, last);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Radix sort \p range by key using the threads of \p pool
+ *
+ * \param[in] pool   The thread pool
+ * \param[in] range  A range with random-access iterators, e.g., a zip
+ */
+template<typename RangeType>
+void parallelRadixSort(ThreadPool& pool, RangeType&& range)
+{
+    using std::begin;
+    using std::end;
+    parallelRadixSort(pool, begin(range), end(range));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Radix sort \p range by key using the global thread pool
+ *
+ * \param[in] range  A range with random-access iterators, e.g., a zip
+ */
+template<typename RangeType>
+void parallelRadixSort(RangeType&& range)
+{
+    parallelRadixSort(ThreadPool::global(), std::forward<RangeType>(range));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PARALLEL_PARALLELRADIXSORT_HH
+//---------------------------------------------------------------------------//
+// end of src/parallel/ParallelRadixSort.hh
+//---------------------------------------------------------------------------//
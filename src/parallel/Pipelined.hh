@@ -0,0 +1,430 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/Pipelined.hh
+ * \brief  PipelinedRange class and pipelined declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PARALLEL_PIPELINED_HH
+#define ITERTOOLS_SRC_PARALLEL_PIPELINED_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "core/DBC.hh"
+#include "detail/SpscRing.hh"
+#include "zip/detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class PipelinedRange
+ * \brief A single-pass view of a sequence produced ahead by a helper thread
+ *
+ * Pipelined ranges are created by pipelined().  On construction, a helper
+ * thread starts iterating the sequence and stores copies of its elements in
+ * a lock-free single-producer/single-consumer ring of bounded depth; the
+ * loop over the pipelined range takes them out in order.  Sequences whose
+ * iteration is expensive, such as decoders, parsers or file readers, are
+ * thereby produced while the previous elements are being consumed:
+ * \code
+ * auto records = range(num_blocks) | transform(decodeBlock);
+ * for (auto& block : pipelined(records, 4))
+ * {
+ *     process(block);
+ * }
+ * \endcode
+ * To hand over batches rather than single elements, pipeline a sequence of
+ * batches, e.g., <tt>batched(x, n) | transform(decodeBatch)</tt>.
+ *
+ * The consumer waits for the producer by yielding a bounded number of times,
+ * then sleeping on a condition variable, as the idle workers of ThreadPool
+ * do; the producer waits likewise when the ring is full.  An
+ * exception thrown by the sequence ends the production and is rethrown to
+ * the consumer after the elements produced before it.  Destroying the range
+ * early (e.g., leaving the loop with \c break) stops the producer after its
+ * current element.
+ *
+ * The range can be iterated only once and can be neither copied nor moved.
+ * Like zip(), it does not copy the sequence, which must outlive the range
+ * unless it is a view whose iterators do not refer to it.
+ *
+ * \tparam Iterator  The iterator type of the sequence
+ * \tparam Sentinel  The type of the ending iterator of the sequence
+ *
+ * \example parallel/tests/tstPipelined.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, typename Sentinel>
+class PipelinedRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = value_type&;
+    using size_type = std::size_t;
+    //@}
+
+    class iterator;
+
+  public:
+    // Start producing the elements of [first, last)
+    inline PipelinedRange(Iterator first, Sentinel last, size_type depth);
+
+    // Stop the producer and destroy the elements not consumed
+    inline ~PipelinedRange();
+
+    // Disable copy and move
+    PipelinedRange(const PipelinedRange&) = delete;
+    PipelinedRange& operator=(const PipelinedRange&) = delete;
+
+    // Return the iterator at the first element not consumed
+    inline iterator begin();
+
+    //! Return the ending iterator
+    iterator end() { return iterator(); }
+
+    //! Return the maximum number of elements produced ahead
+    size_type depth() const { return m_ring.capacity(); }
+
+  private:
+    // Produce the elements on the helper thread
+    inline void produce(Iterator first, Sentinel last);
+
+    // Wait for the next element; return nullptr at the end of the sequence
+    inline value_type* next();
+
+    // Wait until a condition holds, yielding and then sleeping
+    template<typename Predicate>
+    inline void wait(Predicate pred);
+
+    // Wake the other thread if it sleeps
+    inline void notify();
+
+    //! Number of times a waiting thread yields before going to sleep
+    static constexpr int num_wait_spins = 64;
+
+    // >>> DATA
+    //! Produced elements not yet consumed
+    detail::SpscRing<value_type> m_ring;
+
+    //! Exception thrown by the sequence, published with m_done
+    std::exception_ptr m_error;
+
+    //! Whether the producer has finished
+    std::atomic<bool> m_done{false};
+
+    //! Whether the consumer has stopped
+    std::atomic<bool> m_stop{false};
+
+    //! Number of sleeping threads
+    std::atomic<int> m_num_sleeping{0};
+
+    //@{
+    //! Synchronization for sleeping threads
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_wake;
+    //@}
+
+    //! The producer thread, started last
+    std::thread m_producer;
+};
+
+//===========================================================================//
+/*!
+ * \class PipelinedRange::iterator
+ * \brief Input iterator consuming the elements of a pipelined range
+ *
+ * The ending iterator is default constructed, as for stream iterators.
+ */
+//===========================================================================//
+
+template<typename Iterator, typename Sentinel>
+class PipelinedRange<Iterator, Sentinel>::iterator
+{
+  public:
+    //! Public type aliases
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename PipelinedRange::value_type;
+    using reference = value_type&;
+    using pointer = value_type*;
+    using iterator_category = std::input_iterator_tag;
+
+  public:
+    //! Default constructor (ending iterator)
+    iterator() = default;
+
+    //! Construct at the next element of a pipelined range
+    explicit iterator(PipelinedRange* parent)
+        : m_parent(parent), m_value(parent->next())
+    {
+    }
+
+    //! Dereference the current element, which may be moved from
+    reference operator*() const { return *m_value; }
+
+    //! Access a member of the current element
+    pointer operator->() const { return m_value; }
+
+    //! Pre-increment: release the element and wait for the next one
+    iterator& operator++()
+    {
+        IT_REQUIRE(m_value);
+        m_parent->m_ring.pop();
+        m_parent->notify();
+        m_value = m_parent->next();
+        return *this;
+    }
+
+    //! Post-increment (single pass: the previous element is released)
+    void operator++(int) { ++*this; }
+
+    //! Equality: both iterators are at the end, or at the same element
+    bool operator==(const iterator& other) const
+    {
+        return m_value == other.m_value;
+    }
+
+    //! Inequality
+    bool operator!=(const iterator& other) const
+    {
+        return m_value != other.m_value;
+    }
+
+  private:
+    // >>> DATA
+    PipelinedRange* m_parent = nullptr;
+    value_type* m_value = nullptr;
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Type of the pipelined view of a sequence
+template<typename RangeType>
+using pipelined_range_t = PipelinedRange<range_iterator_t<RangeType>,
+                                         range_sentinel_t<RangeType>>;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Produce the elements of a sequence ahead on a helper thread
+template<typename RangeType>
+inline detail::pipelined_range_t<RangeType>
+pipelined(RangeType&& range, std::size_t depth);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Start producing the elements of [\p first, \p last)
+ *
+ * \param[in] first  The beginning of the sequence
+ * \param[in] last   The ending of the sequence
+ * \param[in] depth  The maximum number of elements produced ahead (nonzero),
+ *                   rounded up to a power of two
+ */
+template<typename Iterator, typename Sentinel>
+PipelinedRange<Iterator, Sentinel>::PipelinedRange(Iterator first,
+                                                   Sentinel last,
+                                                   size_type depth)
+    : m_ring(depth)
+    , m_producer(
+          [this, first = std::move(first), last = std::move(last)]() mutable {
+              this->produce(std::move(first), std::move(last));
+          })
+{
+    /* * */
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Stop the producer and destroy the elements not consumed
+ */
+template<typename Iterator, typename Sentinel>
+PipelinedRange<Iterator, Sentinel>::~PipelinedRange()
+{
+    m_stop.store(true, std::memory_order_relaxed);
+    this->notify();
+    m_producer.join();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the iterator at the first element not consumed
+ *
+ * Waits until the producer has produced an element or reached the end of
+ * the sequence.
+ *
+ * \return The iterator
+ */
+template<typename Iterator, typename Sentinel>
+auto PipelinedRange<Iterator, Sentinel>::begin() -> iterator
+{
+    return iterator(this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Produce the elements of [\p first, \p last) on the helper thread
+ *
+ * Each element is copied out of the sequence once, then moved into the ring
+ * as soon as there is room.
+ *
+ * \param[in] first  The beginning of the sequence
+ * \param[in] last   The ending of the sequence
+ */
+template<typename Iterator, typename Sentinel>
+void PipelinedRange<Iterator, Sentinel>::produce(Iterator first,
+                                                 Sentinel last)
+{
+    try
+    {
+        for (; first != last; ++first)
+        {
+            value_type value(*first);
+            this->wait([this, &value] {
+                return m_ring.tryEmplace(std::move(value))
+                       || m_stop.load(std::memory_order_relaxed);
+            });
+            if (m_stop.load(std::memory_order_relaxed))
+            {
+                break;
+            }
+            this->notify();
+        }
+    }
+    catch (...)
+    {
+        m_error = std::current_exception();
+    }
+    m_done.store(true, std::memory_order_release);
+    this->notify();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Wait for the next element
+ *
+ * If the sequence threw an exception, it is rethrown once the elements
+ * produced before it have been consumed.
+ *
+ * \return The element at the head of the ring, or nullptr at the end
+ */
+template<typename Iterator, typename Sentinel>
+auto PipelinedRange<Iterator, Sentinel>::next() -> value_type*
+{
+    value_type* value = nullptr;
+    this->wait([this, &value] {
+        value = m_ring.front();
+        return value || m_done.load(std::memory_order_acquire);
+    });
+    if (value)
+    {
+        return value;
+    }
+
+    // Elements may have been added before the end was published
+    if ((value = m_ring.front()))
+    {
+        return value;
+    }
+    if (std::exception_ptr error = std::exchange(m_error, nullptr))
+    {
+        std::rethrow_exception(error);
+    }
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Wait until a condition holds
+ *
+ * The thread yields up to \c num_wait_spins times, as the other thread
+ * usually catches up quickly, then sleeps until notify() wakes it.
+ *
+ * \param[in] pred  The condition, evaluated repeatedly by the waiting thread
+ */
+template<typename Iterator, typename Sentinel>
+template<typename Predicate>
+void PipelinedRange<Iterator, Sentinel>::wait(Predicate pred)
+{
+    for (int i = 0; i < num_wait_spins; ++i)
+    {
+        if (pred())
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleep_mutex);
+    ++m_num_sleeping;
+    m_wake.wait(lock, pred);
+    --m_num_sleeping;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Wake the other thread if it sleeps
+ *
+ * Called after each update of the ring or of the flags that the other thread
+ * may be waiting for.  The number of sleeping threads is read with a
+ * read-modify-write, ordered with the increment in wait(): either this
+ * thread sees the other one going to sleep, or the other one evaluates its
+ * condition after the update.
+ */
+template<typename Iterator, typename Sentinel>
+void PipelinedRange<Iterator, Sentinel>::notify()
+{
+    if (m_num_sleeping.fetch_add(0) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_wake.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Produce the elements of a sequence ahead on a helper thread
+ *
+ * \param[in] range  The sequence, iterated once on the helper thread
+ * \param[in] depth  The maximum number of elements produced ahead (nonzero)
+ *
+ * \return A single-pass view of the elements, in order
+ */
+template<typename RangeType>
+detail::pipelined_range_t<RangeType>
+pipelined(RangeType&& range, std::size_t depth)
+{
+    IT_REQUIRE(depth > 0);
+
+    using std::begin;
+    using std::end;
+    return detail::pipelined_range_t<RangeType>(
+        begin(range), end(range), depth);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PARALLEL_PIPELINED_HH
+//---------------------------------------------------------------------------//
+// end of src/parallel/Pipelined.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,303 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/ThreadPool.cc
+ * \brief  ThreadPool class definitions.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "ThreadPool.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#include "core/DBC.hh"
+
+namespace itertools
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! The pool owning the calling thread, if any
+thread_local const ThreadPool* t_pool = nullptr;
+
+//! The queue index of the calling thread within t_pool
+thread_local std::size_t t_index = 0;
+
+//! Number of times an idle worker yields before going to sleep
+constexpr int num_idle_spins = 64;
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct a pool in which \p concurrency threads share the work
+ *
+ * \param[in] concurrency  The number of threads, including the waiting thread
+ */
+ThreadPool::ThreadPool(std::size_t concurrency)
+{
+    IT_REQUIRE(concurrency > 0);
+
+    m_queues.reserve(concurrency);
+    for (std::size_t i = 0; i < concurrency; ++i)
+    {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+
+    m_workers.reserve(concurrency - 1);
+    for (std::size_t i = 1; i < concurrency; ++i)
+    {
+        m_workers.emplace_back([this, i] { this->workerLoop(i); });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Stop and join the worker threads
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Push a task onto the queue of the calling thread
+ *
+ * \param[in] task  The task to push
+ */
+void ThreadPool::push(const Task& task)
+{
+    IT_REQUIRE(task.execute);
+    IT_REQUIRE(task.begin < task.end);
+
+    Queue& queue = *m_queues[this->localIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+        ++queue.size;
+    }
+    ++m_num_queued;
+
+    // Wake a sleeping worker to steal the task
+    if (m_num_sleeping.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_wake.notify_one();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return whether the queue of the calling thread is empty
+ *
+ * Parallel loops split their work lazily: a new task is only pushed when the
+ * previous one has been stolen, i.e., when the local queue is empty.
+ *
+ * \return True if no task is queued by the calling thread
+ */
+bool ThreadPool::localQueueEmpty() const
+{
+    return m_queues[this->localIndex()]->size.load(std::memory_order_relaxed)
+           == 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Execute one queued task
+ *
+ * The calling thread takes the newest task of its own queue or else steals
+ * the oldest task of another queue.
+ *
+ * \return True if a task was executed
+ */
+bool ThreadPool::tryRunTask()
+{
+    const std::size_t index = this->localIndex();
+    const std::size_t count = m_queues.size();
+
+    Task task;
+    bool found = this->popBack(index, task);
+    for (std::size_t i = 1; !found && i < count; ++i)
+    {
+        found = this->popFront((index + i) % count, task);
+    }
+
+    if (found)
+    {
+        task.execute(task.context, task.begin, task.end);
+    }
+    return found;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Access the process-wide pool
+ *
+ * The pool is created on first use with the default concurrency.
+ *
+ * \return The global thread pool
+ */
+ThreadPool& ThreadPool::global()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the default concurrency
+ *
+ * The \c ITERTOOLS_NUM_THREADS environment variable takes precedence over
+ * the hardware concurrency.
+ *
+ * \return The default number of threads sharing work in a pool
+ */
+std::size_t ThreadPool::defaultConcurrency()
+{
+    if (const char* env = std::getenv("ITERTOOLS_NUM_THREADS"))
+    {
+        const unsigned long value = std::strtoul(env, nullptr, 10);
+        if (value > 0)
+        {
+            return value;
+        }
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the queue index of the calling thread
+ *
+ * \return The index of the worker thread, or zero for outside threads
+ */
+std::size_t ThreadPool::localIndex() const
+{
+    return t_pool == this ? t_index : 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pop the newest task of queue \p i
+ *
+ * \param[in]  i     The queue index
+ * \param[out] task  The popped task
+ *
+ * \return True if a task was popped
+ */
+bool ThreadPool::popBack(std::size_t i, Task& task)
+{
+    Queue& queue = *m_queues[i];
+    if (queue.size.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+    {
+        return false;
+    }
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    --queue.size;
+    --m_num_queued;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pop the oldest task of queue \p i
+ *
+ * \param[in]  i     The queue index
+ * \param[out] task  The popped task
+ *
+ * \return True if a task was popped
+ */
+bool ThreadPool::popFront(std::size_t i, Task& task)
+{
+    Queue& queue = *m_queues[i];
+    if (queue.size.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+    {
+        return false;
+    }
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+    --queue.size;
+    --m_num_queued;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Main loop of the worker thread owning queue \p index
+ *
+ * \param[in] index  The queue index of the worker
+ */
+void ThreadPool::workerLoop(std::size_t index)
+{
+    t_pool = this;
+    t_index = index;
+
+    while (true)
+    {
+        if (this->tryRunTask())
+        {
+            continue;
+        }
+
+        // Spin briefly before sleeping: new work often arrives quickly
+        for (int i = 0; i < num_idle_spins && m_num_queued.load() == 0
+                        && !m_stop.load();
+             ++i)
+        {
+            std::this_thread::yield();
+        }
+        if (m_num_queued.load() > 0)
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        ++m_num_sleeping;
+        m_wake.wait(lock,
+                    [this] { return m_stop.load() || m_num_queued.load() > 0; });
+        --m_num_sleeping;
+        if (m_stop.load() && m_num_queued.load() == 0)
+        {
+            return;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/ThreadPool.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,168 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/ThreadPool.hh
+ * \brief  ThreadPool class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PARALLEL_THREADPOOL_HH
+#define ITERTOOLS_SRC_PARALLEL_THREADPOOL_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class ThreadPool
+ * \brief A work-stealing pool of threads executing index-interval tasks
+ *
+ * Each thread owns a task queue.  A thread pushes and pops tasks at the back
+ * of its own queue and, when it runs out of work, steals the oldest task from
+ * the front of another queue.  Old tasks cover the largest intervals, so a
+ * single steal usually moves a large share of the remaining work.
+ *
+ * A pool with a concurrency of \c n starts <tt>n - 1</tt> worker threads; the
+ * thread waiting for a parallel loop executes tasks as well, so \c n threads
+ * share the work.  Threads outside the pool share queue zero.
+ *
+ * Tasks are plain function pointers with a context pointer and an index
+ * interval: the pool performs one indirect call per interval, never per
+ * element.
+ *
+ * \example parallel/tests/tstThreadPool.cc
+ */
+//===========================================================================//
+
+class ThreadPool
+{
+  public:
+    //! A unit of work over the index interval [begin, end)
+    struct Task
+    {
+        //! Type of the function executing a task
+        using Execute_t = void (*)(void* context,
+                                   std::size_t begin,
+                                   std::size_t end);
+
+        Execute_t execute = nullptr;
+        void* context = nullptr;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+  public:
+    // Construct with the number of threads sharing the work
+    explicit ThreadPool(std::size_t concurrency = defaultConcurrency());
+
+    // Stop and join the worker threads
+    ~ThreadPool();
+
+    // Disable copy and move
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Return the number of threads sharing the work
+    std::size_t concurrency() const { return m_queues.size(); }
+
+    // Push a task onto the queue of the calling thread
+    void push(const Task& task);
+
+    // Return whether the queue of the calling thread is empty
+    bool localQueueEmpty() const;
+
+    // Execute one queued task, if any; return whether a task was executed
+    bool tryRunTask();
+
+    // Execute queued tasks until the predicate holds
+    template<typename Predicate>
+    inline void waitUntil(Predicate&& done);
+
+    // Access the process-wide pool
+    static ThreadPool& global();
+
+    // Return the default concurrency
+    static std::size_t defaultConcurrency();
+
+  private:
+    //! A task queue padded to its own cache lines
+    struct alignas(64) Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::atomic<std::size_t> size{0};
+    };
+
+    // Return the queue index of the calling thread
+    std::size_t localIndex() const;
+
+    // Pop the newest task of queue i
+    bool popBack(std::size_t i, Task& task);
+
+    // Pop the oldest task of queue i
+    bool popFront(std::size_t i, Task& task);
+
+    // Worker thread main loop
+    void workerLoop(std::size_t index);
+
+    // >>> DATA
+    //! One queue per thread; queue zero is shared by outside threads
+    std::vector<std::unique_ptr<Queue>> m_queues;
+
+    //! Worker threads
+    std::vector<std::thread> m_workers;
+
+    //! Total number of queued tasks
+    std::atomic<std::size_t> m_num_queued{0};
+
+    //! Number of sleeping worker threads
+    std::atomic<std::size_t> m_num_sleeping{0};
+
+    //! Whether the pool is shutting down
+    std::atomic<bool> m_stop{false};
+
+    //@{
+    //! Synchronization for sleeping workers
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_wake;
+    //@}
+};
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Execute queued tasks until \p done returns true
+ *
+ * The calling thread helps with any queued work while waiting, which also
+ * makes it safe to wait from inside a task (nested parallelism).
+ *
+ * \param[in] done  Predicate returning true when the wait is over
+ */
+template<typename Predicate>
+void ThreadPool::waitUntil(Predicate&& done)
+{
+    while (!done())
+    {
+        if (!this->tryRunTask())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PARALLEL_THREADPOOL_HH
+//---------------------------------------------------------------------------//
+// end of src/parallel/ThreadPool.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,108 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/benchmarks/bchParallelFor.cc
+ * \brief  Scaling benchmarks for parallelFor.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../ParallelFor.hh"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "range/Range.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+constexpr std::int64_t num_indices = 1 << 16;
+
+// Irregular per-index work: cost varies pseudo-randomly over [0, 2048)
+inline double irregularWork(std::int64_t i)
+{
+    const auto cost = (static_cast<std::uint64_t>(i) * 0x9E3779B97F4A7C15ull)
+                      >> 53;
+    double x = 0.0;
+    for (std::uint64_t k = 0; k < cost; ++k)
+    {
+        x += 1.0 / static_cast<double>(k + i + 1);
+    }
+    return x;
+}
+
+// Thread counts from 1 to the hardware concurrency
+void threadCounts(benchmark::internal::Benchmark* bench)
+{
+    const int max_threads
+        = static_cast<int>(itertools::ThreadPool::defaultConcurrency());
+    for (int t = 1; t <= max_threads; ++t)
+    {
+        bench->Arg(t);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Static partitioning: one balanced sub-range per thread
+void BM_StaticPartition(benchmark::State& state)
+{
+    const auto num_threads = static_cast<std::size_t>(state.range(0));
+    std::vector<double> out(num_indices);
+    const auto parts = itertools::range(num_indices).split(num_threads);
+
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 1; t < num_threads; ++t)
+        {
+            threads.emplace_back([&parts, &out, t] {
+                for (auto i : parts[t])
+                {
+                    out[i] = irregularWork(i);
+                }
+            });
+        }
+        for (auto i : parts[0])
+        {
+            out[i] = irregularWork(i);
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_indices);
+}
+BENCHMARK(BM_StaticPartition)->Apply(threadCounts)->UseRealTime();
+
+//---------------------------------------------------------------------------//
+// Work-stealing parallel loop
+void BM_ParallelFor(benchmark::State& state)
+{
+    itertools::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    std::vector<double> out(num_indices);
+
+    for (auto _ : state)
+    {
+        itertools::parallelFor(pool,
+                               itertools::range(num_indices),
+                               [&out](std::int64_t i) {
+                                   out[i] = irregularWork(i);
+                               });
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_indices);
+}
+BENCHMARK(BM_ParallelFor)->Apply(threadCounts)->UseRealTime();
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/benchmarks/bchParallelFor.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,74 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/benchmarks/bchParallelRadixSort.cc
+ * \brief  Scaling benchmarks for parallelRadixSort.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../ParallelRadixSort.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "zip/Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+constexpr std::size_t num_elements = 1 << 22;
+
+// Thread counts from 1 to the hardware concurrency
+void threadCounts(benchmark::internal::Benchmark* bench)
+{
+    const int max_threads
+        = static_cast<int>(itertools::ThreadPool::defaultConcurrency());
+    for (int t = 1; t <= max_threads; ++t)
+    {
+        bench->Arg(t);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Parallel radix sort of 32-bit keys with a 64-bit payload
+void BM_ParallelRadixSort(benchmark::State& state)
+{
+    itertools::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+
+    std::mt19937 engine(12345);
+    std::vector<std::uint32_t> input_keys(num_elements);
+    for (auto& key : input_keys)
+    {
+        key = engine();
+    }
+    std::vector<std::uint64_t> input_values(num_elements);
+    std::iota(input_values.begin(), input_values.end(), std::uint64_t(0));
+
+    std::vector<std::uint32_t> keys;
+    std::vector<std::uint64_t> values;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        keys = input_keys;
+        values = input_values;
+        state.ResumeTiming();
+
+        itertools::parallelRadixSort(pool, itertools::zip(keys, values));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * num_elements);
+}
+BENCHMARK(BM_ParallelRadixSort)->Apply(threadCounts)->UseRealTime();
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/benchmarks/bchParallelRadixSort.cc
+//---------------------------------------------------------------------------//
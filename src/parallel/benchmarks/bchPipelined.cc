@@ -0,0 +1,141 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/benchmarks/bchPipelined.cc
+ * \brief  Throughput and latency benchmarks for pipelined.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Pipelined.hh"
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+#include "pipeline/Pipeline.hh"
+#include "range/Range.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+constexpr std::int64_t num_elements = 1 << 14;
+
+// Bytes handed over per element
+constexpr std::int64_t bytes_per_element = sizeof(std::uint64_t);
+
+// Serial work of a given number of rounds, standing in for decoding or
+// processing an element
+inline std::uint64_t work(std::uint64_t x, int rounds)
+{
+    for (int k = 0; k < rounds; ++k)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+// Rounds of work of the producer and of the consumer for each element
+constexpr int produce_rounds = 256;
+constexpr int consume_rounds = 256;
+
+// Ring depths from a single slot to deep buffering
+void ringDepths(benchmark::internal::Benchmark* bench)
+{
+    for (int depth : {1, 4, 16, 64, 256})
+    {
+        bench->Arg(depth);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// THROUGHPUT
+//---------------------------------------------------------------------------//
+// Decoding and processing each element in turn on one thread
+void BM_Serial(benchmark::State& state)
+{
+    auto decoded = itertools::range<std::uint64_t>(1, num_elements + 1)
+                   | itertools::transform([](std::uint64_t i) {
+                         return work(i, produce_rounds);
+                     });
+    for (auto _ : state)
+    {
+        std::uint64_t total = 0;
+        for (std::uint64_t value : decoded)
+        {
+            total += work(value, consume_rounds);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_Serial)->UseRealTime();
+
+//---------------------------------------------------------------------------//
+// Decoding on the helper thread while the previous elements are processed
+void BM_Pipelined(benchmark::State& state)
+{
+    const auto depth = static_cast<std::size_t>(state.range(0));
+    auto decoded = itertools::range<std::uint64_t>(1, num_elements + 1)
+                   | itertools::transform([](std::uint64_t i) {
+                         return work(i, produce_rounds);
+                     });
+    for (auto _ : state)
+    {
+        std::uint64_t total = 0;
+        for (std::uint64_t value : itertools::pipelined(decoded, depth))
+        {
+            total += work(value, consume_rounds);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_Pipelined)->Apply(ringDepths)->UseRealTime();
+
+//---------------------------------------------------------------------------//
+// Hand-over cost alone: neither thread does any work per element
+void BM_Handoff(benchmark::State& state)
+{
+    const auto depth = static_cast<std::size_t>(state.range(0));
+    const auto values = itertools::range<std::uint64_t>(num_elements);
+    for (auto _ : state)
+    {
+        std::uint64_t total = 0;
+        for (std::uint64_t value : itertools::pipelined(values, depth))
+        {
+            total += value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_Handoff)->Apply(ringDepths)->UseRealTime();
+
+//---------------------------------------------------------------------------//
+// LATENCY
+//---------------------------------------------------------------------------//
+// Time from starting the producer to receiving the first element, including
+// stopping and joining it
+void BM_FirstElement(benchmark::State& state)
+{
+    const auto depth = static_cast<std::size_t>(state.range(0));
+    const auto values = itertools::range<std::uint64_t>(num_elements);
+    for (auto _ : state)
+    {
+        auto p = itertools::pipelined(values, depth);
+        benchmark::DoNotOptimize(*p.begin());
+    }
+}
+BENCHMARK(BM_FirstElement)->Apply(ringDepths)->UseRealTime();
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/benchmarks/bchPipelined.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,227 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/detail/ParallelForLoop.hh
+ * \brief  ParallelForLoop class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PARALLEL_DETAIL_PARALLELFORLOOP_HH
+#define ITERTOOLS_SRC_PARALLEL_DETAIL_PARALLELFORLOOP_HH
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+
+#include "core/DBC.hh"
+#include "parallel/ThreadPool.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class ParallelForLoop
+ * \brief Shared state of one parallelFor call
+ *
+ * The loop lives on the stack of the calling thread.  Tasks refer to it by
+ * pointer and cover disjoint index intervals of [0, count); the loop is done
+ * once every index has been accounted for.
+ *
+ * \tparam Iterator  A random-access iterator type
+ * \tparam Function  The type of the function applied to each element
+ */
+//===========================================================================//
+
+template<typename Iterator, typename Function>
+class ParallelForLoop
+{
+  public:
+    //! Public type aliases
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+
+  public:
+    // Constructor
+    inline ParallelForLoop(ThreadPool& pool,
+                           Iterator first,
+                           Function& function,
+                           std::size_t grain,
+                           std::size_t count);
+
+    // Process the index interval [begin, end), splitting it lazily
+    inline void run(std::size_t begin, std::size_t end);
+
+    //! Return whether every index has been processed
+    bool done() const
+    {
+        return m_remaining.load(std::memory_order_acquire) == 0;
+    }
+
+    // Rethrow the first exception thrown by the function, if any
+    inline void rethrow() const;
+
+    // Task entry point
+    static inline void
+    execute(void* context, std::size_t begin, std::size_t end);
+
+  private:
+    // Apply the function to the elements of [begin, end)
+    inline void process(std::size_t begin, std::size_t end);
+
+    // >>> DATA
+    ThreadPool& m_pool;
+    Iterator m_first;
+    Function& m_function;
+    std::size_t m_grain;
+
+    //! Number of indices not yet processed
+    std::atomic<std::size_t> m_remaining;
+
+    //! Whether the function has thrown
+    std::atomic<bool> m_failed{false};
+
+    //! The first exception thrown by the function
+    std::exception_ptr m_exception;
+};
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Construct the shared loop state
+ *
+ * \param[in] pool      The thread pool executing the loop
+ * \param[in] first     Iterator to the element at index zero
+ * \param[in] function  The function applied to each element
+ * \param[in] grain     Number of elements processed between split checks
+ * \param[in] count     The total number of elements
+ */
+template<typename Iterator, typename Function>
+ParallelForLoop<Iterator, Function>::ParallelForLoop(ThreadPool& pool,
+                                                     Iterator first,
+                                                     Function& function,
+                                                     std::size_t grain,
+                                                     std::size_t count)
+    : m_pool(pool)
+    , m_first(first)
+    , m_function(function)
+    , m_grain(grain)
+    , m_remaining(count)
+{
+    IT_REQUIRE(grain > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Process the index interval [\p begin, \p end)
+ *
+ * Lazy binary splitting: whenever the local queue of the calling thread is
+ * empty (its last pushed task was stolen, or none was pushed yet), the upper
+ * half of the interval is pushed for other threads to steal.  Otherwise the
+ * next \p grain elements are processed and the check is repeated.
+ *
+ * \param[in] begin  The first index
+ * \param[in] end    One past the last index
+ */
+template<typename Iterator, typename Function>
+void ParallelForLoop<Iterator, Function>::run(std::size_t begin,
+                                              std::size_t end)
+{
+    while (end - begin > m_grain)
+    {
+        if (m_pool.localQueueEmpty())
+        {
+            const std::size_t mid = begin + (end - begin) / 2;
+            m_pool.push({&ParallelForLoop::execute, this, mid, end});
+            end = mid;
+        }
+        else
+        {
+            this->process(begin, begin + m_grain);
+            begin += m_grain;
+        }
+    }
+    this->process(begin, end);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Rethrow the first exception thrown by the function, if any
+ */
+template<typename Iterator, typename Function>
+void ParallelForLoop<Iterator, Function>::rethrow() const
+{
+    IT_REQUIRE(this->done());
+
+    if (m_exception)
+    {
+        std::rethrow_exception(m_exception);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Task entry point
+ *
+ * \param[in] context  Pointer to the ParallelForLoop
+ * \param[in] begin    The first index of the task
+ * \param[in] end      One past the last index of the task
+ */
+template<typename Iterator, typename Function>
+void ParallelForLoop<Iterator, Function>::execute(void* context,
+                                                  std::size_t begin,
+                                                  std::size_t end)
+{
+    static_cast<ParallelForLoop*>(context)->run(begin, end);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply the function to the elements of [\p begin, \p end)
+ *
+ * This is the only place where elements are visited; the loop is a plain
+ * iterator loop the compiler can optimize like a serial one.
+ *
+ * \param[in] begin  The first index
+ * \param[in] end    One past the last index
+ */
+template<typename Iterator, typename Function>
+void ParallelForLoop<Iterator, Function>::process(std::size_t begin,
+                                                  std::size_t end)
+{
+    if (!m_failed.load(std::memory_order_relaxed))
+    {
+        try
+        {
+            Iterator iter = m_first + static_cast<difference_type>(begin);
+            const Iterator last = m_first + static_cast<difference_type>(end);
+            for (; iter != last; ++iter)
+            {
+                m_function(*iter);
+            }
+        }
+        catch (...)
+        {
+            if (!m_failed.exchange(true))
+            {
+                m_exception = std::current_exception();
+            }
+        }
+    }
+
+    // Must be the last access to the loop: the caller may return once the
+    // count reaches zero
+    m_remaining.fetch_sub(end - begin, std::memory_order_acq_rel);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PARALLEL_DETAIL_PARALLELFORLOOP_HH
+//---------------------------------------------------------------------------//
+// end of src/parallel/detail/ParallelForLoop.hh
+//---------------------------------------------------------------------------//
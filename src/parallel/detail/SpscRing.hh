@@ -0,0 +1,235 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/detail/SpscRing.hh
+ * \brief  SpscRing class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PARALLEL_DETAIL_SPSCRING_HH
+#define ITERTOOLS_SRC_PARALLEL_DETAIL_SPSCRING_HH
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "core/DBC.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class SpscRing
+ * \brief A bounded, lock-free queue between one producer and one consumer
+ *
+ * The elements live in a power-of-two array of slots indexed by two
+ * ever-increasing counters: the producer owns the tail and the consumer owns
+ * the head.  Each counter sits on its own cache line together with the
+ * owner's cached copy of the other counter, so the line of the other thread
+ * is only read when the cached copy says the ring is full (producer) or
+ * empty (consumer).  In steady state a burst of elements therefore costs one
+ * cache-line transfer in each direction rather than one per element.
+ *
+ * tryEmplace() may only be called by the producer thread, and front() and
+ * pop() only by the consumer thread.
+ *
+ * \tparam T  The element type
+ */
+//===========================================================================//
+
+template<typename T>
+class SpscRing
+{
+  public:
+    //! Public type aliases
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //! Size of the lines on which the counters are padded
+    static constexpr size_type cache_line_size = 64;
+
+  public:
+    // Construct with the minimum number of elements held
+    inline explicit SpscRing(size_type capacity);
+
+    // Destroy the elements left in the ring
+    inline ~SpscRing();
+
+    // Disable copy and move
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    //! Return the number of elements the ring holds
+    size_type capacity() const { return m_mask + 1; }
+
+    // >>> PRODUCER
+    // Construct an element at the tail; return false if the ring is full
+    template<typename... Args>
+    inline bool tryEmplace(Args&&... args);
+
+    // >>> CONSUMER
+    // Return the element at the head, or nullptr if the ring is empty
+    inline T* front();
+
+    // Destroy the element at the head
+    inline void pop();
+
+  private:
+    //! Uninitialized storage for one element
+    struct Slot
+    {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    //! The counter written by the producer
+    struct alignas(cache_line_size) ProducerLine
+    {
+        std::atomic<size_type> tail{0};
+        size_type cached_head = 0;
+    };
+
+    //! The counter written by the consumer
+    struct alignas(cache_line_size) ConsumerLine
+    {
+        std::atomic<size_type> head{0};
+        size_type cached_tail = 0;
+    };
+
+    // Return the element stored in the slot of a counter value
+    T* slot(size_type index) const
+    {
+        return std::launder(
+            reinterpret_cast<T*>(m_slots[index & m_mask].bytes));
+    }
+
+    // >>> DATA
+    std::unique_ptr<Slot[]> m_slots;
+    size_type m_mask;
+    ProducerLine m_producer;
+    ConsumerLine m_consumer;
+};
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Construct with the minimum number of elements held
+ *
+ * \param[in] capacity  The minimum capacity (nonzero), rounded up to a power
+ *                      of two
+ */
+template<typename T>
+SpscRing<T>::SpscRing(size_type capacity)
+{
+    IT_REQUIRE(capacity > 0);
+
+    size_type size = 1;
+    while (size < capacity)
+    {
+        size *= 2;
+    }
+    m_slots = std::make_unique<Slot[]>(size);
+    m_mask = size - 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Destroy the elements left in the ring
+ *
+ * Neither thread may access the ring any more.
+ */
+template<typename T>
+SpscRing<T>::~SpscRing()
+{
+    const size_type tail = m_producer.tail.load(std::memory_order_acquire);
+    for (size_type i = m_consumer.head.load(std::memory_order_relaxed);
+         i != tail;
+         ++i)
+    {
+        this->slot(i)->~T();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct an element at the tail of the ring
+ *
+ * The arguments are only used when there is room, so a failed call may be
+ * retried with the same arguments.
+ *
+ * \param[in] args  The arguments of the element constructor
+ *
+ * \return Whether the element was added
+ */
+template<typename T>
+template<typename... Args>
+bool SpscRing<T>::tryEmplace(Args&&... args)
+{
+    const size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+    if (tail - m_producer.cached_head > m_mask)
+    {
+        m_producer.cached_head
+            = m_consumer.head.load(std::memory_order_acquire);
+        if (tail - m_producer.cached_head > m_mask)
+        {
+            return false;
+        }
+    }
+
+    ::new (static_cast<void*>(m_slots[tail & m_mask].bytes))
+        T(std::forward<Args>(args)...);
+    m_producer.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the element at the head of the ring
+ *
+ * \return A pointer to the oldest element, valid until pop(), or nullptr if
+ *         the ring is empty
+ */
+template<typename T>
+T* SpscRing<T>::front()
+{
+    const size_type head = m_consumer.head.load(std::memory_order_relaxed);
+    if (head == m_consumer.cached_tail)
+    {
+        m_consumer.cached_tail
+            = m_producer.tail.load(std::memory_order_acquire);
+        if (head == m_consumer.cached_tail)
+        {
+            return nullptr;
+        }
+    }
+    return this->slot(head);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Destroy the element at the head of the ring
+ *
+ * The ring must not be empty, i.e., front() returned an element.
+ */
+template<typename T>
+void SpscRing<T>::pop()
+{
+    const size_type head = m_consumer.head.load(std::memory_order_relaxed);
+    IT_REQUIRE(head != m_consumer.cached_tail);
+
+    this->slot(head)->~T();
+    m_consumer.head.store(head + 1, std::memory_order_release);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PARALLEL_DETAIL_SPSCRING_HH
+//---------------------------------------------------------------------------//
+// end of src/parallel/detail/SpscRing.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,277 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/tests/tstParallelFor.cc
+ * \brief  Tests for parallelFor.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../ParallelFor.hh"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "enumerate/Enumerate.hh"
+#include "pipeline/Pipeline.hh"
+#include "range/NdRange.hh"
+#include "range/Range.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+class ParallelForTest : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Range)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    const long n = 100003;
+    std::vector<std::atomic<int>> visited(n);
+    itertools::parallelFor(pool, itertools::range(1L, n, 2L), [&](long i) {
+        visited[i].fetch_add(1);
+    });
+
+    for (long i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(i % 2, visited[i].load()) << "at index " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, TiledNdRange)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    const int ni = 123;
+    const int nj = 77;
+    std::vector<std::atomic<int>> visited(ni * nj);
+    itertools::parallelFor(
+        pool,
+        itertools::ndRange(ni, nj).tiled({16, 16}),
+        [&](auto idx) {
+            auto [i, j] = idx;
+            visited[i * nj + j].fetch_add(1);
+        },
+        5);
+
+    for (const auto& v : visited)
+    {
+        ASSERT_EQ(1, v.load());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Iterators)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    std::vector<double> values(5000, 1.5);
+    itertools::parallelFor(
+        pool, values.begin(), values.end(), [](double& v) { v *= 2; }, 7);
+
+    for (double v : values)
+    {
+        ASSERT_EQ(3.0, v);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Enumerate)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    // Every worker sees the global counts of its elements
+    std::vector<long> values(20011, -1);
+    itertools::parallelFor(
+        pool,
+        itertools::enumerate(values, 5L),
+        [](auto pair) {
+            auto [i, v] = pair;
+            v = i;
+        },
+        13);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(static_cast<long>(i) + 5, values[i]) << "at index " << i;
+    }
+
+    // Static partitions handed out by the caller
+    const auto parts = itertools::enumerate(values).split(GetParam());
+    itertools::parallelFor(pool, itertools::range(parts.size()), [&](auto p) {
+        for (auto [i, v] : parts[p])
+        {
+            v = -static_cast<long>(i);
+        }
+    });
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(-static_cast<long>(i), values[i]) << "at index " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Pipeline)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    // A transformed range keeps random access and is split like the range
+    const long n = 30011;
+    std::vector<std::atomic<int>> visited(2 * n);
+    itertools::parallelFor(
+        pool,
+        itertools::range(n) | itertools::transform([](long i) { return 2 * i; }),
+        [&](long j) { visited[j].fetch_add(1); });
+
+    for (long j = 0; j < 2 * n; ++j)
+    {
+        ASSERT_EQ(1 - j % 2, visited[j].load()) << "at index " << j;
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Irregular)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    // Work grows quadratically with the index
+    std::atomic<long> total{0};
+    itertools::parallelFor(
+        pool,
+        itertools::range(2000),
+        [&total](int i) {
+            long local = 0;
+            for (int j = 0; j < i * i / 64; ++j)
+            {
+                local += j % 3;
+            }
+            total += local;
+        },
+        1);
+
+    long expected = 0;
+    for (int i = 0; i < 2000; ++i)
+    {
+        for (int j = 0; j < i * i / 64; ++j)
+        {
+            expected += j % 3;
+        }
+    }
+    EXPECT_EQ(expected, total.load());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Nested)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    std::atomic<long> total{0};
+    itertools::parallelFor(pool, itertools::range(40), [&](int i) {
+        itertools::parallelFor(pool, itertools::range(50), [&](int j) {
+            total += i * 50 + j;
+        });
+    });
+    EXPECT_EQ(1999L * 2000 / 2, total.load());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Empty)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    int calls = 0;
+    itertools::parallelFor(pool, itertools::range(5, 5), [&calls](int) {
+        ++calls;
+    });
+    EXPECT_EQ(0, calls);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, Exception)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    auto throw_at = [](int i) {
+        if (i == 777)
+        {
+            throw std::runtime_error("index 777");
+        }
+    };
+    EXPECT_THROW(
+        itertools::parallelFor(pool, itertools::range(10000), throw_at, 16),
+        std::runtime_error);
+
+    // The pool remains usable
+    std::atomic<int> count{0};
+    itertools::parallelFor(pool, itertools::range(100), [&](int) { ++count; });
+    EXPECT_EQ(100, count.load());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelForTest, WorkIsShared)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    itertools::parallelFor(
+        pool,
+        itertools::range(200),
+        [&](int) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        },
+        1);
+    EXPECT_LE(threads.size(), GetParam());
+    if (GetParam() > 1)
+    {
+        EXPECT_LT(1, threads.size());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+INSTANTIATE_TEST_SUITE_P(Concurrency,
+                         ParallelForTest,
+                         ::testing::Values(1, 2, 4, 7));
+
+//---------------------------------------------------------------------------//
+
+TEST(ParallelForGlobalTest, GlobalPool)
+{
+    std::vector<int> values(1000, 1);
+    itertools::parallelFor(values, [](int& v) { v += 1; });
+    itertools::parallelFor(values.begin(), values.end(), [](int& v) { v *= 3; });
+
+    for (int v : values)
+    {
+        ASSERT_EQ(6, v);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/tests/tstParallelFor.cc
+//---------------------------------------------------------------------------//
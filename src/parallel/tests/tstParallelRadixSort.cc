@@ -0,0 +1,91 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/tests/tstParallelRadixSort.cc
+ * \brief  Tests for parallelRadixSort.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../ParallelRadixSort.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "zip/Zip.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+class ParallelRadixSortTest : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelRadixSortTest, MatchesSerial)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    // Enough elements per thread to sort in parallel, with many duplicates
+    const std::size_t n = 300007;
+    std::mt19937 engine(7);
+    std::vector<std::int32_t> keys(n);
+    std::vector<double> values(n);
+    std::vector<std::uint32_t> order(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        keys[i] = static_cast<std::int32_t>(engine() % 100000) - 50000;
+        values[i] = 0.25 * keys[i];
+        order[i] = static_cast<std::uint32_t>(i);
+    }
+    std::vector<std::int32_t> expected_keys = keys;
+    std::vector<std::uint32_t> expected_order = order;
+    itertools::radixSort(itertools::zip(expected_keys, expected_order));
+
+    itertools::parallelRadixSort(pool, itertools::zip(keys, values, order));
+    EXPECT_EQ(expected_keys, keys);
+    EXPECT_EQ(expected_order, order);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(0.25 * keys[i], values[i]) << "at index " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_P(ParallelRadixSortTest, FloatingPointKeys)
+{
+    itertools::ThreadPool pool(GetParam());
+
+    const std::size_t n = 200000;
+    std::mt19937_64 engine(11);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> keys(n);
+    for (double& key : keys)
+    {
+        key = dist(engine);
+    }
+    std::vector<double> expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    itertools::parallelRadixSort(pool, keys.begin(), keys.end());
+    EXPECT_EQ(expected, keys);
+}
+
+//---------------------------------------------------------------------------//
+
+INSTANTIATE_TEST_SUITE_P(Concurrency,
+                         ParallelRadixSortTest,
+                         ::testing::Values(1, 2, 4, 7));
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/tests/tstParallelRadixSort.cc
+//---------------------------------------------------------------------------//
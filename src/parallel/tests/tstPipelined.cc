@@ -0,0 +1,220 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/tests/tstPipelined.cc
+ * \brief  Tests for pipelined and SpscRing.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Pipelined.hh"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "pipeline/Batched.hh"
+#include "pipeline/Pipeline.hh"
+#include "range/Range.hh"
+#include "zip/Zip.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(SpscRingTest, SingleThread)
+{
+    itertools::detail::SpscRing<std::string> ring(3);
+    EXPECT_EQ(4u, ring.capacity());
+    EXPECT_EQ(nullptr, ring.front());
+
+    // Fill, drain partially and wrap around the slots
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.tryEmplace(std::to_string(i)));
+    }
+    std::string rejected = "4";
+    EXPECT_FALSE(ring.tryEmplace(std::move(rejected)));
+    EXPECT_EQ("4", rejected);
+
+    ASSERT_NE(nullptr, ring.front());
+    EXPECT_EQ("0", *ring.front());
+    ring.pop();
+    EXPECT_TRUE(ring.tryEmplace(std::move(rejected)));
+
+    std::string order;
+    while (std::string* value = ring.front())
+    {
+        order += *value;
+        ring.pop();
+    }
+    EXPECT_EQ("1234", order);
+
+    // Elements left in the ring are destroyed with it
+    auto shared = std::make_shared<int>(1);
+    {
+        itertools::detail::SpscRing<std::shared_ptr<int>> owners(2);
+        EXPECT_TRUE(owners.tryEmplace(shared));
+        EXPECT_EQ(2, shared.use_count());
+    }
+    EXPECT_EQ(1, shared.use_count());
+}
+
+//---------------------------------------------------------------------------//
+TEST(SpscRingTest, TwoThreads)
+{
+    const long n = 200000;
+    itertools::detail::SpscRing<long> ring(16);
+
+    std::thread producer([&ring] {
+        for (long i = 0; i < n; ++i)
+        {
+            while (!ring.tryEmplace(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    long expected = 0;
+    while (expected < n)
+    {
+        if (long* value = ring.front())
+        {
+            ASSERT_EQ(expected, *value);
+            ring.pop();
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_EQ(nullptr, ring.front());
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelinedTest, Order)
+{
+    const int n = 100000;
+    auto squares = itertools::range(n)
+                   | itertools::transform([](int i) { return 2 * i; });
+
+    auto p = itertools::pipelined(squares, 5);
+    EXPECT_EQ(8u, p.depth());
+
+    int expected = 0;
+    for (int value : p)
+    {
+        ASSERT_EQ(2 * expected, value);
+        ++expected;
+    }
+    EXPECT_EQ(n, expected);
+
+    // Empty sequences and a depth of one
+    std::vector<double> empty;
+    auto none = itertools::pipelined(empty, 1);
+    EXPECT_EQ(none.end(), none.begin());
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelinedTest, Containers)
+{
+    // Zipped elements are copied into the ring as tuples of values
+    std::vector<int> x{1, 2, 3, 4, 5};
+    std::vector<std::string> s{"a", "b", "c", "d", "e"};
+    std::string joined;
+    int total = 0;
+    for (auto& [xi, si] : itertools::pipelined(itertools::zip(x, s), 2))
+    {
+        total += xi;
+        joined += si;
+    }
+    EXPECT_EQ(15, total);
+    EXPECT_EQ("abcde", joined);
+
+    // Move-only elements are moved out of the ring
+    auto owners = itertools::range(4) | itertools::transform([](int i) {
+                      return std::make_unique<int>(i);
+                  });
+    std::vector<std::unique_ptr<int>> values;
+    for (auto& value : itertools::pipelined(owners, 2))
+    {
+        values.push_back(std::move(value));
+    }
+    ASSERT_EQ(4u, values.size());
+    EXPECT_EQ(3, *values[3]);
+
+    // Batches decoded ahead
+    std::vector<int> codes(10, 7);
+    auto decoded = itertools::batched(codes, 4)
+                   | itertools::transform([](auto batch) {
+                         return std::vector<int>(batch.begin(), batch.end());
+                     });
+    std::vector<std::size_t> sizes;
+    for (const auto& batch : itertools::pipelined(decoded, 2))
+    {
+        sizes.push_back(batch.size());
+    }
+    EXPECT_EQ((std::vector<std::size_t>{4, 4, 2}), sizes);
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelinedTest, EarlyExit)
+{
+    // Leaving the loop stops the producer at most a ring ahead
+    std::atomic<int> produced{0};
+    auto counted = itertools::range(1 << 30) | itertools::transform([&](int i) {
+                       produced.fetch_add(1);
+                       return i;
+                   });
+    int consumed = 0;
+    for (int value : itertools::pipelined(counted, 4))
+    {
+        if (value == 10)
+        {
+            break;
+        }
+        ++consumed;
+    }
+    EXPECT_EQ(10, consumed);
+    EXPECT_LE(produced.load(), 11 + 4 + 1);
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelinedTest, Exception)
+{
+    auto failing = itertools::range(100) | itertools::transform([](int i) {
+                       if (i == 50)
+                       {
+                           throw std::runtime_error("bad record");
+                       }
+                       return i;
+                   });
+
+    // The elements produced before the exception are consumed first
+    int consumed = 0;
+    auto p = itertools::pipelined(failing, 8);
+    EXPECT_THROW(
+        {
+            for (int value : p)
+            {
+                EXPECT_EQ(consumed, value);
+                ++consumed;
+            }
+        },
+        std::runtime_error);
+    EXPECT_EQ(50, consumed);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/tests/tstPipelined.cc
+//---------------------------------------------------------------------------//
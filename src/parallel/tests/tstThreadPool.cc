@@ -0,0 +1,91 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/parallel/tests/tstThreadPool.cc
+ * \brief  Tests for class ThreadPool.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../ThreadPool.hh"
+
+#include <atomic>
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+struct Counter
+{
+    std::atomic<std::size_t> sum{0};
+    std::atomic<std::size_t> calls{0};
+
+    static void execute(void* context, std::size_t begin, std::size_t end)
+    {
+        auto* self = static_cast<Counter*>(context);
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            self->sum += i;
+        }
+        ++self->calls;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ThreadPoolTest, Concurrency)
+{
+    itertools::ThreadPool pool(3);
+    EXPECT_EQ(3, pool.concurrency());
+    EXPECT_TRUE(pool.localQueueEmpty());
+    EXPECT_FALSE(pool.tryRunTask());
+
+    EXPECT_LE(1, itertools::ThreadPool::defaultConcurrency());
+    EXPECT_LE(1, itertools::ThreadPool::global().concurrency());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(ThreadPoolTest, SerialPool)
+{
+    // Without worker threads, queued tasks run only while waiting
+    itertools::ThreadPool pool(1);
+    Counter counter;
+
+    pool.push({&Counter::execute, &counter, 0, 10});
+    pool.push({&Counter::execute, &counter, 10, 20});
+    EXPECT_FALSE(pool.localQueueEmpty());
+    EXPECT_EQ(0, counter.calls.load());
+
+    pool.waitUntil([&counter] { return counter.calls.load() == 2; });
+    EXPECT_TRUE(pool.localQueueEmpty());
+    EXPECT_EQ(190, counter.sum.load());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(ThreadPoolTest, Workers)
+{
+    itertools::ThreadPool pool(4);
+    Counter counter;
+
+    constexpr std::size_t num_tasks = 1000;
+    for (std::size_t t = 0; t < num_tasks; ++t)
+    {
+        pool.push({&Counter::execute, &counter, t * 10, t * 10 + 10});
+    }
+    pool.waitUntil(
+        [&counter] { return counter.calls.load() == num_tasks; });
+
+    const std::size_t n = num_tasks * 10;
+    EXPECT_EQ(n * (n - 1) / 2, counter.sum.load());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/parallel/tests/tstThreadPool.cc
+//---------------------------------------------------------------------------//
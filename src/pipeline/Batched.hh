@@ -0,0 +1,348 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/Batched.hh
+ * \brief  Batch class and batched adaptor declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PIPELINE_BATCHED_HH
+#define ITERTOOLS_SRC_PIPELINE_BATCHED_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Pipeline.hh"
+#include "core/DBC.hh"
+#include "range/Range.hh"
+#include "zip/detail/ZipIterator.hh"
+#include "zip/detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class Batch
+ * \brief A contiguous run of elements of a sequence, viewed in place
+ *
+ * Batches are the elements of batched().  A batch is an iterator and a
+ * length: for a contiguous sequence the iterator is a pointer, so the batch
+ * is a span that can be handed to bulk interfaces through data() and size();
+ * for a zip of contiguous sequences it is a zip of pointers, whose
+ * <tt>begin().get<I>()</tt> is the pointer to the batch in sequence \c I.
+ *
+ * \tparam Iterator  A random-access iterator
+ *
+ * \example pipeline/tests/tstBatched.cc
+ */
+//===========================================================================//
+
+template<typename Iterator>
+class Batch
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    using size_type = std::size_t;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+    //@}
+
+  public:
+    //! Default constructor (empty batch)
+    Batch() = default;
+
+    //! Construct with the first element and the number of elements
+    Batch(Iterator first, size_type size) : m_begin(first), m_size(size) {}
+
+    //! Return beginning iterator
+    iterator begin() const { return m_begin; }
+
+    //! Return const beginning iterator
+    const_iterator cbegin() const { return m_begin; }
+
+    //! Return ending iterator
+    iterator end() const
+    {
+        return m_begin + static_cast<difference_type>(m_size);
+    }
+
+    //! Return const ending iterator
+    const_iterator cend() const { return this->end(); }
+
+    //! Return the number of elements
+    size_type size() const { return m_size; }
+
+    //! Return whether the batch is empty
+    bool empty() const { return m_size == 0; }
+
+    // Access the element at index i
+    inline reference operator[](size_type i) const;
+
+    // Return the pointer to the first element of a contiguous batch
+    inline Iterator data() const;
+
+  private:
+    // >>> DATA
+    Iterator m_begin{};
+    size_type m_size = 0;
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \struct BatchIteratorOf
+ * \brief The iterator type of the batches of a sequence
+ *
+ * Contiguous iterators become pointers and zips of contiguous iterators
+ * become zips of pointers; other random-access iterators are kept.
+ */
+template<typename Iterator, typename = void>
+struct BatchIteratorOf
+{
+    using type = Iterator;
+
+    //! Convert an iterator of the sequence
+    static type convert(const Iterator& iter) { return iter; }
+};
+
+template<typename Iterator>
+struct BatchIteratorOf<Iterator,
+                       std::enable_if_t<is_contiguous_iterator_v<Iterator>>>
+{
+    using type = std::remove_reference_t<
+        typename std::iterator_traits<Iterator>::reference>*;
+
+    //! Convert a dereferenceable iterator of the sequence
+    static type convert(const Iterator& iter)
+    {
+        return std::addressof(*iter);
+    }
+};
+
+template<typename... Iterators>
+struct BatchIteratorOf<
+    ZipIterator<Iterators...>,
+    std::enable_if_t<(is_contiguous_iterator_v<Iterators> && ...)>>
+{
+    using type = ZipIterator<typename BatchIteratorOf<Iterators>::type...>;
+
+    //! Convert a dereferenceable iterator of the sequence
+    static type convert(const ZipIterator<Iterators...>& iter)
+    {
+        return std::apply(
+            [](const auto&... iters) {
+                return type(BatchIteratorOf<Iterators>::convert(iters)...);
+            },
+            iter.getIters());
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * \class BatchSlicer
+ * \brief Returns batch i of a sequence of known length
+ */
+template<typename Iterator>
+class BatchSlicer
+{
+  public:
+    //! Default constructor
+    BatchSlicer() = default;
+
+    //! Construct with the first element, the length and the batch size
+    BatchSlicer(Iterator first, std::size_t length, std::size_t batch_size)
+        : m_first(first), m_length(length), m_batch_size(batch_size)
+    {
+    }
+
+    //! Return batch i, the last one holding the remaining elements
+    Batch<Iterator> operator()(std::size_t i) const
+    {
+        const std::size_t offset = i * m_batch_size;
+        return Batch<Iterator>(
+            m_first
+                + static_cast<
+                    typename std::iterator_traits<Iterator>::difference_type>(
+                    offset),
+            std::min(m_batch_size, m_length - offset));
+    }
+
+  private:
+    // >>> DATA
+    Iterator m_first{};
+    std::size_t m_length = 0;
+    std::size_t m_batch_size = 1;
+};
+
+//---------------------------------------------------------------------------//
+// Type of the batches of a sequence
+template<typename RangeType>
+using batched_range_t = transform_range_t<
+    Range<std::size_t>,
+    BatchSlicer<typename BatchIteratorOf<range_iterator_t<RangeType>>::type>>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * \struct BatchedClosure
+ * \brief A batched stage applied to a sequence by <tt>range | stage</tt>
+ */
+struct BatchedClosure;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Split a sequence into batches of batch_size elements and a tail batch
+template<typename RangeType>
+inline detail::batched_range_t<RangeType>
+batched(RangeType&& range, std::size_t batch_size);
+
+// Create a batched stage for operator|
+inline detail::BatchedClosure batched(std::size_t batch_size);
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+struct BatchedClosure
+{
+    //! Stores the number of elements in each batch
+    std::size_t batch_size;
+
+    //! Apply the stage to a sequence
+    template<typename RangeType>
+    friend batched_range_t<RangeType>
+    operator|(RangeType&& range, const BatchedClosure& closure)
+    {
+        return itertools::batched(std::forward<RangeType>(range),
+                                  closure.batch_size);
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//===========================================================================//
+// INLINE IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Access the element at index \p i
+ *
+ * \param[in] i  The index of the element in the batch
+ *
+ * \return The element
+ */
+template<typename Iterator>
+auto Batch<Iterator>::operator[](size_type i) const -> reference
+{
+    IT_REQUIRE(i < m_size);
+
+    return m_begin[static_cast<difference_type>(i)];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the pointer to the first element of a contiguous batch
+ *
+ * \return The pointer, valid for size() elements
+ */
+template<typename Iterator>
+Iterator Batch<Iterator>::data() const
+{
+    static_assert(std::is_pointer_v<Iterator>,
+                  "data() requires a batch of a contiguous sequence");
+
+    return m_begin;
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split a sequence into batches of \p batch_size elements
+ *
+ * The last batch holds the remaining elements when the length of the
+ * sequence is not a multiple of \p batch_size.  The batches refer to the
+ * elements in place (see Batch): nothing is copied, and the sequence must
+ * outlive the batches.
+ *
+ * The view of the batches has random access and a size, so it can be
+ * indexed, split and passed to parallelFor():
+ * \code
+ * for (auto batch : batched(records, 256))
+ * {
+ *     writer.write(batch.data(), batch.size());
+ * }
+ * \endcode
+ *
+ * \param[in] range       A random-access sequence, e.g., a container, a
+ *                        zip or an enumeration
+ * \param[in] batch_size  The number of elements in each batch (nonzero)
+ *
+ * \return A view of the batches
+ */
+template<typename RangeType>
+detail::batched_range_t<RangeType>
+batched(RangeType&& range, std::size_t batch_size)
+{
+    using Iterator_t = detail::range_iterator_t<RangeType>;
+    static_assert(std::is_same_v<Iterator_t, detail::range_sentinel_t<RangeType>>,
+                  "the sequence must end with an iterator");
+    static_assert(detail::is_random_access_range_v<RangeType>,
+                  "batched requires a random-access sequence");
+    IT_REQUIRE(batch_size > 0);
+
+    using std::begin;
+    using std::end;
+    using Convert_t = detail::BatchIteratorOf<Iterator_t>;
+
+    auto first = begin(range);
+    const auto length = static_cast<std::size_t>(end(range) - first);
+
+    // The first element is only dereferenced when it exists
+    typename Convert_t::type base{};
+    if (length > 0)
+    {
+        base = Convert_t::convert(first);
+    }
+
+    const std::size_t count
+        = length / batch_size + (length % batch_size != 0);
+    return itertools::transform(
+        itertools::range(count),
+        detail::BatchSlicer<typename Convert_t::type>(
+            base, length, batch_size));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create a batched stage for operator|
+ *
+ * \param[in] batch_size  The number of elements in each batch (nonzero)
+ *
+ * \return A stage applied by <tt>range | batched(batch_size)</tt>
+ */
+detail::BatchedClosure batched(std::size_t batch_size)
+{
+    return {batch_size};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PIPELINE_BATCHED_HH
+//---------------------------------------------------------------------------//
+// end of src/pipeline/Batched.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,553 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/Pipeline.hh
+ * \brief  PipelineRange class and lazy adaptor declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PIPELINE_PIPELINE_HH
+#define ITERTOOLS_SRC_PIPELINE_PIPELINE_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "core/DBC.hh"
+#include "detail/FilterIterator.hh"
+#include "detail/TakeWhileIterator.hh"
+#include "detail/TransformIterator.hh"
+#include "range/detail/RangePartitions.hh"
+#include "zip/detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class PipelineRange
+ * \brief A lazy view of a sequence through filter, transform and take-while
+ *        stages
+ *
+ * Pipeline ranges are created by filter(), transform() and takeWhile(),
+ * which compose with \c operator|:
+ * \code
+ * auto energies = range(n)
+ *                 | filter([&](int i) { return alive[i]; })
+ *                 | transform([&](int i) { return 0.5 * m[i] * v[i] * v[i]; })
+ *                 | takeWhile([](double e) { return e < cutoff; });
+ * for (double e : energies) { ... }
+ * \endcode
+ * Each stage is an iterator wrapping the iterator of the previous one, and
+ * the functions are stored by value and called directly, so the loop above is
+ * a single fused loop with no intermediate buffers and no type erasure.
+ *
+ * A transform keeps the category and the size of its sequence: a transformed
+ * Range, zip or enumerate range still has random access and can be indexed,
+ * sliced, split into partitions or passed to parallelFor().  A filter or a
+ * take-while produces a forward range of unknown size.
+ *
+ * Like zip(), the stages do not copy the sequences: they must outlive the
+ * pipeline, except for views such as Range whose iterators do not refer to
+ * them.
+ *
+ * \tparam Iterator  The iterator type of the last stage
+ * \tparam Sized     Whether the length of the view is known
+ *
+ * \example pipeline/tests/tstPipeline.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, bool Sized>
+class PipelineRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    using size_type = std::size_t;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+    using partitions_type = detail::RangePartitions<PipelineRange>;
+    //@}
+
+    //! Whether the length of the view is known
+    static constexpr bool is_sized = Sized;
+
+    //! Whether the view has random access
+    static constexpr bool is_random_access = std::is_base_of_v<
+        std::random_access_iterator_tag,
+        typename std::iterator_traits<Iterator>::iterator_category>;
+
+  public:
+    // Construct with the beginning and ending iterators and the length
+    inline PipelineRange(Iterator first, Iterator last, size_type size);
+
+    //! Return beginning iterator
+    iterator begin() const { return m_begin; }
+
+    //! Return const beginning iterator
+    const_iterator cbegin() const { return m_begin; }
+
+    //! Return ending iterator
+    iterator end() const { return m_end; }
+
+    //! Return const ending iterator
+    const_iterator cend() const { return m_end; }
+
+    // Return the number of elements (only when the length is known)
+    template<bool S = Sized, std::enable_if_t<S, bool> = true>
+    inline size_type size() const;
+
+    //! Return whether the view is empty
+    bool empty() const { return m_begin == m_end; }
+
+    // Access the element at index i
+    inline reference operator[](size_type i) const;
+
+    // >>> PARTITIONING
+    // Return the sub-range of length elements starting at index offset
+    inline PipelineRange slice(size_type offset, size_type length) const;
+
+    // Split into count balanced, contiguous sub-ranges
+    inline partitions_type split(size_type count) const;
+
+    // Split into at most count sub-ranges of at least min_grain elements
+    inline partitions_type split(size_type count, size_type min_grain) const;
+
+  private:
+    // >>> DATA
+    Iterator m_begin;
+    Iterator m_end;
+    size_type m_size;
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Stages waiting for their sequence, applied by operator|
+template<typename Predicate>
+struct FilterClosure;
+template<typename Function>
+struct TransformClosure;
+template<typename Predicate>
+struct TakeWhileClosure;
+
+//---------------------------------------------------------------------------//
+// Whether a sequence has random access
+template<typename Range>
+constexpr bool is_random_access_range_v = std::is_base_of_v<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<range_iterator_t<Range>>::iterator_category>;
+
+//---------------------------------------------------------------------------//
+// Types of the pipeline stages
+template<typename Range, typename Predicate>
+using filter_range_t = PipelineRange<
+    FilterIterator<range_iterator_t<Range>, std::decay_t<Predicate>>,
+    false>;
+
+template<typename Range, typename Function>
+using transform_range_t = PipelineRange<
+    TransformIterator<range_iterator_t<Range>, std::decay_t<Function>>,
+    is_sized_range_v<Range> || is_random_access_range_v<Range>>;
+
+template<typename Range, typename Predicate>
+using take_while_range_t = PipelineRange<
+    TakeWhileIterator<range_iterator_t<Range>, std::decay_t<Predicate>>,
+    false>;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Select the elements of a sequence satisfying a predicate
+template<typename Range, typename Predicate>
+inline detail::filter_range_t<Range, Predicate>
+filter(Range&& range, Predicate&& predicate);
+
+// Create a filter stage for operator|
+template<typename Predicate>
+inline detail::FilterClosure<std::decay_t<Predicate>>
+filter(Predicate&& predicate);
+
+// Apply a function to the elements of a sequence
+template<typename Range, typename Function>
+inline detail::transform_range_t<Range, Function>
+transform(Range&& range, Function&& function);
+
+// Create a transform stage for operator|
+template<typename Function>
+inline detail::TransformClosure<std::decay_t<Function>>
+transform(Function&& function);
+
+// Select the leading elements of a sequence satisfying a predicate
+template<typename Range, typename Predicate>
+inline detail::take_while_range_t<Range, Predicate>
+takeWhile(Range&& range, Predicate&& predicate);
+
+// Create a take-while stage for operator|
+template<typename Predicate>
+inline detail::TakeWhileClosure<std::decay_t<Predicate>>
+takeWhile(Predicate&& predicate);
+
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \struct FilterClosure
+ * \brief A filter stage applied to a sequence by <tt>range | stage</tt>
+ */
+//===========================================================================//
+
+template<typename Predicate>
+struct FilterClosure
+{
+    //! Stores the predicate
+    Predicate predicate;
+
+    //! Apply the stage to a sequence
+    template<typename Range>
+    friend filter_range_t<Range, Predicate>
+    operator|(Range&& range, const FilterClosure& closure)
+    {
+        return itertools::filter(std::forward<Range>(range),
+                                 closure.predicate);
+    }
+};
+
+//===========================================================================//
+/*!
+ * \struct TransformClosure
+ * \brief A transform stage applied to a sequence by <tt>range | stage</tt>
+ */
+//===========================================================================//
+
+template<typename Function>
+struct TransformClosure
+{
+    //! Stores the function
+    Function function;
+
+    //! Apply the stage to a sequence
+    template<typename Range>
+    friend transform_range_t<Range, Function>
+    operator|(Range&& range, const TransformClosure& closure)
+    {
+        return itertools::transform(std::forward<Range>(range),
+                                    closure.function);
+    }
+};
+
+//===========================================================================//
+/*!
+ * \struct TakeWhileClosure
+ * \brief A take-while stage applied to a sequence by <tt>range | stage</tt>
+ */
+//===========================================================================//
+
+template<typename Predicate>
+struct TakeWhileClosure
+{
+    //! Stores the predicate
+    Predicate predicate;
+
+    //! Apply the stage to a sequence
+    template<typename Range>
+    friend take_while_range_t<Range, Predicate>
+    operator|(Range&& range, const TakeWhileClosure& closure)
+    {
+        return itertools::takeWhile(std::forward<Range>(range),
+                                    closure.predicate);
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//===========================================================================//
+// INLINE IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Construct with the beginning and ending iterators and the length
+ *
+ * \param[in] first  The beginning iterator
+ * \param[in] last   The ending iterator
+ * \param[in] size   The number of elements (ignored unless sized)
+ */
+template<typename Iterator, bool Sized>
+PipelineRange<Iterator, Sized>::PipelineRange(Iterator first,
+                                              Iterator last,
+                                              size_type size)
+    : m_begin(std::move(first)), m_end(std::move(last)), m_size(size)
+{
+    /* * */
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the number of elements
+ *
+ * Only declared when the length of the view is known, i.e., when every
+ * stage is a transform of a sized or random-access sequence, so that
+ * std::size and the sized-range traits see the others as unsized.
+ *
+ * \return The number of elements
+ */
+template<typename Iterator, bool Sized>
+template<bool S, std::enable_if_t<S, bool>>
+auto PipelineRange<Iterator, Sized>::size() const -> size_type
+{
+    return m_size;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Access the element at index \p i
+ *
+ * \param[in] i  The index of the element
+ *
+ * \return The element, as produced by the last stage
+ */
+template<typename Iterator, bool Sized>
+auto PipelineRange<Iterator, Sized>::operator[](size_type i) const
+    -> reference
+{
+    static_assert(is_random_access, "indexing requires random access");
+
+    return m_begin[static_cast<difference_type>(i)];
+}
+
+//---------------------------------------------------------------------------//
+// PARTITIONING
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the sub-range of \p length elements starting at \p offset
+ *
+ * \param[in] offset  The index of the first element of the sub-range
+ * \param[in] length  The number of elements of the sub-range
+ *
+ * \return The sub-range, applying the same stages
+ */
+template<typename Iterator, bool Sized>
+auto PipelineRange<Iterator, Sized>::slice(size_type offset,
+                                           size_type length) const
+    -> PipelineRange
+{
+    static_assert(is_random_access && Sized,
+                  "slicing requires random access");
+    IT_REQUIRE(offset <= m_size);
+    IT_REQUIRE(length <= m_size - offset);
+
+    const Iterator first = m_begin + static_cast<difference_type>(offset);
+    return PipelineRange(
+        first, first + static_cast<difference_type>(length), length);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the view into \p count balanced, contiguous sub-ranges
+ *
+ * \param[in] count  The number of partitions (nonzero)
+ *
+ * \return A view of the partitions
+ */
+template<typename Iterator, bool Sized>
+auto PipelineRange<Iterator, Sized>::split(size_type count) const
+    -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+
+    return partitions_type(*this, count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the view into at most \p count balanced sub-ranges holding
+ *        at least \p min_grain elements each
+ *
+ * \param[in] count      The maximum number of partitions (nonzero)
+ * \param[in] min_grain  The minimum number of elements in each partition
+ *
+ * \return A view of the partitions
+ */
+template<typename Iterator, bool Sized>
+auto PipelineRange<Iterator, Sized>::split(size_type count,
+                                           size_type min_grain) const
+    -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+    IT_REQUIRE(min_grain > 0);
+
+    const size_type max_count = std::max<size_type>(this->size() / min_grain, 1);
+    return partitions_type(*this, std::min(count, max_count));
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Select the elements of a sequence satisfying a predicate
+ *
+ * The predicate is called once per element of the sequence as the view is
+ * traversed, starting with the search for the first selected element when
+ * the view is created.
+ *
+ * \param[in] range      The sequence, which must end with an iterator
+ * \param[in] predicate  The predicate selecting the elements
+ *
+ * \return A forward view of the selected elements
+ */
+template<typename Range, typename Predicate>
+detail::filter_range_t<Range, Predicate>
+filter(Range&& range, Predicate&& predicate)
+{
+    static_assert(std::is_same_v<detail::range_iterator_t<Range>,
+                                 detail::range_sentinel_t<Range>>,
+                  "the sequence must end with an iterator");
+
+    using std::begin;
+    using std::end;
+    using Result_t = detail::filter_range_t<Range, Predicate>;
+    using Iterator_t = typename Result_t::iterator;
+
+    auto first = begin(range);
+    auto last = end(range);
+    return Result_t(Iterator_t(first, last, predicate),
+                    Iterator_t(last, predicate),
+                    0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create a filter stage for operator|
+ *
+ * \param[in] predicate  The predicate selecting the elements
+ *
+ * \return A stage applied by <tt>range | filter(predicate)</tt>
+ */
+template<typename Predicate>
+detail::FilterClosure<std::decay_t<Predicate>> filter(Predicate&& predicate)
+{
+    return {std::forward<Predicate>(predicate)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply a function to the elements of a sequence
+ *
+ * The function is called each time an element is dereferenced.  The view
+ * has the category of the sequence, and its size when the sequence is sized
+ * or has random access.
+ *
+ * \param[in] range     The sequence, which must end with an iterator
+ * \param[in] function  The function applied to the elements
+ *
+ * \return A view of the results of the function
+ */
+template<typename Range, typename Function>
+detail::transform_range_t<Range, Function>
+transform(Range&& range, Function&& function)
+{
+    static_assert(std::is_same_v<detail::range_iterator_t<Range>,
+                                 detail::range_sentinel_t<Range>>,
+                  "the sequence must end with an iterator");
+
+    using std::begin;
+    using std::end;
+    using Result_t = detail::transform_range_t<Range, Function>;
+    using Iterator_t = typename Result_t::iterator;
+
+    auto first = begin(range);
+    auto last = end(range);
+
+    std::size_t length = 0;
+    if constexpr (detail::is_sized_range_v<Range>)
+    {
+        using std::size;
+        length = static_cast<std::size_t>(size(range));
+    }
+    else if constexpr (detail::is_random_access_range_v<Range>)
+    {
+        length = static_cast<std::size_t>(last - first);
+    }
+    return Result_t(Iterator_t(first, function),
+                    Iterator_t(last, function),
+                    length);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create a transform stage for operator|
+ *
+ * \param[in] function  The function applied to the elements
+ *
+ * \return A stage applied by <tt>range | transform(function)</tt>
+ */
+template<typename Function>
+detail::TransformClosure<std::decay_t<Function>>
+transform(Function&& function)
+{
+    return {std::forward<Function>(function)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Select the leading elements of a sequence satisfying a predicate
+ *
+ * The view ends at the first element that fails the predicate; the
+ * predicate is called once per element, as the view is traversed.
+ *
+ * \param[in] range      The sequence, which must end with an iterator
+ * \param[in] predicate  The predicate selecting the elements
+ *
+ * \return A forward view of the leading elements
+ */
+template<typename Range, typename Predicate>
+detail::take_while_range_t<Range, Predicate>
+takeWhile(Range&& range, Predicate&& predicate)
+{
+    static_assert(std::is_same_v<detail::range_iterator_t<Range>,
+                                 detail::range_sentinel_t<Range>>,
+                  "the sequence must end with an iterator");
+
+    using std::begin;
+    using std::end;
+    using Result_t = detail::take_while_range_t<Range, Predicate>;
+    using Iterator_t = typename Result_t::iterator;
+
+    auto first = begin(range);
+    auto last = end(range);
+    return Result_t(Iterator_t(first, last, predicate),
+                    Iterator_t(last, predicate),
+                    0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create a take-while stage for operator|
+ *
+ * \param[in] predicate  The predicate selecting the elements
+ *
+ * \return A stage applied by <tt>range | takeWhile(predicate)</tt>
+ */
+template<typename Predicate>
+detail::TakeWhileClosure<std::decay_t<Predicate>>
+takeWhile(Predicate&& predicate)
+{
+    return {std::forward<Predicate>(predicate)};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PIPELINE_PIPELINE_HH
+//---------------------------------------------------------------------------//
+// end of src/pipeline/Pipeline.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,170 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/benchmarks/bchBatched.cc
+ * \brief  Benchmarks for batched.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Batched.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+#include "zip/Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+// Bytes loaded and stored per element written
+constexpr std::int64_t bytes_per_element = 2 * sizeof(double);
+
+// Small enough that the arrays stay in the second-level cache
+constexpr std::size_t num_elements = 16384;
+
+//---------------------------------------------------------------------------//
+// A shared writer paying a lock per call, as a bulk interface would
+class Writer
+{
+  public:
+    Writer() : m_out(num_elements) {}
+
+    void write(const double* data, std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pos + count > m_out.size())
+        {
+            m_pos = 0;
+        }
+        std::memcpy(m_out.data() + m_pos, data, count * sizeof(double));
+        m_pos += count;
+        benchmark::ClobberMemory();
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::vector<double> m_out;
+    std::size_t m_pos = 0;
+};
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Hand-written loop over the batch offsets
+void BM_RawBatches(benchmark::State& state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    std::vector<double> x(num_elements, 1.0);
+    Writer writer;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); i += batch_size)
+        {
+            writer.write(x.data() + i, std::min(batch_size, x.size() - i));
+        }
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_RawBatches)->Arg(16)->Arg(256)->Arg(4096);
+
+//---------------------------------------------------------------------------//
+// Batches viewed in place by batched
+void BM_BatchedSpans(benchmark::State& state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    std::vector<double> x(num_elements, 1.0);
+    Writer writer;
+    for (auto _ : state)
+    {
+        for (auto batch : itertools::batched(x, batch_size))
+        {
+            writer.write(batch.data(), batch.size());
+        }
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_BatchedSpans)->Arg(16)->Arg(256)->Arg(4096);
+
+//---------------------------------------------------------------------------//
+// Batches gathered into a staging vector before each call
+void BM_StagingCopy(benchmark::State& state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    std::vector<double> x(num_elements, 1.0);
+    std::vector<double> staging;
+    staging.reserve(batch_size);
+    Writer writer;
+    for (auto _ : state)
+    {
+        for (double xi : x)
+        {
+            staging.push_back(xi);
+            if (staging.size() == batch_size)
+            {
+                writer.write(staging.data(), staging.size());
+                staging.clear();
+            }
+        }
+        if (!staging.empty())
+        {
+            writer.write(staging.data(), staging.size());
+            staging.clear();
+        }
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_StagingCopy)->Arg(16)->Arg(256)->Arg(4096);
+
+//---------------------------------------------------------------------------//
+// One call per element, without batching
+void BM_ElementWise(benchmark::State& state)
+{
+    std::vector<double> x(num_elements, 1.0);
+    Writer writer;
+    for (auto _ : state)
+    {
+        for (const double& xi : x)
+        {
+            writer.write(&xi, 1);
+        }
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_ElementWise);
+
+//---------------------------------------------------------------------------//
+// Batches of a zip, written stream by stream from the sub-zip pointers
+void BM_BatchedZip(benchmark::State& state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    std::vector<double> x(num_elements / 2, 1.0), y(num_elements / 2, 2.0);
+    Writer writer;
+    for (auto _ : state)
+    {
+        for (auto batch : itertools::zip(x, y) | itertools::batched(batch_size))
+        {
+            auto first = batch.begin();
+            writer.write(first.get<0>(), batch.size());
+            writer.write(first.get<1>(), batch.size());
+        }
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_BatchedZip)->Arg(16)->Arg(256)->Arg(4096);
+
+//---------------------------------------------------------------------------//
+// end of src/pipeline/benchmarks/bchBatched.cc
+//---------------------------------------------------------------------------//
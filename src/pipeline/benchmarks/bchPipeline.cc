@@ -0,0 +1,135 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/benchmarks/bchPipeline.cc
+ * \brief  Benchmarks for the filter and transform pipelines.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Pipeline.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+#include "range/Range.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+// Bytes loaded per element by the kernel: a flag, a mass and a velocity
+constexpr std::int64_t bytes_per_element = sizeof(char) + 2 * sizeof(double);
+
+// Small enough that the arrays stay in the second-level cache
+constexpr std::size_t num_elements = 16384;
+
+//---------------------------------------------------------------------------//
+// Particles with every third one dead
+struct Particles
+{
+    std::vector<char> alive;
+    std::vector<double> m;
+    std::vector<double> v;
+
+    Particles() : alive(num_elements), m(num_elements), v(num_elements)
+    {
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            alive[i] = (i % 3 != 0);
+            m[i] = 1.0 + static_cast<double>(i % 7);
+            v[i] = 0.5 * static_cast<double>(i % 5);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Hand-written loop summing the kinetic energy of the living particles
+void BM_RawLoop(benchmark::State& state)
+{
+    const Particles p;
+    for (auto _ : state)
+    {
+        double total = 0.0;
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            if (p.alive[i])
+            {
+                total += 0.5 * p.m[i] * p.v[i] * p.v[i];
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_RawLoop);
+
+//---------------------------------------------------------------------------//
+// The same loop written as a pipeline, fused by the compiler
+void BM_FusedPipeline(benchmark::State& state)
+{
+    const Particles p;
+    for (auto _ : state)
+    {
+        double total = 0.0;
+        for (double e :
+             itertools::range(num_elements)
+                 | itertools::filter([&p](std::size_t i) { return p.alive[i]; })
+                 | itertools::transform([&p](std::size_t i) {
+                       return 0.5 * p.m[i] * p.v[i] * p.v[i];
+                   }))
+        {
+            total += e;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_FusedPipeline);
+
+//---------------------------------------------------------------------------//
+// One pass per stage, storing the intermediate results in buffers
+void BM_BufferedStages(benchmark::State& state)
+{
+    const Particles p;
+    std::vector<std::size_t> selected;
+    std::vector<double> energies;
+    selected.reserve(num_elements);
+    energies.reserve(num_elements);
+    for (auto _ : state)
+    {
+        selected.clear();
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            if (p.alive[i])
+            {
+                selected.push_back(i);
+            }
+        }
+        energies.clear();
+        for (std::size_t i : selected)
+        {
+            energies.push_back(0.5 * p.m[i] * p.v[i] * p.v[i]);
+        }
+        double total = 0.0;
+        for (double e : energies)
+        {
+            total += e;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_BufferedStages);
+
+//---------------------------------------------------------------------------//
+// end of src/pipeline/benchmarks/bchPipeline.cc
+//---------------------------------------------------------------------------//
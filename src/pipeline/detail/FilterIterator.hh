@@ -0,0 +1,185 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/detail/FilterIterator.hh
+ * \brief  FilterIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PIPELINE_DETAIL_FILTERITERATOR_HH
+#define ITERTOOLS_SRC_PIPELINE_DETAIL_FILTERITERATOR_HH
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "FunctionBox.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class FilterIterator
+ * \brief Visits the elements of a sequence that satisfy a predicate
+ *
+ * The iterator stores the end of the sequence and, when incremented, skips
+ * ahead to the next element satisfying the predicate (or to the end).  The
+ * positions of the selected elements are not known in advance, so the
+ * iterator is at most a forward iterator.
+ *
+ * The first selected element is found lazily, when the iterator is first
+ * dereferenced, compared or incremented, rather than on construction, so
+ * constructing the view (or its ending iterator) never reads an element.
+ *
+ * \example pipeline/tests/tstPipeline.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, typename Predicate>
+class FilterIterator
+{
+  public:
+    //! Public type aliases
+    using This = FilterIterator<Iterator, Predicate>;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using pointer = void;
+    using iterator_category = std::conditional_t<
+        std::is_base_of_v<
+            std::forward_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>,
+        std::forward_iterator_tag,
+        std::input_iterator_tag>;
+
+  public:
+    // Default constructor
+    FilterIterator() = default;
+
+    //! Construct at the first selected element of [iter, last)
+    FilterIterator(Iterator iter, Iterator last, Predicate predicate)
+        : m_iter(std::move(iter))
+        , m_last(std::move(last))
+        , m_predicate(std::move(predicate))
+    {
+    }
+
+    //! Construct at the end of the sequence
+    FilterIterator(Iterator last, Predicate predicate)
+        : m_iter(last)
+        , m_last(std::move(last))
+        , m_predicate(std::move(predicate))
+        , m_satisfied(true)
+    {
+    }
+
+    // >>> INCREMENT
+    //! Pre-increment to the next selected element
+    This& operator++()
+    {
+        this->satisfy();
+        ++m_iter;
+        m_satisfied = false;
+        return *this;
+    }
+
+    //! Post-increment to the next selected element
+    This operator++(int)
+    {
+        This copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    // >>> DEREFERENCE
+    //! Dereference the current element
+    reference operator*() const
+    {
+        this->satisfy();
+        return *m_iter;
+    }
+
+    // >>> ACCESSORS
+    //! Return the underlying iterator, at the current selected element
+    const Iterator& base() const
+    {
+        this->satisfy();
+        return m_iter;
+    }
+
+  private:
+    // Skip the elements that do not satisfy the predicate
+    void satisfy() const
+    {
+        if (!m_satisfied)
+        {
+            m_satisfied = true;
+            if (m_iter != m_last && !m_predicate(*m_iter))
+            {
+                do
+                {
+                    ++m_iter;
+                } while (m_iter != m_last && !m_predicate(*m_iter));
+            }
+        }
+    }
+
+    // >>> DATA
+    //! Stores the underlying iterator, advanced by satisfy()
+    mutable Iterator m_iter{};
+
+    //! Stores the end of the sequence
+    Iterator m_last{};
+
+    //! Stores the predicate
+    FunctionBox<Predicate> m_predicate;
+
+    //! Whether the current position satisfies the predicate (or is the end)
+    mutable bool m_satisfied = false;
+};
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Equality operator
+ *
+ * \param[in] iter1  The first filter iterator
+ * \param[in] iter2  The second filter iterator
+ *
+ * \return True if the underlying iterators are equal
+ */
+template<typename Iterator, typename Predicate>
+inline bool operator==(const FilterIterator<Iterator, Predicate>& iter1,
+                       const FilterIterator<Iterator, Predicate>& iter2)
+{
+    return iter1.base() == iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inequality operator
+ *
+ * \param[in] iter1  The first filter iterator
+ * \param[in] iter2  The second filter iterator
+ *
+ * \return True if the underlying iterators differ
+ */
+template<typename Iterator, typename Predicate>
+inline bool operator!=(const FilterIterator<Iterator, Predicate>& iter1,
+                       const FilterIterator<Iterator, Predicate>& iter2)
+{
+    return iter1.base() != iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PIPELINE_DETAIL_FILTERITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/pipeline/detail/FilterIterator.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,136 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/detail/FunctionBox.hh
+ * \brief  FunctionBox class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PIPELINE_DETAIL_FUNCTIONBOX_HH
+#define ITERTOOLS_SRC_PIPELINE_DETAIL_FUNCTIONBOX_HH
+
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class FunctionBox
+ * \brief Stores a function object by value in an assignable wrapper
+ *
+ * Lambdas are neither default constructible nor assignable in C++17, so an
+ * iterator storing one directly could not be default constructed or assigned
+ * as the iterator requirements demand.  The box stores the function in a
+ * \c std::optional and implements assignment by re-constructing it.  The
+ * function is called directly, without type erasure, so it is inlined into
+ * the loop.
+ *
+ * Functions that are already default constructible and assignable are stored
+ * unwrapped.
+ */
+//===========================================================================//
+
+template<typename Function, typename = void>
+class FunctionBox
+{
+  public:
+    //! Default constructor (the box is empty)
+    FunctionBox() = default;
+
+    //! Construct with the function
+    explicit FunctionBox(Function function) : m_function(std::move(function))
+    {
+    }
+
+    //! Copy constructor
+    FunctionBox(const FunctionBox&) = default;
+
+    //! Move constructor
+    FunctionBox(FunctionBox&&) = default;
+
+    //! Copy assignment
+    FunctionBox& operator=(const FunctionBox& other)
+    {
+        if (this != &other)
+        {
+            this->assign(other.m_function);
+        }
+        return *this;
+    }
+
+    //! Move assignment
+    FunctionBox& operator=(FunctionBox&& other)
+    {
+        if (this != &other)
+        {
+            this->assign(std::move(other.m_function));
+        }
+        return *this;
+    }
+
+    //! Call the function
+    template<typename... Args>
+    decltype(auto) operator()(Args&&... args) const
+    {
+        return std::invoke(*m_function, std::forward<Args>(args)...);
+    }
+
+  private:
+    // Re-construct the function from another box
+    template<typename Optional>
+    void assign(Optional&& other)
+    {
+        if (other)
+        {
+            m_function.emplace(*std::forward<Optional>(other));
+        }
+        else
+        {
+            m_function.reset();
+        }
+    }
+
+    // >>> DATA
+    std::optional<Function> m_function;
+};
+
+template<typename Function>
+class FunctionBox<
+    Function,
+    std::enable_if_t<std::is_default_constructible_v<Function>
+                     && std::is_copy_assignable_v<Function>>>
+{
+  public:
+    //! Default constructor
+    FunctionBox() = default;
+
+    //! Construct with the function
+    explicit FunctionBox(Function function) : m_function(std::move(function))
+    {
+    }
+
+    //! Call the function
+    template<typename... Args>
+    decltype(auto) operator()(Args&&... args) const
+    {
+        return std::invoke(m_function, std::forward<Args>(args)...);
+    }
+
+  private:
+    // >>> DATA
+    Function m_function{};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PIPELINE_DETAIL_FUNCTIONBOX_HH
+//---------------------------------------------------------------------------//
+// end of src/pipeline/detail/FunctionBox.hh
+//---------------------------------------------------------------------------//
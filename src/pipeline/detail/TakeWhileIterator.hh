@@ -0,0 +1,183 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/detail/TakeWhileIterator.hh
+ * \brief  TakeWhileIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PIPELINE_DETAIL_TAKEWHILEITERATOR_HH
+#define ITERTOOLS_SRC_PIPELINE_DETAIL_TAKEWHILEITERATOR_HH
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "FunctionBox.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class TakeWhileIterator
+ * \brief Visits the leading elements of a sequence satisfying a predicate
+ *
+ * The iterator stores the end of the sequence and jumps to it as soon as it
+ * reaches an element that does not satisfy the predicate, so the view ends
+ * at an ordinary iterator of the same type and the loop over it tests a
+ * single position per iteration.  Where the view ends is not known in
+ * advance, so the iterator is at most a forward iterator.
+ *
+ * The predicate is evaluated lazily, when a position is first dereferenced or
+ * compared, rather than on construction or increment.  Constructing the view
+ * (or its ending iterator) thus never reads an element, and a position is
+ * only read once the loop has compared it with the end.
+ *
+ * \example pipeline/tests/tstPipeline.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, typename Predicate>
+class TakeWhileIterator
+{
+  public:
+    //! Public type aliases
+    using This = TakeWhileIterator<Iterator, Predicate>;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using pointer = void;
+    using iterator_category = std::conditional_t<
+        std::is_base_of_v<
+            std::forward_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>,
+        std::forward_iterator_tag,
+        std::input_iterator_tag>;
+
+  public:
+    // Default constructor
+    TakeWhileIterator() = default;
+
+    //! Construct at iter, or at last if *iter does not satisfy the predicate
+    TakeWhileIterator(Iterator iter, Iterator last, Predicate predicate)
+        : m_iter(std::move(iter))
+        , m_last(std::move(last))
+        , m_predicate(std::move(predicate))
+    {
+    }
+
+    //! Construct at the end of the sequence
+    TakeWhileIterator(Iterator last, Predicate predicate)
+        : m_iter(last)
+        , m_last(std::move(last))
+        , m_predicate(std::move(predicate))
+        , m_checked(true)
+    {
+    }
+
+    // >>> INCREMENT
+    //! Pre-increment, ending at the first element failing the predicate
+    This& operator++()
+    {
+        ++m_iter;
+        m_checked = false;
+        return *this;
+    }
+
+    //! Post-increment, ending at the first element failing the predicate
+    This operator++(int)
+    {
+        This copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    // >>> DEREFERENCE
+    //! Dereference the current element
+    reference operator*() const
+    {
+        this->check();
+        return *m_iter;
+    }
+
+    // >>> ACCESSORS
+    //! Return the underlying iterator, at the end past the leading elements
+    const Iterator& base() const
+    {
+        this->check();
+        return m_iter;
+    }
+
+  private:
+    // Jump to the end if the current element fails the predicate
+    void check() const
+    {
+        if (!m_checked)
+        {
+            m_checked = true;
+            if (m_iter != m_last && !m_predicate(*m_iter))
+            {
+                m_iter = m_last;
+            }
+        }
+    }
+
+    // >>> DATA
+    //! Stores the underlying iterator, moved to the end by check()
+    mutable Iterator m_iter{};
+
+    //! Stores the end of the sequence
+    Iterator m_last{};
+
+    //! Stores the predicate
+    FunctionBox<Predicate> m_predicate;
+
+    //! Whether the predicate was evaluated at the current position
+    mutable bool m_checked = false;
+};
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Equality operator
+ *
+ * \param[in] iter1  The first take-while iterator
+ * \param[in] iter2  The second take-while iterator
+ *
+ * \return True if the underlying iterators are equal
+ */
+template<typename Iterator, typename Predicate>
+inline bool operator==(const TakeWhileIterator<Iterator, Predicate>& iter1,
+                       const TakeWhileIterator<Iterator, Predicate>& iter2)
+{
+    return iter1.base() == iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inequality operator
+ *
+ * \param[in] iter1  The first take-while iterator
+ * \param[in] iter2  The second take-while iterator
+ *
+ * \return True if the underlying iterators differ
+ */
+template<typename Iterator, typename Predicate>
+inline bool operator!=(const TakeWhileIterator<Iterator, Predicate>& iter1,
+                       const TakeWhileIterator<Iterator, Predicate>& iter2)
+{
+    return iter1.base() != iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PIPELINE_DETAIL_TAKEWHILEITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/pipeline/detail/TakeWhileIterator.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,306 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/detail/TransformIterator.hh
+ * \brief  TransformIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_PIPELINE_DETAIL_TRANSFORMITERATOR_HH
+#define ITERTOOLS_SRC_PIPELINE_DETAIL_TRANSFORMITERATOR_HH
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "FunctionBox.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class TransformIterator
+ * \brief Applies a function to the elements of a sequence as they are read
+ *
+ * Dereferencing returns <tt>function(*iter)</tt>; nothing is stored.  The
+ * iterator moves, compares and computes distances through the underlying
+ * iterator and has its category, so a transformed random-access sequence
+ * keeps its size and can still be indexed and split.
+ *
+ * \example pipeline/tests/tstPipeline.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, typename Function>
+class TransformIterator
+{
+  public:
+    //! Public type aliases
+    using This = TransformIterator<Iterator, Function>;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+    using reference = std::invoke_result_t<
+        const Function&,
+        typename std::iterator_traits<Iterator>::reference>;
+    using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+    using pointer = void;
+    using iterator_category =
+        typename std::iterator_traits<Iterator>::iterator_category;
+
+  public:
+    // Default constructor
+    TransformIterator() = default;
+
+    //! Construct with the underlying iterator and the function
+    TransformIterator(Iterator iter, Function function)
+        : m_iter(std::move(iter)), m_function(std::move(function))
+    {
+    }
+
+    // >>> INCREMENT, DECREMENT
+    //! Pre-increment
+    This& operator++()
+    {
+        ++m_iter;
+        return *this;
+    }
+
+    //! Post-increment
+    This operator++(int)
+    {
+        This copy = *this;
+        ++m_iter;
+        return copy;
+    }
+
+    //! Pre-decrement
+    This& operator--()
+    {
+        --m_iter;
+        return *this;
+    }
+
+    //! Post-decrement
+    This operator--(int)
+    {
+        This copy = *this;
+        --m_iter;
+        return copy;
+    }
+
+    // >>> DEREFERENCE, INDEXING
+    //! Apply the function to the current element
+    reference operator*() const { return m_function(*m_iter); }
+
+    //! Apply the function to the element n positions away
+    reference operator[](difference_type n) const
+    {
+        return m_function(m_iter[n]);
+    }
+
+    // >>> COMPOUND ARITHMETIC
+    //! Advance by n elements
+    This& operator+=(difference_type n)
+    {
+        m_iter += n;
+        return *this;
+    }
+
+    //! Move back by n elements
+    This& operator-=(difference_type n)
+    {
+        m_iter -= n;
+        return *this;
+    }
+
+    // >>> ACCESSORS
+    //! Return the underlying iterator
+    const Iterator& base() const { return m_iter; }
+
+  private:
+    // >>> DATA
+    //! Stores the underlying iterator
+    Iterator m_iter{};
+
+    //! Stores the function
+    FunctionBox<Function> m_function;
+};
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a transform iterator and a distance
+ *
+ * \param[in] iter  The transform iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n elements after \p iter
+ */
+template<typename Iterator, typename Function>
+inline TransformIterator<Iterator, Function>
+operator+(TransformIterator<Iterator, Function> iter,
+          typename TransformIterator<Iterator, Function>::difference_type n)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a distance and a transform iterator
+ *
+ * \param[in] n     The distance
+ * \param[in] iter  The transform iterator
+ *
+ * \return The iterator \p n elements after \p iter
+ */
+template<typename Iterator, typename Function>
+inline TransformIterator<Iterator, Function>
+operator+(typename TransformIterator<Iterator, Function>::difference_type n,
+          TransformIterator<Iterator, Function> iter)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between a transform iterator and a distance
+ *
+ * \param[in] iter  The transform iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n elements before \p iter
+ */
+template<typename Iterator, typename Function>
+inline TransformIterator<Iterator, Function>
+operator-(TransformIterator<Iterator, Function> iter,
+          typename TransformIterator<Iterator, Function>::difference_type n)
+{
+    return iter -= n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between two transform iterators
+ *
+ * \param[in] iter1  The first transform iterator
+ * \param[in] iter2  The second transform iterator
+ *
+ * \return The number of elements from \p iter2 to \p iter1
+ */
+template<typename Iterator, typename Function>
+inline typename TransformIterator<Iterator, Function>::difference_type
+operator-(const TransformIterator<Iterator, Function>& iter1,
+          const TransformIterator<Iterator, Function>& iter2)
+{
+    return iter1.base() - iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Equality operator
+ *
+ * \param[in] iter1  The first transform iterator
+ * \param[in] iter2  The second transform iterator
+ *
+ * \return True if the underlying iterators are equal
+ */
+template<typename Iterator, typename Function>
+inline bool operator==(const TransformIterator<Iterator, Function>& iter1,
+                       const TransformIterator<Iterator, Function>& iter2)
+{
+    return iter1.base() == iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inequality operator
+ *
+ * \param[in] iter1  The first transform iterator
+ * \param[in] iter2  The second transform iterator
+ *
+ * \return True if the underlying iterators differ
+ */
+template<typename Iterator, typename Function>
+inline bool operator!=(const TransformIterator<Iterator, Function>& iter1,
+                       const TransformIterator<Iterator, Function>& iter2)
+{
+    return iter1.base() != iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than operator
+ *
+ * \param[in] iter1  The first transform iterator
+ * \param[in] iter2  The second transform iterator
+ *
+ * \return True if \p iter1 precedes \p iter2
+ */
+template<typename Iterator, typename Function>
+inline bool operator<(const TransformIterator<Iterator, Function>& iter1,
+                      const TransformIterator<Iterator, Function>& iter2)
+{
+    return iter1.base() < iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than or equal operator
+ *
+ * \param[in] iter1  The first transform iterator
+ * \param[in] iter2  The second transform iterator
+ *
+ * \return True if \p iter1 does not follow \p iter2
+ */
+template<typename Iterator, typename Function>
+inline bool operator<=(const TransformIterator<Iterator, Function>& iter1,
+                       const TransformIterator<Iterator, Function>& iter2)
+{
+    return iter1.base() <= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than operator
+ *
+ * \param[in] iter1  The first transform iterator
+ * \param[in] iter2  The second transform iterator
+ *
+ * \return True if \p iter1 follows \p iter2
+ */
+template<typename Iterator, typename Function>
+inline bool operator>(const TransformIterator<Iterator, Function>& iter1,
+                      const TransformIterator<Iterator, Function>& iter2)
+{
+    return iter1.base() > iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than or equal operator
+ *
+ * \param[in] iter1  The first transform iterator
+ * \param[in] iter2  The second transform iterator
+ *
+ * \return True if \p iter1 does not precede \p iter2
+ */
+template<typename Iterator, typename Function>
+inline bool operator>=(const TransformIterator<Iterator, Function>& iter1,
+                       const TransformIterator<Iterator, Function>& iter2)
+{
+    return iter1.base() >= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_PIPELINE_DETAIL_TRANSFORMITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/pipeline/detail/TransformIterator.hh
+//---------------------------------------------------------------------------//
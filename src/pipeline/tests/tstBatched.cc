@@ -0,0 +1,121 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/tests/tstBatched.cc
+ * \brief  Tests for batched.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Batched.hh"
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "enumerate/Enumerate.hh"
+#include "range/Range.hh"
+#include "zip/Zip.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(BatchedTest, Vector)
+{
+    std::vector<int> x(10);
+    std::iota(x.begin(), x.end(), 0);
+
+    auto batches = itertools::batched(x, 4);
+    static_assert(
+        std::is_same_v<itertools::Batch<int*>, decltype(batches)::value_type>);
+    ASSERT_EQ(3u, batches.size());
+
+    // Full batches and a tail batch, viewing the elements in place
+    std::vector<std::size_t> sizes;
+    for (auto batch : batches)
+    {
+        sizes.push_back(batch.size());
+        for (int& xi : batch)
+        {
+            xi *= 2;
+        }
+    }
+    EXPECT_EQ((std::vector<std::size_t>{4, 4, 2}), sizes);
+    EXPECT_EQ(18, x[9]);
+    EXPECT_EQ(x.data() + 4, batches[1].data());
+    EXPECT_EQ(x.data() + 8, batches[2].data());
+    EXPECT_EQ(16, batches[2][0]);
+
+    // Exact multiples, single batches and empty sequences
+    EXPECT_EQ(2u, itertools::batched(x, 5).size());
+    EXPECT_EQ(5u, itertools::batched(x, 5)[1].size());
+    EXPECT_EQ(10u, itertools::batched(x, 64)[0].size());
+    std::vector<int> empty;
+    EXPECT_TRUE(itertools::batched(empty, 3).empty());
+
+    // Constant sequences and operator|
+    const std::array<std::string, 3> names{"a", "b", "c"};
+    auto named = names | itertools::batched(2);
+    static_assert(std::is_same_v<const std::string*,
+                                 decltype(named[0].data())>);
+    EXPECT_EQ("c", named[1][0]);
+}
+
+//---------------------------------------------------------------------------//
+TEST(BatchedTest, Zip)
+{
+    std::vector<double> m{1, 2, 3, 4, 5};
+    std::vector<int> id{10, 11, 12, 13, 14};
+
+    auto batches = itertools::zip(m, id) | itertools::batched(2);
+    ASSERT_EQ(3u, batches.size());
+
+    // Sub-zips of pointers, one per sequence
+    auto tail = batches[2];
+    static_assert(std::is_same_v<itertools::ZipIterator<double*, int*>,
+                                 decltype(tail)::iterator>);
+    EXPECT_EQ(1u, tail.size());
+    EXPECT_EQ(m.data() + 4, tail.begin().get<0>());
+    EXPECT_EQ(id.data() + 4, tail.begin().get<1>());
+
+    for (auto batch : batches)
+    {
+        for (auto [mi, idi] : batch)
+        {
+            mi += idi;
+        }
+    }
+    EXPECT_EQ((std::vector<double>{11, 13, 15, 17, 19}), m);
+}
+
+//---------------------------------------------------------------------------//
+TEST(BatchedTest, Views)
+{
+    // Views without storage keep their iterators
+    auto ranges = itertools::batched(itertools::range(3, 10), 3);
+    ASSERT_EQ(3u, ranges.size());
+    EXPECT_EQ(6, *ranges[1].begin());
+    EXPECT_EQ(1u, ranges[2].size());
+
+    // Enumerations keep their global counts
+    std::vector<char> c(7, 'x');
+    auto counted = itertools::enumerate(c) | itertools::batched(3);
+    EXPECT_EQ(6u, counted[2].begin().count());
+
+    // The view of the batches is split like any other pipeline
+    const auto parts = itertools::batched(c, 2).split(2);
+    ASSERT_EQ(2u, parts.size());
+    EXPECT_EQ(2u, parts[0].size());
+    EXPECT_EQ(c.data() + 4, parts[1][0].data());
+    EXPECT_EQ(1u, parts[1][1].size());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/pipeline/tests/tstBatched.cc
+//---------------------------------------------------------------------------//
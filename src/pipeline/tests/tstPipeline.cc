@@ -0,0 +1,254 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/tests/tstPipeline.cc
+ * \brief  Tests for the filter, transform and takeWhile pipelines.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Pipeline.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "enumerate/Enumerate.hh"
+#include "range/Range.hh"
+#include "zip/Zip.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(PipelineTest, Range)
+{
+    auto p = itertools::range(20)
+             | itertools::filter([](int i) { return i % 3 == 0; })
+             | itertools::transform([](int i) { return i * i; })
+             | itertools::takeWhile([](int sq) { return sq < 150; });
+    static_assert(!decltype(p)::is_sized);
+    static_assert(std::is_same_v<std::forward_iterator_tag,
+                                 decltype(p)::iterator::iterator_category>);
+
+    std::vector<int> values(p.begin(), p.end());
+    EXPECT_EQ((std::vector<int>{0, 9, 36, 81, 144}), values);
+    EXPECT_FALSE(p.empty());
+
+    // Function forms, and stages selecting nothing
+    auto none = itertools::filter(itertools::range(5),
+                                  [](int i) { return i > 10; });
+    EXPECT_TRUE(none.empty());
+    auto head = itertools::takeWhile(itertools::range(5),
+                                     [](int i) { return i < 0; });
+    EXPECT_EQ(head.begin(), head.end());
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelineTest, Containers)
+{
+    std::vector<int> x{5, -1, 3, -7, 2, 8};
+
+    // Transforms through references write to the sequence
+    for (int& xi : x | itertools::filter([](int v) { return v < 0; }))
+    {
+        xi = 0;
+    }
+    EXPECT_EQ((std::vector<int>{5, 0, 3, 0, 2, 8}), x);
+
+    auto twice = x | itertools::transform([](int v) { return 2 * v; });
+    static_assert(decltype(twice)::is_sized);
+    static_assert(decltype(twice)::is_random_access);
+    EXPECT_EQ(6u, twice.size());
+    EXPECT_EQ(6, twice[2]);
+    EXPECT_EQ(16, *(twice.end() - 1));
+    EXPECT_EQ(36, std::accumulate(twice.begin(), twice.end(), 0));
+
+    // Sized sequences without random access
+    std::list<std::string> words{"a", "bb", "ccc", "d"};
+    auto lengths = words | itertools::transform(&std::string::size);
+    static_assert(decltype(lengths)::is_sized);
+    static_assert(!decltype(lengths)::is_random_access);
+    EXPECT_EQ(4u, lengths.size());
+    EXPECT_EQ((std::vector<std::size_t>{1, 2, 3, 1}),
+              std::vector<std::size_t>(lengths.begin(), lengths.end()));
+
+    auto prefix = words
+                  | itertools::takeWhile(
+                      [](const std::string& w) { return w.size() < 3; });
+    EXPECT_EQ(2, std::distance(prefix.begin(), prefix.end()));
+
+    // Sequences of unknown size
+    std::forward_list<int> values{1, 2, 3};
+    auto halves = values | itertools::transform([](int v) { return v / 2.0; });
+    static_assert(!decltype(halves)::is_sized);
+    EXPECT_EQ(1.5, *std::next(halves.begin(), 2));
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelineTest, Zip)
+{
+    std::vector<double> m{1.0, 2.0, 0.0, 4.0};
+    std::vector<double> v{3.0, 1.0, 5.0, 0.5};
+
+    auto energies
+        = itertools::zip(m, v)
+          | itertools::filter([](auto mv) { return std::get<0>(mv) > 0.0; })
+          | itertools::transform([](auto mv) {
+                auto [mi, vi] = mv;
+                return 0.5 * mi * vi * vi;
+            });
+    std::vector<double> values(energies.begin(), energies.end());
+    EXPECT_EQ((std::vector<double>{4.5, 1.0, 0.5}), values);
+
+    // Zipped references can be written through the pipeline
+    for (auto [mi, vi] : itertools::zip(m, v)
+                             | itertools::takeWhile([](auto mv) {
+                                   return std::get<1>(mv) > 0.9;
+                               }))
+    {
+        mi += vi;
+    }
+    EXPECT_EQ((std::vector<double>{4.0, 3.0, 5.0, 4.0}), m);
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelineTest, Enumerate)
+{
+    std::vector<int> x{4, 0, 0, 9, 0, 2};
+
+    // Indices of the nonzero elements
+    auto nonzero = itertools::enumerate(x)
+                   | itertools::filter([](auto p) { return std::get<1>(p); })
+                   | itertools::transform([](auto p) { return std::get<0>(p); });
+    EXPECT_EQ((std::vector<std::size_t>{0, 3, 5}),
+              std::vector<std::size_t>(nonzero.begin(), nonzero.end()));
+
+    // A transformed enumeration keeps its counts when sliced
+    auto weighted = itertools::enumerate(x, 1)
+                    | itertools::transform([](auto p) {
+                          auto [i, xi] = p;
+                          return i * xi;
+                      });
+    EXPECT_EQ(6u, weighted.size());
+    EXPECT_EQ(36, weighted[3]);
+    auto tail = weighted.slice(3, 3);
+    EXPECT_EQ((std::vector<int>{36, 0, 12}),
+              std::vector<int>(tail.begin(), tail.end()));
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelineTest, Split)
+{
+    const auto squares = itertools::range(10)
+                         | itertools::transform([](int i) { return i * i; });
+
+    const auto parts = squares.split(3);
+    ASSERT_EQ(3u, parts.size());
+    std::vector<int> values;
+    for (auto part : parts)
+    {
+        values.insert(values.end(), part.begin(), part.end());
+    }
+    EXPECT_EQ((std::vector<int>{0, 1, 4, 9, 16, 25, 36, 49, 64, 81}),
+              values);
+    EXPECT_EQ(4u, parts[0].size());
+    EXPECT_EQ(49, parts[2][0]);
+    EXPECT_EQ(2u, squares.split(8, 4).size());
+    EXPECT_EQ(0u, squares.slice(10, 0).size());
+
+    // Stages applied to a partition
+    auto odd = parts[1] | itertools::filter([](int v) { return v % 2; });
+    EXPECT_EQ((std::vector<int>{25}), std::vector<int>(odd.begin(), odd.end()));
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelineTest, Stateful)
+{
+    // Stages are copied into the iterators, which stay assignable
+    int calls = 0;
+    auto p = itertools::range(6) | itertools::transform([&calls](int i) {
+                 ++calls;
+                 return i + 1;
+             });
+    auto iter = p.begin();
+    iter = p.begin() + 2;
+    EXPECT_EQ(3, *iter);
+    EXPECT_EQ(1, calls);
+
+    const auto offset = std::string("x");
+    auto names = itertools::range(3) | itertools::transform([offset](int i) {
+                     return offset + std::to_string(i);
+                 });
+    EXPECT_EQ("x2", names[2]);
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelineTest, LazyPredicates)
+{
+    // Constructing a filter or take-while does not call the predicate
+    std::vector<int> x{1, 2, 3, 4, 5, 6};
+    int calls = 0;
+    auto even = x | itertools::filter([&calls](int v) {
+                    ++calls;
+                    return v % 2 == 0;
+                });
+    auto small = x | itertools::takeWhile([&calls](int v) {
+                     ++calls;
+                     return v < 3;
+                 });
+    EXPECT_EQ(0, calls);
+
+    // The first element is found when first compared or dereferenced
+    auto iter = even.begin();
+    EXPECT_EQ(0, calls);
+    EXPECT_EQ(2, *iter);
+    EXPECT_EQ(2, calls);
+    EXPECT_EQ(4, *std::next(even.begin()));
+    EXPECT_EQ((std::vector<int>{2, 4, 6}),
+              std::vector<int>(even.begin(), even.end()));
+
+    // Every element of the prefix is tested once per traversal
+    calls = 0;
+    std::vector<int> prefix;
+    for (int v : small)
+    {
+        prefix.push_back(v);
+    }
+    EXPECT_EQ((std::vector<int>{1, 2}), prefix);
+    EXPECT_EQ(3, calls);
+    EXPECT_TRUE((x | itertools::takeWhile([](int v) { return v > 1; }))
+                    .empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST(PipelineTest, ParallelAlgorithms)
+{
+    const std::size_t n = 100000;
+    std::vector<std::atomic<int>> visited(n);
+    auto p = itertools::range(n)
+             | itertools::transform([](std::size_t i) { return n - 1 - i; });
+
+    std::for_each(std::execution::par, p.begin(), p.end(), [&](std::size_t i) {
+        visited[i].fetch_add(1);
+    });
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(1, visited[i].load()) << "at index " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end of src/pipeline/tests/tstPipeline.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,73 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/pipeline/tests/vecPipeline.cc
+ * \brief  Kernels that must vectorize when looping over a pipeline.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Batched.hh"
+#include "../Pipeline.hh"
+
+#include <vector>
+
+#include "range/Range.hh"
+#include "zip/Zip.hh"
+
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+// The loops marked "// vectorized" are checked by the vecPipeline test.
+
+int sumSquares(const std::vector<int>& x)
+{
+    int total = 0;
+    for (int sq :
+         x | itertools::transform([](int v) { return v * v; }))  // vectorized
+    {
+        total += sq;
+    }
+    return total;
+}
+
+//---------------------------------------------------------------------------//
+void squares(const std::vector<float>& x, std::vector<float>& y)
+{
+    auto sq = x | itertools::transform([](float v) { return v * v; });
+    for (auto [yi, s] : itertools::zip(y, sq))  // vectorized
+    {
+        yi = s;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void kineticEnergy(const std::vector<float>& m,
+                   const std::vector<float>& v,
+                   float* energy)
+{
+    auto e = itertools::zip(m, v) | itertools::transform([](auto mv) {
+                 auto [mi, vi] = mv;
+                 return 0.5f * mi * vi * vi;
+             });
+    for (int i : itertools::range(static_cast<int>(e.size())))  // vectorized
+    {
+        energy[i] = e[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void scaleBatches(std::vector<float>& x, float a)
+{
+    for (auto batch : itertools::batched(x, 256))
+    {
+        for (float& xi : batch)  // vectorized
+        {
+            xi *= a;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end of src/pipeline/tests/vecPipeline.cc
+//---------------------------------------------------------------------------//
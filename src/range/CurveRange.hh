@@ -0,0 +1,272 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/CurveRange.hh
+ * \brief  CurveRange class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_CURVERANGE_HH
+#define ITERTOOLS_SRC_RANGE_CURVERANGE_HH
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "core/DBC.hh"
+#include "Range.hh"
+#include "SpaceFillingCurves.hh"
+#include "detail/CurveIterator.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class CurveRange
+ * \brief A multi-dimensional index space traversed along a space-filling
+ *        curve
+ *
+ * Like an NdRange, a CurveRange is the Cartesian product of one Range per
+ * dimension, and its iterators yield \c std::array index tuples.  The points
+ * are visited in Z-order (MortonCurve) or Hilbert order (HilbertCurve), which
+ * keeps consecutive points close together in every dimension:
+ * \code
+ * for (auto [i, j, k] : hilbertRange(ni, nj, nk)) { ... }
+ * \endcode
+ *
+ * Each point is decoded from its curve code with bit operations only
+ * (\c pdep/\c pext when BMI2 is enabled), so no permutation array is stored.
+ * The codes are walked with a Range over the power-of-two cube bounding the
+ * index space; codes outside the index space are skipped block by block.
+ * The iterators are forward iterators.
+ *
+ * \tparam Curve         The curve type (MortonCurve or HilbertCurve)
+ * \tparam Dims          The number of dimensions
+ * \tparam IntegralType  The integral type of the index values
+ *
+ * \example range/tests/tstCurveRange.cc
+ */
+//===========================================================================//
+
+template<typename Curve,
+         std::size_t Dims,
+         typename IntegralType = std::ptrdiff_t>
+class CurveRange
+{
+    static_assert(Dims > 0 && Dims < 64);
+
+  public:
+    //@{
+    //! Public type aliases
+    using curve_type = Curve;
+    using range_type = Range<IntegralType>;
+    using value_type = std::array<typename range_type::value_type, Dims>;
+    using iterator = detail::CurveIterator<CurveRange>;
+    using const_iterator = detail::CurveIterator<CurveRange>;
+    using size_type = std::size_t;
+    using code_type = std::uint64_t;
+    using Ranges_t = std::array<range_type, Dims>;
+    using Extents_t = std::array<size_type, Dims>;
+    //@}
+
+  public:
+    // Construct from one range per dimension
+    inline explicit CurveRange(const Ranges_t& ranges);
+
+    //! Return the number of dimensions
+    static constexpr size_type dims() { return Dims; }
+
+    //! Return beginning iterator
+    const_iterator begin() const { return this->cbegin(); }
+
+    //! Return const beginning iterator
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, m_codes.begin());
+    }
+
+    //! Return ending iterator
+    const_iterator end() const { return this->cend(); }
+
+    //! Return const ending iterator
+    const_iterator cend() const { return const_iterator(this, m_codes.end()); }
+
+    //! Return the number of points
+    size_type size() const { return m_size; }
+
+    //! Return whether there are no points
+    bool empty() const { return m_size == 0; }
+
+    // >>> GEOMETRY
+    //! Access the range of dimension \p d
+    const range_type& dimension(size_type d) const { return m_ranges[d]; }
+
+    //! Access the number of values along each dimension
+    const Extents_t& extents() const { return m_extents; }
+
+    //! Return the number of bits per coordinate of the bounding cube
+    unsigned int order() const { return m_order; }
+
+    //! Access the range of curve codes over the bounding cube
+    const Range<code_type>& codes() const { return m_codes; }
+
+  private:
+    // Compute the number of bits per coordinate of the bounding cube
+    static inline unsigned int computeOrder(const Extents_t& extents);
+
+    // >>> DATA
+    //! The range of each dimension
+    Ranges_t m_ranges;
+
+    //! The number of values along each dimension
+    Extents_t m_extents;
+
+    //! The number of bits per coordinate of the bounding cube
+    unsigned int m_order;
+
+    //! The curve codes of the bounding cube
+    Range<code_type> m_codes;
+
+    //! The number of points
+    size_type m_size;
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Create an index space from one range per dimension traversed along a curve
+template<typename Curve, typename IntegralType, typename... Ranges>
+inline CurveRange<Curve, sizeof...(Ranges) + 1, IntegralType>
+curveRange(const Range<IntegralType>& range, const Ranges&... ranges);
+
+// Create an index space spanning 0...end along each dimension in Z-order
+template<typename IntegralType, typename... IntegralTypes>
+inline CurveRange<MortonCurve, sizeof...(IntegralTypes) + 1, IntegralType>
+mortonRange(IntegralType end, IntegralTypes... ends);
+
+// Create an index space spanning 0...end along each dimension in Hilbert
+// order
+template<typename IntegralType, typename... IntegralTypes>
+inline CurveRange<HilbertCurve, sizeof...(IntegralTypes) + 1, IntegralType>
+hilbertRange(IntegralType end, IntegralTypes... ends);
+
+//===========================================================================//
+// INLINE IMPLEMENTATIONS
+//===========================================================================//
+/*!
+ * \brief Construct from one range per dimension
+ *
+ * The curve codes of the cube bounding the index space must fit in 63 bits,
+ * e.g., extents up to 2^31 in two dimensions and 2^21 in three.
+ *
+ * \param[in] ranges  The range of each dimension
+ */
+template<typename Curve, std::size_t Dims, typename IntegralType>
+CurveRange<Curve, Dims, IntegralType>::CurveRange(const Ranges_t& ranges)
+    : m_ranges(ranges)
+    , m_extents()
+    , m_order(0)
+    , m_codes(0)
+    , m_size(1)
+{
+    for (size_type d = 0; d < Dims; ++d)
+    {
+        m_extents[d] = ranges[d].size();
+        m_size *= m_extents[d];
+    }
+    m_order = computeOrder(m_extents);
+    IT_REQUIRE(Dims * m_order < 64);
+
+    if (m_size > 0)
+    {
+        m_codes = Range<code_type>(code_type(1) << (Dims * m_order));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the number of bits per coordinate of the bounding cube
+ *
+ * \param[in] extents  The number of values along each dimension
+ *
+ * \return The smallest nonzero order whose cube holds the index space
+ */
+template<typename Curve, std::size_t Dims, typename IntegralType>
+unsigned int
+CurveRange<Curve, Dims, IntegralType>::computeOrder(const Extents_t& extents)
+{
+    const size_type largest
+        = *std::max_element(extents.begin(), extents.end());
+
+    unsigned int order = 1;
+    while (order < 64 && (size_type(1) << order) < largest)
+    {
+        ++order;
+    }
+    return order;
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create an index space from one range per dimension, traversed along
+ *        the curve \c Curve
+ *
+ * \param[in] range   The range of the first dimension
+ * \param[in] ranges  The ranges of the remaining dimensions
+ *
+ * \return An index space in curve order
+ */
+template<typename Curve, typename IntegralType, typename... Ranges>
+CurveRange<Curve, sizeof...(Ranges) + 1, IntegralType>
+curveRange(const Range<IntegralType>& range, const Ranges&... ranges)
+{
+    using Result_t = CurveRange<Curve, sizeof...(Ranges) + 1, IntegralType>;
+    return Result_t(typename Result_t::Ranges_t{range, ranges...});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create an index space spanning 0...end along each dimension,
+ *        traversed in Z-order
+ *
+ * \param[in] end   The ending value of the first dimension
+ * \param[in] ends  The ending values of the remaining dimensions
+ *
+ * \return An index space in Morton order
+ */
+template<typename IntegralType, typename... IntegralTypes>
+CurveRange<MortonCurve, sizeof...(IntegralTypes) + 1, IntegralType>
+mortonRange(IntegralType end, IntegralTypes... ends)
+{
+    return curveRange<MortonCurve>(
+        range(end), range(static_cast<IntegralType>(ends))...);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create an index space spanning 0...end along each dimension,
+ *        traversed in Hilbert order
+ *
+ * \param[in] end   The ending value of the first dimension
+ * \param[in] ends  The ending values of the remaining dimensions
+ *
+ * \return An index space in Hilbert order
+ */
+template<typename IntegralType, typename... IntegralTypes>
+CurveRange<HilbertCurve, sizeof...(IntegralTypes) + 1, IntegralType>
+hilbertRange(IntegralType end, IntegralTypes... ends)
+{
+    return curveRange<HilbertCurve>(
+        range(end), range(static_cast<IntegralType>(ends))...);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_CURVERANGE_HH
+//---------------------------------------------------------------------------//
+// end of src/range/CurveRange.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,330 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/NdRange.hh
+ * \brief  NdRange class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_NDRANGE_HH
+#define ITERTOOLS_SRC_RANGE_NDRANGE_HH
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "core/DBC.hh"
+#include "Range.hh"
+#include "detail/NdRangeIterator.hh"
+#include "detail/RangePartitions.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class NdRange
+ * \brief A multi-dimensional index space traversed row-major or by tiles
+ *
+ * An NdRange is the Cartesian product of one Range per dimension.  Its
+ * iterators yield \c std::array index tuples, with the last dimension
+ * varying fastest:
+ * \code
+ * for (auto [i, j] : ndRange(ni, nj)) { b[j][i] = a[i][j]; }
+ * \endcode
+ *
+ * A tiled NdRange walks the index space one cache-sized block at a time: the
+ * tiles are visited in row-major order, and the points within each tile in
+ * row-major order as well.  A transpose or stencil then touches a
+ * tile-by-tile working set instead of whole rows and columns:
+ * \code
+ * for (auto [i, j] : ndRange(ni, nj).tiled({32, 32})) { ... }
+ * \endcode
+ * Tiles along the upper boundary of a dimension are truncated to fit.
+ *
+ * The iterators are random access, and an NdRange can be sliced and split
+ * along its traversal order like a Range, so the parallel loops partition
+ * tiled traversals just like one-dimensional ones.  Iterators refer to their
+ * NdRange, which must outlive them.
+ *
+ * \tparam Dims          The number of dimensions
+ * \tparam IntegralType  The integral type of the index values
+ *
+ * \example range/tests/tstNdRange.cc
+ */
+//===========================================================================//
+
+template<std::size_t Dims, typename IntegralType = std::ptrdiff_t>
+class NdRange
+{
+    static_assert(Dims > 0);
+
+  public:
+    //@{
+    //! Public type aliases
+    using range_type = Range<IntegralType>;
+    using value_type = std::array<typename range_type::value_type, Dims>;
+    using iterator = detail::NdRangeIterator<NdRange>;
+    using const_iterator = detail::NdRangeIterator<NdRange>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using partitions_type = detail::RangePartitions<NdRange>;
+    using Ranges_t = std::array<range_type, Dims>;
+    using Extents_t = std::array<size_type, Dims>;
+    //@}
+
+  public:
+    // Construct from one range per dimension
+    inline explicit NdRange(const Ranges_t& ranges);
+
+    //! Return the number of dimensions
+    static constexpr size_type dims() { return Dims; }
+
+    // Return the whole index space traversed by tiles of the given extents
+    inline NdRange tiled(const Extents_t& tile) const;
+
+    //! Return beginning iterator
+    const_iterator begin() const { return this->cbegin(); }
+
+    //! Return const beginning iterator
+    const_iterator cbegin() const { return const_iterator(this, m_first); }
+
+    //! Return ending iterator
+    const_iterator end() const { return this->cend(); }
+
+    //! Return const ending iterator
+    const_iterator cend() const
+    {
+        return const_iterator(this, m_first + m_size);
+    }
+
+    //! Return the number of points traversed
+    size_type size() const { return m_size; }
+
+    //! Return whether no point is traversed
+    bool empty() const { return m_size == 0; }
+
+    //! Access the index tuple at traversal index \p i
+    value_type operator[](size_type i) const
+    {
+        return this->cbegin()[static_cast<difference_type>(i)];
+    }
+
+    // >>> GEOMETRY
+    //! Access the range of dimension \p d
+    const range_type& dimension(size_type d) const { return m_ranges[d]; }
+
+    //! Access the number of values along each dimension
+    const Extents_t& extents() const { return m_extents; }
+
+    //! Access the tile extents
+    const Extents_t& tile() const { return m_tile; }
+
+    //! Return the number of points in the whole index space
+    size_type count() const { return m_count; }
+
+    // >>> PARTITIONING
+    // Return the length points starting at traversal index offset
+    inline NdRange slice(size_type offset, size_type length) const;
+
+    // Split into count balanced, contiguous parts of the traversal
+    inline partitions_type split(size_type count) const;
+
+    // Split into at most count parts of at least min_grain points
+    inline partitions_type split(size_type count, size_type min_grain) const;
+
+  private:
+    // >>> DATA
+    //! The range of each dimension
+    Ranges_t m_ranges;
+
+    //! The number of values along each dimension
+    Extents_t m_extents;
+
+    //! The tile extents (the whole index space when not tiled)
+    Extents_t m_tile;
+
+    //! The number of points in the whole index space
+    size_type m_count;
+
+    //! The traversal index of the first traversed point
+    size_type m_first;
+
+    //! The number of traversed points
+    size_type m_size;
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Create an index space spanning 0...end along each dimension
+template<typename IntegralType, typename... IntegralTypes>
+inline std::enable_if_t<std::is_integral_v<IntegralType>,
+                        NdRange<sizeof...(IntegralTypes) + 1, IntegralType>>
+ndRange(IntegralType end, IntegralTypes... ends);
+
+// Create an index space from one range per dimension
+template<typename IntegralType, typename... Ranges>
+inline NdRange<sizeof...(Ranges) + 1, IntegralType>
+ndRange(const Range<IntegralType>& range, const Ranges&... ranges);
+
+//===========================================================================//
+// INLINE IMPLEMENTATIONS
+//===========================================================================//
+/*!
+ * \brief Construct from one range per dimension
+ *
+ * The index space is traversed in row-major order.
+ *
+ * \param[in] ranges  The range of each dimension
+ */
+template<std::size_t Dims, typename IntegralType>
+NdRange<Dims, IntegralType>::NdRange(const Ranges_t& ranges)
+    : m_ranges(ranges), m_count(1), m_first(0)
+{
+    for (size_type d = 0; d < Dims; ++d)
+    {
+        m_extents[d] = ranges[d].size();
+        m_tile[d] = std::max<size_type>(m_extents[d], 1);
+        m_count *= m_extents[d];
+    }
+    m_size = m_count;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the whole index space traversed by tiles
+ *
+ * Tile extents larger than the index space are clamped to it.
+ *
+ * \param[in] tile  The nonzero tile extent along each dimension
+ *
+ * \return A copy of this index space in tiled traversal order
+ */
+template<std::size_t Dims, typename IntegralType>
+auto NdRange<Dims, IntegralType>::tiled(const Extents_t& tile) const
+    -> NdRange
+{
+    IT_REQUIRE(m_first == 0 && m_size == m_count);
+
+    NdRange result(*this);
+    for (size_type d = 0; d < Dims; ++d)
+    {
+        IT_REQUIRE(tile[d] > 0);
+        result.m_tile[d]
+            = std::min(tile[d], std::max<size_type>(m_extents[d], 1));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// PARTITIONING
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the \p length points starting at traversal index \p offset
+ *
+ * The slice keeps the traversal order of this index space, so slices of a
+ * tiled traversal visit whole tiles except at their ends.
+ *
+ * \param[in] offset  The traversal index of the first point of the slice
+ * \param[in] length  The number of points in the slice
+ *
+ * \return The contiguous part of the traversal
+ */
+template<std::size_t Dims, typename IntegralType>
+auto NdRange<Dims, IntegralType>::slice(size_type offset,
+                                        size_type length) const -> NdRange
+{
+    IT_REQUIRE(offset <= m_size);
+    IT_REQUIRE(length <= m_size - offset);
+
+    NdRange result(*this);
+    result.m_first = m_first + offset;
+    result.m_size = length;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the traversal into \p count balanced, contiguous parts
+ *
+ * \param[in] count  The number of partitions (nonzero)
+ *
+ * \return A view of the partitions
+ */
+template<std::size_t Dims, typename IntegralType>
+auto NdRange<Dims, IntegralType>::split(size_type count) const
+    -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+
+    return partitions_type(*this, count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the traversal into at most \p count balanced parts holding at
+ *        least \p min_grain points each
+ *
+ * \param[in] count      The maximum number of partitions (nonzero)
+ * \param[in] min_grain  The minimum number of points in each partition
+ *
+ * \return A view of the partitions
+ */
+template<std::size_t Dims, typename IntegralType>
+auto NdRange<Dims, IntegralType>::split(size_type count,
+                                        size_type min_grain) const
+    -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+    IT_REQUIRE(min_grain > 0);
+
+    const size_type max_count = std::max<size_type>(m_size / min_grain, 1);
+    return partitions_type(*this, std::min(count, max_count));
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create an index space spanning 0...end along each dimension
+ *
+ * \param[in] end   The ending value of the first dimension
+ * \param[in] ends  The ending values of the remaining dimensions
+ *
+ * \return A row-major index space
+ */
+template<typename IntegralType, typename... IntegralTypes>
+std::enable_if_t<std::is_integral_v<IntegralType>,
+                 NdRange<sizeof...(IntegralTypes) + 1, IntegralType>>
+ndRange(IntegralType end, IntegralTypes... ends)
+{
+    using Result_t = NdRange<sizeof...(IntegralTypes) + 1, IntegralType>;
+    return Result_t(typename Result_t::Ranges_t{
+        range(end), range(static_cast<IntegralType>(ends))...});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create an index space from one range per dimension
+ *
+ * \param[in] range   The range of the first dimension
+ * \param[in] ranges  The ranges of the remaining dimensions
+ *
+ * \return A row-major index space
+ */
+template<typename IntegralType, typename... Ranges>
+NdRange<sizeof...(Ranges) + 1, IntegralType>
+ndRange(const Range<IntegralType>& range, const Ranges&... ranges)
+{
+    using Result_t = NdRange<sizeof...(Ranges) + 1, IntegralType>;
+    return Result_t(typename Result_t::Ranges_t{range, ranges...});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_NDRANGE_HH
+//---------------------------------------------------------------------------//
+// end of src/range/NdRange.hh
+//---------------------------------------------------------------------------//
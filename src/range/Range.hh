@@ -8,18 +8,51 @@
 #ifndef ITERTOOLS_SRC_RANGE_RANGE_HH
 #define ITERTOOLS_SRC_RANGE_RANGE_HH
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
+#include "core/DBC.hh"
+#include "detail/RangeBlocks.hh"
+#include "detail/RangeIterator.hh"
+#include "detail/RangePartitions.hh"
+
 namespace itertools
 {
 //===========================================================================//
 /*!
  * \class Range
- * \brief <++>
+ * \brief An iterable range of integral values with a constant step length
+ *
+ * The number of values in the range is computed once at construction (e.g.,
+ * the range <tt>range(0, 10, 3)</tt> visits 0, 3, 6 and 9), and the iterators
+ * are compared by their position in the range.  A loop over the range is thus
+ * a counted loop with a single test per iteration, which runs the right
+ * number of times even when the value past the last one is not
+ * representable, e.g., <tt>range<std::uint8_t>(0, 255, 2)</tt> visits 128
+ * values.  A loop with a step known at compile time vectorizes like the
+ * equivalent hand-written loop.  When the step is only known at run time,
+ * the loop is only vectorized over 64-bit values, whereas GCC also
+ * vectorizes a hand-written loop over 32-bit values by checking for a unit
+ * step at run time; for such kernels, walk the range in blocks (see below).
+ *
+ * The iterators are random access, so the size of a range and the position of
+ * any value in it are available in constant time, e.g., to the parallel
+ * standard algorithms.
  *
- * Long description or discussion goes here.
+ * A range can be split into balanced, contiguous sub-ranges that share its
+ * step, e.g., to hand static partitions of an index space to a thread pool:
+ * \code
+ * auto parts = range(0, n).split(num_threads);
+ * for (auto i : parts[thread_id]) { ... }
+ * \endcode
  *
- * \tparam Integer  The type of the
+ * A range can also be walked in blocks of \c W consecutive values for
+ * explicitly vectorized kernels, with the peel and remainder iterations
+ * expressed as masked blocks (see blocks() and alignedBlocks()).
+ *
+ * \tparam IntegralType  The integral type of the range values
  *
  * \example range/tests/tstRange.cc
  */
@@ -30,14 +63,24 @@ class Range
 {
     using IntegralType_t = std::remove_reference_t<IntegralType>;
     static_assert(std::is_integral_v<IntegralType_t>);
+    static_assert(!std::is_same_v<IntegralType_t, bool>);
 
   public:
     //@{
     //! Public type aliases
-    using iterator = detail::RangeIterator<IntegralType>;
-    using const_iterator = detail::RangeIterator<IntegralType>;
+    using iterator = detail::RangeIterator<IntegralType_t>;
+    using const_iterator = detail::RangeIterator<IntegralType_t>;
+    using value_type = IntegralType_t;
+    using size_type = std::size_t;
+    using difference_type = typename iterator::difference_type;
+    using partitions_type = detail::RangePartitions<Range<IntegralType>>;
     //@}
 
+  private:
+    // Unsigned type used for wrap-free span computations
+    using Unsigned_t
+        = std::common_type_t<std::make_unsigned_t<IntegralType_t>, size_type>;
+
   public:
     // Construct with an ending only (beginning is zero)
     inline Range(IntegralType end);
@@ -63,23 +106,64 @@ class Range
     // Return const ending iterator
     const_iterator cend() const;
 
-    //! Return size of range
-    IntegralType_t size() const { return (m_end - m_begin) / m_step; }
+    //! Return number of values in the range
+    size_type size() const { return m_size; }
+
+    //! Return whether the range is empty
+    bool empty() const { return m_size == 0; }
 
     //! Access begin value
     IntegralType_t beginValue() const { return m_begin; }
 
-    //! Access end value
+    //! Access end value (aligned to the step length, wrapping around past the
+    //! type limits)
     IntegralType_t endValue() const { return m_end; }
 
     //! Access step value
     IntegralType_t step() const { return m_step; }
 
+    //! Access the value at index \p i
+    value_type operator[](size_type i) const
+    {
+        return this->cbegin()[static_cast<difference_type>(i)];
+    }
+
+    // >>> PARTITIONING
+    // Return the sub-range of length values starting at index offset
+    inline Range slice(size_type offset, size_type length) const;
+
+    // Split into count balanced, contiguous sub-ranges
+    inline partitions_type split(size_type count) const;
+
+    // Split into at most count sub-ranges of at least min_grain values
+    inline partitions_type split(size_type count, size_type min_grain) const;
+
+    // >>> BLOCKING
+    // Return blocks of W consecutive values ending with a masked tail
+    template<std::size_t W>
+    inline detail::RangeBlocks<Range, W> blocks() const;
+
+    // Return blocks of W values aligned to the addresses of data[value]
+    template<std::size_t W, typename T>
+    inline detail::RangeBlocks<Range, W> alignedBlocks(const T* data) const;
+
   private:
+    //! Tag selecting the constructor from a precomputed size
+    struct SizedTag
+    {
+    };
+
+    // Construct from a beginning, step and precomputed size
+    inline Range(SizedTag,
+                 IntegralType_t begin,
+                 IntegralType_t step,
+                 size_type size);
+
     // >>> DATA
     IntegralType_t m_begin;
     IntegralType_t m_end;
     IntegralType_t m_step;
+    size_type m_size;
 };
 
 //---------------------------------------------------------------------------//
@@ -92,7 +176,7 @@ inline Range<IntegralType> range(IntegralType end);
 // Create a range spanning begin...end with an optional step length
 template<typename IntegralType>
 inline Range<IntegralType>
-range(IntegralType begin, IntegralType end, IntegralType step);
+range(IntegralType begin, IntegralType end, IntegralType step = 1);
 
 //===========================================================================//
 // INLINE IMPLEMENTATIONS
@@ -119,6 +203,11 @@ Range<IntegralType>::Range(IntegralType end) : Range(0, end)
  * \brief Construct an iterable range with a specific beginning and ending and
  *        optional step length
  *
+ * The step length must be nonzero and point from \p begin towards \p end.
+ * The ending value is rounded up to the next multiple of the step length past
+ * the last value in the range; it wraps around if it is not representable by
+ * \c IntegralType, which does not affect iteration.
+ *
  * \param[in] begin  The beginning value of the range
  * \param[in] end    The ending value of the range
  * \param[in] step   The size of the step for each iteration
@@ -127,12 +216,49 @@ template<typename IntegralType>
 Range<IntegralType>::Range(IntegralType begin,
                            IntegralType end,
                            IntegralType step)
-    : m_begin(begin), m_end(end), m_step(step)
+    : m_begin(begin), m_end(begin), m_step(step), m_size(0)
+{
+    IT_REQUIRE(step != 0);
+    IT_REQUIRE(begin == end || (begin < end) == (step > 0));
+
+    if ((step > 0 && begin < end) || (step < 0 && end < begin))
+    {
+        // Compute the trip count without overflowing the integral type
+        const Unsigned_t span = step > 0
+                                    ? Unsigned_t(end) - Unsigned_t(begin)
+                                    : Unsigned_t(begin) - Unsigned_t(end);
+        const Unsigned_t length
+            = step > 0 ? Unsigned_t(step) : Unsigned_t(0) - Unsigned_t(step);
+        m_size = static_cast<size_type>(span / length + (span % length != 0));
+
+        // Align the ending value with the step
+        m_end = static_cast<IntegralType_t>(
+            Unsigned_t(begin) + Unsigned_t(m_size) * Unsigned_t(step));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct a range from its beginning, step and number of values
+ *
+ * The size is trusted as is; the ending value is aligned from it.
+ *
+ * \param[in] begin  The beginning value of the range
+ * \param[in] step   The size of the step for each iteration
+ * \param[in] size   The number of values in the range
+ */
+template<typename IntegralType>
+Range<IntegralType>::Range(SizedTag,
+                           IntegralType_t begin,
+                           IntegralType_t step,
+                           size_type size)
+    : m_begin(begin)
+    , m_end(static_cast<IntegralType_t>(Unsigned_t(begin)
+                                        + Unsigned_t(size) * Unsigned_t(step)))
+    , m_step(step)
+    , m_size(size)
 {
-    using SignedIntegralType_t = std::add_signed_t<IntegralType_T>;
-    IT_REQUIRE(std::signbit(SignedIntegralType_t(m_end)
-                            - SignedIntegralType_t(m_begin))
-               == std::signbit(m_step));
+    IT_REQUIRE(step != 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -158,7 +284,136 @@ auto Range<IntegralType>::cbegin() const -> const_iterator
 template<typename IntegralType>
 auto Range<IntegralType>::cend() const -> const_iterator
 {
-    return detail::makeRangeIterator(m_end, m_step);
+    return this->cbegin() + static_cast<difference_type>(m_size);
+}
+
+//---------------------------------------------------------------------------//
+// PARTITIONING
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the sub-range of \p length values starting at index
+ *        \p offset
+ *
+ * The sub-range has the same step as this range.
+ *
+ * \param[in] offset  The index of the first value of the sub-range
+ * \param[in] length  The number of values in the sub-range
+ *
+ * \return The contiguous sub-range
+ */
+template<typename IntegralType>
+auto Range<IntegralType>::slice(size_type offset, size_type length) const
+    -> Range
+{
+    IT_REQUIRE(offset <= m_size);
+    IT_REQUIRE(length <= m_size - offset);
+
+    return Range(SizedTag{}, (*this)[offset], m_step, length);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the range into \p count balanced, contiguous sub-ranges
+ *
+ * Exactly \p count partitions are produced; their sizes differ by at most
+ * one, with the longer partitions first.  Partitions are empty when
+ * \p count exceeds the size of the range.  No memory is allocated: each
+ * partition is computed from its index in constant time.
+ *
+ * \param[in] count  The number of partitions (nonzero)
+ *
+ * \return A view of the partitions
+ */
+template<typename IntegralType>
+auto Range<IntegralType>::split(size_type count) const -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+
+    return partitions_type(*this, count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split the range into at most \p count balanced sub-ranges holding
+ *        at least \p min_grain values each
+ *
+ * The number of partitions is reduced so that none is smaller than
+ * \p min_grain; a range smaller than \p min_grain yields a single
+ * partition.
+ *
+ * \param[in] count      The maximum number of partitions (nonzero)
+ * \param[in] min_grain  The minimum number of values in each partition
+ *
+ * \return A view of the partitions
+ */
+template<typename IntegralType>
+auto Range<IntegralType>::split(size_type count, size_type min_grain) const
+    -> partitions_type
+{
+    IT_REQUIRE(count > 0);
+    IT_REQUIRE(min_grain > 0);
+
+    const size_type max_count = std::max<size_type>(m_size / min_grain, 1);
+    return partitions_type(*this, std::min(count, max_count));
+}
+
+//---------------------------------------------------------------------------//
+// BLOCKING
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the range as blocks of \c W consecutive values
+ *
+ * Every block is full except the last one, whose trailing lanes are masked
+ * off when the size of the range is not a multiple of \c W.
+ *
+ * \tparam W  The number of lanes in each block
+ *
+ * \return A view of the blocks
+ */
+template<typename IntegralType>
+template<std::size_t W>
+auto Range<IntegralType>::blocks() const -> detail::RangeBlocks<Range, W>
+{
+    return detail::RangeBlocks<Range, W>(*this, 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the range as blocks of \c W values aligned to the addresses
+ *        of an array indexed by the range
+ *
+ * The first block is shifted down so that its lane 0 addresses
+ * <tt>data + start()</tt> on a boundary of <tt>W * sizeof(T)</tt> bytes; its
+ * lanes preceding the first value are masked off.  Every following block then
+ * starts on such a boundary, so the full blocks can use aligned loads and
+ * stores.  The values of masked lanes in the first block precede the range
+ * and must not be dereferenced other than through a masked (or aligned) load
+ * that cannot fault.
+ *
+ * The range must have a unit step and \p data must be aligned to
+ * <tt>sizeof(T)</tt>.
+ *
+ * \tparam W  The number of lanes in each block (a power of two)
+ * \tparam T  The element type of the array
+ *
+ * \param[in] data  The array indexed by the values of the range
+ *
+ * \return A view of the blocks
+ */
+template<typename IntegralType>
+template<std::size_t W, typename T>
+auto Range<IntegralType>::alignedBlocks(const T* data) const
+    -> detail::RangeBlocks<Range, W>
+{
+    static_assert(W > 0 && (W & (W - 1)) == 0);
+    IT_REQUIRE(m_step == 1);
+    IT_REQUIRE(reinterpret_cast<std::uintptr_t>(data) % sizeof(T) == 0);
+
+    // Position of the first value within its aligned group of W elements
+    const std::uintptr_t element
+        = reinterpret_cast<std::uintptr_t>(data) / sizeof(T)
+          + static_cast<std::uintptr_t>(m_begin);
+    return detail::RangeBlocks<Range, W>(*this, element % W);
 }
 
 //---------------------------------------------------------------------------//
@@ -174,7 +429,7 @@ auto Range<IntegralType>::cend() const -> const_iterator
  * \return An iterable range spanning 0 ... \p end with step size 1
  */
 template<typename IntegralType>
-Range<IntegralType>::range(IntegralType end)
+Range<IntegralType> range(IntegralType end)
 {
     return Range<IntegralType>(end);
 }
@@ -0,0 +1,355 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/SpaceFillingCurves.hh
+ * \brief  MortonCurve and HilbertCurve class declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_SPACEFILLINGCURVES_HH
+#define ITERTOOLS_SRC_RANGE_SPACEFILLINGCURVES_HH
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace itertools
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// BIT INTERLEAVING
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the mask selecting every \c Dims-th bit of a 64-bit code
+ */
+template<std::size_t Dims>
+constexpr std::uint64_t interleaveMask()
+{
+    std::uint64_t mask = 0;
+    for (std::size_t bit = 0; bit < 64; bit += Dims)
+    {
+        mask |= std::uint64_t(1) << bit;
+    }
+    return mask;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Spread the low bits of \p value so that consecutive bits are
+ *        \c Dims positions apart
+ *
+ * With BMI2 this is a single \c pdep instruction; otherwise the two- and
+ * three-dimensional cases use the usual shift-and-mask sequences, and other
+ * dimensions a bit loop.
+ *
+ * \param[in] value  The bits to spread (at most 64 / Dims significant bits)
+ *
+ * \return The spread bits
+ */
+template<std::size_t Dims>
+inline std::uint64_t spreadBits(std::uint64_t value)
+{
+#if defined(__BMI2__)
+    return _pdep_u64(value, interleaveMask<Dims>());
+#else
+    if constexpr (Dims == 1)
+    {
+        return value;
+    }
+    else if constexpr (Dims == 2)
+    {
+        value &= 0x00000000FFFFFFFFull;
+        value = (value | (value << 16)) & 0x0000FFFF0000FFFFull;
+        value = (value | (value << 8)) & 0x00FF00FF00FF00FFull;
+        value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        value = (value | (value << 2)) & 0x3333333333333333ull;
+        value = (value | (value << 1)) & 0x5555555555555555ull;
+        return value;
+    }
+    else if constexpr (Dims == 3)
+    {
+        value &= 0x00000000001FFFFFull;
+        value = (value | (value << 32)) & 0x001F00000000FFFFull;
+        value = (value | (value << 16)) & 0x001F0000FF0000FFull;
+        value = (value | (value << 8)) & 0x100F00F00F00F00Full;
+        value = (value | (value << 4)) & 0x10C30C30C30C30C3ull;
+        value = (value | (value << 2)) & 0x1249249249249249ull;
+        return value;
+    }
+    else
+    {
+        std::uint64_t result = 0;
+        for (std::size_t bit = 0; bit * Dims < 64; ++bit)
+        {
+            result |= ((value >> bit) & 1u) << (bit * Dims);
+        }
+        return result;
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Gather every \c Dims-th bit of \p code into the low bits
+ *
+ * This is the inverse of spreadBits: a single \c pext instruction with BMI2.
+ *
+ * \param[in] code  The spread bits
+ *
+ * \return The compacted bits
+ */
+template<std::size_t Dims>
+inline std::uint64_t compactBits(std::uint64_t code)
+{
+#if defined(__BMI2__)
+    return _pext_u64(code, interleaveMask<Dims>());
+#else
+    if constexpr (Dims == 1)
+    {
+        return code;
+    }
+    else if constexpr (Dims == 2)
+    {
+        code &= 0x5555555555555555ull;
+        code = (code | (code >> 1)) & 0x3333333333333333ull;
+        code = (code | (code >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+        code = (code | (code >> 4)) & 0x00FF00FF00FF00FFull;
+        code = (code | (code >> 8)) & 0x0000FFFF0000FFFFull;
+        code = (code | (code >> 16)) & 0x00000000FFFFFFFFull;
+        return code;
+    }
+    else if constexpr (Dims == 3)
+    {
+        code &= 0x1249249249249249ull;
+        code = (code | (code >> 2)) & 0x10C30C30C30C30C3ull;
+        code = (code | (code >> 4)) & 0x100F00F00F00F00Full;
+        code = (code | (code >> 8)) & 0x001F0000FF0000FFull;
+        code = (code | (code >> 16)) & 0x001F00000000FFFFull;
+        code = (code | (code >> 32)) & 0x00000000001FFFFFull;
+        return code;
+    }
+    else
+    {
+        std::uint64_t result = 0;
+        for (std::size_t bit = 0; bit * Dims < 64; ++bit)
+        {
+            result |= ((code >> (bit * Dims)) & 1u) << bit;
+        }
+        return result;
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Interleave the bits of the coordinates into a single code
+ *
+ * The first coordinate holds the most significant bit of each group of
+ * \c Dims bits, so that the last dimension varies fastest as in row-major
+ * order.
+ *
+ * \param[in] coords  The coordinates
+ *
+ * \return The interleaved code
+ */
+template<std::size_t Dims>
+inline std::uint64_t interleave(const std::array<std::uint64_t, Dims>& coords)
+{
+    std::uint64_t code = 0;
+    for (std::size_t d = 0; d < Dims; ++d)
+    {
+        code |= spreadBits<Dims>(coords[d]) << (Dims - 1 - d);
+    }
+    return code;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Split an interleaved code into its coordinates
+ *
+ * \param[in] code  The interleaved code
+ *
+ * \return The coordinates
+ */
+template<std::size_t Dims>
+inline std::array<std::uint64_t, Dims> deinterleave(std::uint64_t code)
+{
+    std::array<std::uint64_t, Dims> coords;
+    for (std::size_t d = 0; d < Dims; ++d)
+    {
+        coords[d] = compactBits<Dims>(code >> (Dims - 1 - d));
+    }
+    return coords;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//===========================================================================//
+/*!
+ * \struct MortonCurve
+ * \brief The Z-order curve: codes are the interleaved coordinate bits
+ */
+//===========================================================================//
+
+struct MortonCurve
+{
+    //! Coordinates of the point with the given code
+    template<std::size_t Dims>
+    static std::array<std::uint64_t, Dims>
+    decode(std::uint64_t code, unsigned int /* order */)
+    {
+        return detail::deinterleave<Dims>(code);
+    }
+
+    //! Code of the point with the given coordinates
+    template<std::size_t Dims>
+    static std::uint64_t
+    encode(const std::array<std::uint64_t, Dims>& coords,
+           unsigned int /* order */)
+    {
+        return detail::interleave<Dims>(coords);
+    }
+};
+
+//===========================================================================//
+/*!
+ * \struct HilbertCurve
+ * \brief The Hilbert curve over a cube of side <tt>2^order</tt>
+ *
+ * Consecutive points of the curve are always adjacent.  The conversions use
+ * Skilling's transposed representation (J. Skilling, "Programming the
+ * Hilbert curve", AIP Conf. Proc. 707, 2004): the code is the bit interleave
+ * of the transposed coordinates, and the transposition takes \c order passes
+ * of bit operations over the coordinates, without lookup tables.
+ */
+//===========================================================================//
+
+struct HilbertCurve
+{
+    // Coordinates of the point with the given code
+    template<std::size_t Dims>
+    static inline std::array<std::uint64_t, Dims>
+    decode(std::uint64_t code, unsigned int order);
+
+    // Code of the point with the given coordinates
+    template<std::size_t Dims>
+    static inline std::uint64_t
+    encode(std::array<std::uint64_t, Dims> coords, unsigned int order);
+};
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Return the coordinates of the point with Hilbert index \p code
+ *
+ * \param[in] code   The Hilbert index
+ * \param[in] order  The number of bits per coordinate (nonzero)
+ *
+ * \return The coordinates
+ */
+template<std::size_t Dims>
+std::array<std::uint64_t, Dims>
+HilbertCurve::decode(std::uint64_t code, unsigned int order)
+{
+    auto x = detail::deinterleave<Dims>(code);
+
+    // Gray decode
+    const std::uint64_t t = x[Dims - 1] >> 1;
+    for (std::size_t i = Dims - 1; i > 0; --i)
+    {
+        x[i] ^= x[i - 1];
+    }
+    x[0] ^= t;
+
+    // Undo the excess work
+    const std::uint64_t n = std::uint64_t(2) << (order - 1);
+    for (std::uint64_t q = 2; q != n; q <<= 1)
+    {
+        const std::uint64_t p = q - 1;
+        for (std::size_t i = Dims; i-- > 0;)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                const std::uint64_t s = (x[0] ^ x[i]) & p;
+                x[0] ^= s;
+                x[i] ^= s;
+            }
+        }
+    }
+    return x;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the Hilbert index of the point with coordinates \p coords
+ *
+ * \param[in] coords  The coordinates (each less than <tt>2^order</tt>)
+ * \param[in] order   The number of bits per coordinate (nonzero)
+ *
+ * \return The Hilbert index
+ */
+template<std::size_t Dims>
+std::uint64_t HilbertCurve::encode(std::array<std::uint64_t, Dims> coords,
+                                   unsigned int order)
+{
+    auto& x = coords;
+    const std::uint64_t m = std::uint64_t(1) << (order - 1);
+
+    // Inverse undo
+    for (std::uint64_t q = m; q > 1; q >>= 1)
+    {
+        const std::uint64_t p = q - 1;
+        for (std::size_t i = 0; i < Dims; ++i)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                const std::uint64_t s = (x[0] ^ x[i]) & p;
+                x[0] ^= s;
+                x[i] ^= s;
+            }
+        }
+    }
+
+    // Gray encode
+    for (std::size_t i = 1; i < Dims; ++i)
+    {
+        x[i] ^= x[i - 1];
+    }
+    std::uint64_t t = 0;
+    for (std::uint64_t q = m; q > 1; q >>= 1)
+    {
+        if (x[Dims - 1] & q)
+        {
+            t ^= q - 1;
+        }
+    }
+    for (std::size_t i = 0; i < Dims; ++i)
+    {
+        x[i] ^= t;
+    }
+
+    return detail::interleave<Dims>(x);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_SPACEFILLINGCURVES_HH
+//---------------------------------------------------------------------------//
+// end of src/range/SpaceFillingCurves.hh
+//---------------------------------------------------------------------------//
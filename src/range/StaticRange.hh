@@ -0,0 +1,279 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/StaticRange.hh
+ * \brief  StaticRange class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_STATICRANGE_HH
+#define ITERTOOLS_SRC_RANGE_STATICRANGE_HH
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "detail/RangeIterator.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class StaticRange
+ * \brief A range of integral values whose bounds are known at compile time
+ *
+ * StaticRange is meant for tiny, fixed extents such as the points of a
+ * stencil or the components of a small vector.  Its size is a constant
+ * expression, and \c forEach expands the loop body once per value through a
+ * \c std::index_sequence, so the loop is always fully unrolled regardless of
+ * the optimizer's heuristics.  Each invocation receives the value as a
+ * \c std::integral_constant, which converts to the value type and can also be
+ * used where a constant expression is required:
+ * \code
+ * StaticRange<0, 3>::forEach([&](auto d) {
+ *     x[d] += dt * std::get<decltype(d)::value>(velocity);
+ * });
+ * \endcode
+ *
+ * The second form of \c forEach visits <tt>first[v]</tt> for each value \c v
+ * of the range.  It works with any random-access iterator, including
+ * ZipIterator, so fixed-size blocks of zipped streams unroll as well:
+ * \code
+ * StaticRange<0, 8>::forEach(makeZipIter(x, y), [a](auto elem) {
+ *     auto [xi, yi] = elem;
+ *     yi += a * xi;
+ * });
+ * \endcode
+ *
+ * The values follow the same rules as a Range: the step is nonzero, points
+ * from \c Begin towards \c End, and the ending value aligned to the step must
+ * be representable.  A StaticRange also provides RangeIterator iterators for
+ * use with range-based \c for loops and the standard algorithms.
+ *
+ * \tparam Begin  The beginning value
+ * \tparam End    The ending value
+ * \tparam Step   The step length
+ *
+ * \example range/tests/tstStaticRange.cc
+ */
+//===========================================================================//
+
+template<auto Begin, auto End, auto Step = 1>
+class StaticRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using value_type = std::common_type_t<decltype(Begin), decltype(End)>;
+    using iterator = detail::RangeIterator<value_type>;
+    using const_iterator = detail::RangeIterator<value_type>;
+    using size_type = std::size_t;
+    using difference_type = typename iterator::difference_type;
+    //@}
+
+    static_assert(std::is_integral_v<value_type>);
+    static_assert(!std::is_same_v<value_type, bool>);
+    static_assert(std::is_integral_v<decltype(Step)>);
+    static_assert(Step != 0, "StaticRange requires a nonzero step");
+
+  private:
+    // Unsigned type used for wrap-free span computations
+    using Unsigned_t
+        = std::common_type_t<std::make_unsigned_t<value_type>, size_type>;
+
+    // Compute the number of values in the range
+    static constexpr inline size_type computeSize();
+
+    // Compute the value at index i without overflowing the value type
+    static constexpr inline value_type computeValue(size_type i);
+
+  public:
+    //! Return the number of values in the range
+    static constexpr size_type size() { return computeSize(); }
+
+    //! Return whether the range is empty
+    static constexpr bool empty() { return size() == 0; }
+
+    //! The value at index \c I
+    template<size_type I>
+    static constexpr value_type value = computeValue(I);
+
+    //! Access begin value
+    static constexpr value_type beginValue() { return computeValue(0); }
+
+    //! Access end value (aligned to the step length)
+    static constexpr value_type endValue() { return computeValue(size()); }
+
+    //! Access step value
+    static constexpr value_type step()
+    {
+        return static_cast<value_type>(Step);
+    }
+
+    //! Return beginning iterator
+    const_iterator begin() const { return this->cbegin(); }
+
+    //! Return const beginning iterator
+    const_iterator cbegin() const
+    {
+        return detail::makeRangeIterator(beginValue(), step());
+    }
+
+    //! Return ending iterator
+    const_iterator end() const { return this->cend(); }
+
+    //! Return const ending iterator
+    const_iterator cend() const
+    {
+        return this->cbegin() + static_cast<difference_type>(size());
+    }
+
+    // >>> UNROLLED ITERATION
+    // Apply a function to each value as a std::integral_constant
+    template<typename Function>
+    static constexpr inline void forEach(Function&& function);
+
+    // Apply a function to first[v] for each value v
+    template<typename Iterator, typename Function>
+    static constexpr inline void forEach(Iterator first, Function&& function);
+
+  private:
+    template<typename Function, size_type... I>
+    static constexpr inline void
+    forEachImpl(Function& function, std::index_sequence<I...>);
+
+    template<typename Iterator, typename Function, size_type... I>
+    static constexpr inline void forEachImpl(Iterator& first,
+                                             Function& function,
+                                             std::index_sequence<I...>);
+};
+
+//===========================================================================//
+// INLINE IMPLEMENTATIONS
+//===========================================================================//
+/*!
+ * \brief Compute the number of values in the range
+ *
+ * The bounds are checked at compile time, with the same requirements as the
+ * constructor of Range.
+ *
+ * \return The number of values
+ */
+template<auto Begin, auto End, auto Step>
+constexpr auto StaticRange<Begin, End, Step>::computeSize() -> size_type
+{
+    constexpr auto begin = static_cast<value_type>(Begin);
+    constexpr auto end = static_cast<value_type>(End);
+    static_assert(begin == end || (begin < end) == (Step > 0),
+                  "StaticRange step must point from Begin towards End");
+
+    if constexpr (begin == end)
+    {
+        return 0;
+    }
+    else
+    {
+        constexpr Unsigned_t span = Step > 0
+                                        ? Unsigned_t(end) - Unsigned_t(begin)
+                                        : Unsigned_t(begin) - Unsigned_t(end);
+        constexpr Unsigned_t length = Step > 0 ? Unsigned_t(Step)
+                                               : Unsigned_t(0)
+                                                     - Unsigned_t(Step);
+        constexpr auto count
+            = static_cast<size_type>(span / length + (span % length != 0));
+
+        // The aligned ending value must be representable
+        using Limits_t = std::numeric_limits<value_type>;
+        constexpr Unsigned_t room
+            = Step > 0 ? Unsigned_t(Limits_t::max()) - Unsigned_t(begin)
+                       : Unsigned_t(begin) - Unsigned_t(Limits_t::min());
+        static_assert(room / length >= count,
+                      "StaticRange aligned end is not representable");
+        return count;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the value at index \p i
+ *
+ * \param[in] i  The index of the value
+ *
+ * \return The value <tt>Begin + i * Step</tt>
+ */
+template<auto Begin, auto End, auto Step>
+constexpr auto StaticRange<Begin, End, Step>::computeValue(size_type i)
+    -> value_type
+{
+    return static_cast<value_type>(Unsigned_t(static_cast<value_type>(Begin))
+                                   + Unsigned_t(i) * Unsigned_t(Step));
+}
+
+//---------------------------------------------------------------------------//
+// UNROLLED ITERATION
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply \p function to each value of the range
+ *
+ * The calls are expanded at compile time, in order.  Each call receives a
+ * <tt>std::integral_constant<value_type, v></tt> for the value \c v.
+ *
+ * \param[in] function  The function applied to each value
+ */
+template<auto Begin, auto End, auto Step>
+template<typename Function>
+constexpr void StaticRange<Begin, End, Step>::forEach(Function&& function)
+{
+    forEachImpl(function, std::make_index_sequence<size()>());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply \p function to <tt>first[v]</tt> for each value \c v of the
+ *        range
+ *
+ * The calls are expanded at compile time, in order.
+ *
+ * \param[in] first     A random-access iterator, e.g., a pointer or a
+ *                      ZipIterator
+ * \param[in] function  The function applied to each element
+ */
+template<auto Begin, auto End, auto Step>
+template<typename Iterator, typename Function>
+constexpr void
+StaticRange<Begin, End, Step>::forEach(Iterator first, Function&& function)
+{
+    forEachImpl(first, function, std::make_index_sequence<size()>());
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+template<auto Begin, auto End, auto Step>
+template<typename Function, std::size_t... I>
+constexpr void
+StaticRange<Begin, End, Step>::forEachImpl(Function& function,
+                                           std::index_sequence<I...>)
+{
+    (function(std::integral_constant<value_type, value<I>>{}), ...);
+}
+
+//---------------------------------------------------------------------------//
+template<auto Begin, auto End, auto Step>
+template<typename Iterator, typename Function, std::size_t... I>
+constexpr void
+StaticRange<Begin, End, Step>::forEachImpl(Iterator& first,
+                                           Function& function,
+                                           std::index_sequence<I...>)
+{
+    (function(first[static_cast<difference_type>(value<I>)]), ...);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_STATICRANGE_HH
+//---------------------------------------------------------------------------//
+// end of src/range/StaticRange.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,74 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/benchmarks/bchNdRange.cc
+ * \brief  Benchmarks for class NdRange.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../NdRange.hh"
+
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+constexpr std::ptrdiff_t extent = 2048;
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Out-of-place transpose with hand-written nested loops
+void BM_NestedTranspose(benchmark::State& state)
+{
+    std::vector<double> a(extent * extent, 1.0), b(extent * extent);
+    const double* ap = a.data();
+    double* bp = b.data();
+
+    for (auto _ : state)
+    {
+        for (std::ptrdiff_t i = 0; i < extent; ++i)
+        {
+            for (std::ptrdiff_t j = 0; j < extent; ++j)
+            {
+                bp[j * extent + i] = ap[i * extent + j];
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * sizeof(double)
+                            * extent * extent);
+}
+BENCHMARK(BM_NestedTranspose);
+
+//---------------------------------------------------------------------------//
+// Out-of-place transpose over a tiled NdRange (tile extent as argument)
+void BM_TiledTranspose(benchmark::State& state)
+{
+    std::vector<double> a(extent * extent, 1.0), b(extent * extent);
+    const double* ap = a.data();
+    double* bp = b.data();
+
+    const auto tile = static_cast<std::size_t>(state.range(0));
+    const auto r = itertools::ndRange(extent, extent).tiled({tile, tile});
+    for (auto _ : state)
+    {
+        for (auto [i, j] : r)
+        {
+            bp[j * extent + i] = ap[i * extent + j];
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * sizeof(double)
+                            * extent * extent);
+}
+BENCHMARK(BM_TiledTranspose)->Arg(extent)->Arg(64)->Arg(32)->Arg(16)->Arg(8);
+
+//---------------------------------------------------------------------------//
+// end of src/range/benchmarks/bchNdRange.cc
+//---------------------------------------------------------------------------//
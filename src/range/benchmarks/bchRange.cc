@@ -0,0 +1,216 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/benchmarks/bchRange.cc
+ * \brief  Benchmarks for class Range.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Range.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+// Bytes loaded and stored per element by the kernel y = 2 x + y
+constexpr std::int64_t bytes_per_element = 3 * sizeof(float);
+
+// Largest ending value for type T that keeps the aligned end representable
+template<typename T>
+T extent(T step)
+{
+    return static_cast<T>(std::min<std::uint64_t>(
+        4096, std::uint64_t(std::numeric_limits<T>::max() - step)));
+}
+
+// Beginning and ending values of a loop with the given step: upwards from
+// zero for a positive step, downwards to zero for a negative one
+template<typename T>
+std::pair<T, T> bounds(T step)
+{
+    if (step > 0)
+    {
+        return {T(0), extent<T>(step)};
+    }
+    return {static_cast<T>(extent<T>(static_cast<T>(-step)) - 1), T(-1)};
+}
+
+// Number of passes over a range of the given size so that each benchmark
+// iteration processes about 4096 elements: the ranges of the 8-bit types are
+// otherwise too short to be timed apart from the measurement noise
+inline std::int64_t sweeps(std::int64_t count)
+{
+    return std::max<std::int64_t>(1, 4096 / std::max<std::int64_t>(1, count));
+}
+
+// Positive steps for every type, negative steps for the signed ones
+template<typename T>
+void steps(benchmark::internal::Benchmark* bench)
+{
+    bench->Arg(1)->Arg(3);
+    if (std::is_signed_v<T>)
+    {
+        bench->Arg(-1)->Arg(-3);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Hand-written strided loop, with a step of type T or, to make it known at
+// compile time, std::integral_constant
+template<typename T, typename Step>
+void rawLoop(benchmark::State& state, Step step_value)
+{
+    const T step = step_value;
+    const auto [begin, end] = bounds<T>(step);
+    std::vector<float> x(4096, 1.0f), y(4096, 2.0f);
+    float* xp = x.data();
+    float* yp = y.data();
+
+    std::int64_t count = 0;
+    for (T i = begin; step > 0 ? i < end : i > end; i += step)
+    {
+        ++count;
+    }
+    const std::int64_t passes = sweeps(count);
+
+    if (step > 0)
+    {
+        for (auto _ : state)
+        {
+            for (std::int64_t pass = 0; pass < passes; ++pass)
+            {
+                for (T i = begin; i < end; i += step)
+                {
+                    const auto k = static_cast<std::ptrdiff_t>(i);
+                    yp[k] = 2.0f * xp[k] + yp[k];
+                }
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+    else
+    {
+        for (auto _ : state)
+        {
+            for (std::int64_t pass = 0; pass < passes; ++pass)
+            {
+                for (T i = begin; i > end; i += step)
+                {
+                    const auto k = static_cast<std::ptrdiff_t>(i);
+                    yp[k] = 2.0f * xp[k] + yp[k];
+                }
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+    itertools::bench::setThroughputCounters(
+        state, passes * count, bytes_per_element);
+}
+
+//---------------------------------------------------------------------------//
+// Strided loop over a Range, with a step as for rawLoop
+template<typename T, typename Step>
+void rangeLoop(benchmark::State& state, Step step_value)
+{
+    const T step = step_value;
+    const auto [begin, end] = bounds<T>(step);
+    std::vector<float> x(4096, 1.0f), y(4096, 2.0f);
+    float* xp = x.data();
+    float* yp = y.data();
+
+    const auto r = itertools::range(begin, end, step);
+    const auto count = static_cast<std::int64_t>(r.size());
+    const std::int64_t passes = sweeps(count);
+    for (auto _ : state)
+    {
+        for (std::int64_t pass = 0; pass < passes; ++pass)
+        {
+            for (auto i : r)
+            {
+                const auto k = static_cast<std::ptrdiff_t>(i);
+                yp[k] = 2.0f * xp[k] + yp[k];
+            }
+            benchmark::ClobberMemory();
+        }
+    }
+    itertools::bench::setThroughputCounters(
+        state, passes * count, bytes_per_element);
+}
+
+//---------------------------------------------------------------------------//
+// Loops with a step known at run time, which are not vectorized
+template<typename T>
+void BM_RawLoop(benchmark::State& state)
+{
+    rawLoop<T>(state, static_cast<T>(state.range(0)));
+}
+
+template<typename T>
+void BM_RangeLoop(benchmark::State& state)
+{
+    rangeLoop<T>(state, static_cast<T>(state.range(0)));
+}
+
+//---------------------------------------------------------------------------//
+// Loops with a step known at compile time, which are vectorized
+template<typename T, T Step>
+void BM_RawFixedLoop(benchmark::State& state)
+{
+    rawLoop<T>(state, std::integral_constant<T, Step>{});
+}
+
+template<typename T, T Step>
+void BM_RangeFixedLoop(benchmark::State& state)
+{
+    rangeLoop<T>(state, std::integral_constant<T, Step>{});
+}
+
+//---------------------------------------------------------------------------//
+// REGISTRATION
+//---------------------------------------------------------------------------//
+
+#define ITERTOOLS_RANGE_BENCHMARKS(T)                   \
+    BENCHMARK_TEMPLATE(BM_RawLoop, T)->Apply(steps<T>); \
+    BENCHMARK_TEMPLATE(BM_RangeLoop, T)->Apply(steps<T>)
+
+#define ITERTOOLS_FIXED_RANGE_BENCHMARKS(T, STEP)  \
+    BENCHMARK_TEMPLATE(BM_RawFixedLoop, T, STEP); \
+    BENCHMARK_TEMPLATE(BM_RangeFixedLoop, T, STEP)
+
+ITERTOOLS_RANGE_BENCHMARKS(char);
+ITERTOOLS_RANGE_BENCHMARKS(std::int8_t);
+ITERTOOLS_RANGE_BENCHMARKS(std::uint8_t);
+ITERTOOLS_RANGE_BENCHMARKS(std::int16_t);
+ITERTOOLS_RANGE_BENCHMARKS(std::uint16_t);
+ITERTOOLS_RANGE_BENCHMARKS(std::int32_t);
+ITERTOOLS_RANGE_BENCHMARKS(std::uint32_t);
+ITERTOOLS_RANGE_BENCHMARKS(std::int64_t);
+ITERTOOLS_RANGE_BENCHMARKS(std::uint64_t);
+
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::int16_t, 1);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::uint16_t, 1);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::int32_t, 1);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::int32_t, 3);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::int32_t, -1);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::uint32_t, 1);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::int64_t, 1);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::int64_t, 3);
+ITERTOOLS_FIXED_RANGE_BENCHMARKS(std::uint64_t, 1);
+
+//---------------------------------------------------------------------------//
+// end of src/range/benchmarks/bchRange.cc
+//---------------------------------------------------------------------------//
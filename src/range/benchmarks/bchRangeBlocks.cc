@@ -0,0 +1,315 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/benchmarks/bchRangeBlocks.cc
+ * \brief  Benchmarks for the block iteration of class Range.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Range.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ITERTOOLS_BENCH_X86 1
+#include <immintrin.h>
+#else
+#define ITERTOOLS_BENCH_X86 0
+#endif
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+using Range_t = itertools::Range<std::ptrdiff_t>;
+
+// Kernel computing y = a * x + y over the values of a range
+using Kernel_t = void (*)(const Range_t&, float, const float*, float*);
+
+// Padding before the arrays, so the aligned leading block stays in bounds
+constexpr std::ptrdiff_t padding = 16;
+
+//---------------------------------------------------------------------------//
+// Scalar kernel over the RangeIterator values
+void saxpyScalar(const Range_t& r, float a, const float* x, float* y)
+{
+    for (auto i : r)
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+#if ITERTOOLS_BENCH_X86
+//---------------------------------------------------------------------------//
+// SSE2 kernel: full blocks in registers, partial blocks with scalar lanes
+template<bool Aligned>
+__attribute__((target("sse2"))) void
+saxpySse2(const Range_t& r, float a, const float* x, float* y)
+{
+    const __m128 va = _mm_set1_ps(a);
+    const auto blocks = Aligned ? r.alignedBlocks<4>(y) : r.blocks<4>();
+    for (auto block : blocks)
+    {
+        if (block.full())
+        {
+            const float* xp = x + block.start();
+            float* yp = y + block.start();
+            if constexpr (Aligned)
+            {
+                _mm_store_ps(yp,
+                             _mm_add_ps(_mm_mul_ps(va, _mm_load_ps(xp)),
+                                        _mm_load_ps(yp)));
+            }
+            else
+            {
+                _mm_storeu_ps(yp,
+                              _mm_add_ps(_mm_mul_ps(va, _mm_loadu_ps(xp)),
+                                         _mm_loadu_ps(yp)));
+            }
+        }
+        else
+        {
+            for (auto i : block)
+            {
+                y[i] = a * x[i] + y[i];
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// AVX2 kernel: partial blocks with masked loads and stores
+template<bool Aligned>
+__attribute__((target("avx2,fma"))) void
+saxpyAvx2(const Range_t& r, float a, const float* x, float* y)
+{
+    const __m256 va = _mm256_set1_ps(a);
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const auto blocks = Aligned ? r.alignedBlocks<8>(y) : r.blocks<8>();
+    for (auto block : blocks)
+    {
+        const float* xp = x + block.start();
+        float* yp = y + block.start();
+        if (block.full())
+        {
+            if constexpr (Aligned)
+            {
+                _mm256_store_ps(yp,
+                                _mm256_fmadd_ps(va,
+                                                _mm256_load_ps(xp),
+                                                _mm256_load_ps(yp)));
+            }
+            else
+            {
+                _mm256_storeu_ps(yp,
+                                 _mm256_fmadd_ps(va,
+                                                 _mm256_loadu_ps(xp),
+                                                 _mm256_loadu_ps(yp)));
+            }
+        }
+        else
+        {
+            const int first = static_cast<int>(block.firstLane());
+            const int last = static_cast<int>(block.lastLane());
+            const __m256i mask = _mm256_and_si256(
+                _mm256_cmpgt_epi32(lanes, _mm256_set1_epi32(first - 1)),
+                _mm256_cmpgt_epi32(_mm256_set1_epi32(last), lanes));
+            _mm256_maskstore_ps(yp,
+                                mask,
+                                _mm256_fmadd_ps(va,
+                                                _mm256_maskload_ps(xp, mask),
+                                                _mm256_maskload_ps(yp, mask)));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// AVX-512 kernel: partial blocks with the block mask as a mask register
+template<bool Aligned>
+__attribute__((target("avx512f"))) void
+saxpyAvx512(const Range_t& r, float a, const float* x, float* y)
+{
+    const __m512 va = _mm512_set1_ps(a);
+    const auto blocks = Aligned ? r.alignedBlocks<16>(y) : r.blocks<16>();
+    for (auto block : blocks)
+    {
+        const float* xp = x + block.start();
+        float* yp = y + block.start();
+        if (block.full())
+        {
+            if constexpr (Aligned)
+            {
+                _mm512_store_ps(yp,
+                                _mm512_fmadd_ps(va,
+                                                _mm512_load_ps(xp),
+                                                _mm512_load_ps(yp)));
+            }
+            else
+            {
+                _mm512_storeu_ps(yp,
+                                 _mm512_fmadd_ps(va,
+                                                 _mm512_loadu_ps(xp),
+                                                 _mm512_loadu_ps(yp)));
+            }
+        }
+        else
+        {
+            const auto mask = static_cast<__mmask16>(block.mask());
+            _mm512_mask_storeu_ps(
+                yp,
+                mask,
+                _mm512_fmadd_ps(va,
+                                _mm512_maskz_loadu_ps(mask, xp),
+                                _mm512_maskz_loadu_ps(mask, yp)));
+        }
+    }
+}
+#endif
+
+//---------------------------------------------------------------------------//
+// Instruction sets of the kernels
+enum class Isa
+{
+    scalar,
+    sse2,
+    avx2,
+    avx512
+};
+
+//---------------------------------------------------------------------------//
+// Whether the running processor supports an instruction set
+bool supports(Isa isa)
+{
+#if ITERTOOLS_BENCH_X86
+    switch (isa)
+    {
+        case Isa::sse2:
+            return __builtin_cpu_supports("sse2");
+        case Isa::avx2:
+            return __builtin_cpu_supports("avx2")
+                   && __builtin_cpu_supports("fma");
+        case Isa::avx512:
+            return __builtin_cpu_supports("avx512f");
+        default:
+            return true;
+    }
+#else
+    return isa == Isa::scalar;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// Return the kernel for an instruction set
+template<bool Aligned>
+Kernel_t kernel(Isa isa)
+{
+#if ITERTOOLS_BENCH_X86
+    switch (isa)
+    {
+        case Isa::sse2:
+            return saxpySse2<Aligned>;
+        case Isa::avx2:
+            return saxpyAvx2<Aligned>;
+        case Isa::avx512:
+            return saxpyAvx512<Aligned>;
+        default:
+            return saxpyScalar;
+    }
+#else
+    return saxpyScalar;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// Return the widest instruction set supported at run time
+Isa widestIsa()
+{
+    for (Isa isa : {Isa::avx512, Isa::avx2, Isa::sse2})
+    {
+        if (supports(isa))
+        {
+            return isa;
+        }
+    }
+    return Isa::scalar;
+}
+
+//---------------------------------------------------------------------------//
+// Run a kernel over arrays one element past a 64-byte boundary
+void run(benchmark::State& state, Kernel_t saxpy)
+{
+    const auto n = static_cast<std::ptrdiff_t>(state.range(0));
+    std::vector<float> xs(n + 2 * padding, 1.0f), ys(n + 2 * padding, 2.0f);
+
+    // Give both arrays the same misalignment
+    const auto offset = [](const std::vector<float>& v) {
+        const auto address = reinterpret_cast<std::uintptr_t>(v.data());
+        return padding - static_cast<std::ptrdiff_t>(address % 64) / 4 + 1;
+    };
+    const float* x = xs.data() + offset(xs);
+    float* y = ys.data() + offset(ys);
+
+    const auto r = itertools::range(n);
+    for (auto _ : state)
+    {
+        saxpy(r, 0.5f, x, y);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Scalar loop over a Range
+void BM_ScalarLoop(benchmark::State& state)
+{
+    run(state, saxpyScalar);
+}
+
+//---------------------------------------------------------------------------//
+// Block loop with explicit SIMD for one instruction set
+template<Isa I, bool Aligned>
+void BM_BlockLoop(benchmark::State& state)
+{
+    if (!supports(I))
+    {
+        state.SkipWithError("instruction set not supported");
+        return;
+    }
+    run(state, kernel<Aligned>(I));
+}
+
+//---------------------------------------------------------------------------//
+// Block loop with the widest instruction set selected at run time
+template<bool Aligned>
+void BM_Dispatched(benchmark::State& state)
+{
+    static const Kernel_t saxpy = kernel<Aligned>(widestIsa());
+    run(state, saxpy);
+}
+
+//---------------------------------------------------------------------------//
+// REGISTRATION
+//---------------------------------------------------------------------------//
+
+#define ITERTOOLS_BLOCK_ARGS ->Arg(1021)->Arg(4093)->Arg(65521)
+
+BENCHMARK(BM_ScalarLoop) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_BlockLoop, Isa::sse2, false) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_BlockLoop, Isa::sse2, true) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_BlockLoop, Isa::avx2, false) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_BlockLoop, Isa::avx2, true) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_BlockLoop, Isa::avx512, false) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_BlockLoop, Isa::avx512, true) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_Dispatched, false) ITERTOOLS_BLOCK_ARGS;
+BENCHMARK_TEMPLATE(BM_Dispatched, true) ITERTOOLS_BLOCK_ARGS;
+
+//---------------------------------------------------------------------------//
+// end of src/range/benchmarks/bchRangeBlocks.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,250 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/detail/CurveIterator.hh
+ * \brief  CurveIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_DETAIL_CURVEITERATOR_HH
+#define ITERTOOLS_SRC_RANGE_DETAIL_CURVEITERATOR_HH
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "core/DBC.hh"
+#include "RangeIterator.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class CurveIterator
+ * \brief Iterates over the index tuples of a CurveRange in curve order
+ *
+ * The iterator walks the curve codes with a RangeIterator and decodes each
+ * code into a point.  The curve covers the power-of-two cube bounding the
+ * index space; codes of points outside the index space are skipped.  Both
+ * the Morton and Hilbert curves map each aligned block of
+ * <tt>2^(Dims * level)</tt> consecutive codes onto an aligned cube of side
+ * <tt>2^level</tt>, so an outside point skips the largest such block lying
+ * entirely outside the index space in one step.
+ *
+ * Iterators refer to their CurveRange, which must outlive them.
+ *
+ * \tparam CurveRangeType  The CurveRange type being traversed
+ *
+ * \example range/tests/tstCurveRange.cc
+ */
+//===========================================================================//
+
+template<typename CurveRangeType>
+class CurveIterator
+{
+  public:
+    //! Public type aliases
+    using This = CurveIterator<CurveRangeType>;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename CurveRangeType::value_type;
+    using reference = value_type;
+    using pointer = void;
+    using iterator_category = std::forward_iterator_tag;
+    using code_type = std::uint64_t;
+
+  private:
+    //! Number of dimensions
+    static constexpr std::size_t num_dims = CurveRangeType::dims();
+
+    //! Zero-based coordinates of a point
+    using Point_t = std::array<std::uint64_t, num_dims>;
+
+  public:
+    // Default constructor
+    CurveIterator() = default;
+
+    // Construct with the traversed range and a curve code
+    inline CurveIterator(const CurveRangeType* range,
+                         RangeIterator<code_type> code);
+
+    // >>> INCREMENT
+    // Pre-increment
+    inline This& operator++();
+
+    // Post-increment
+    inline This operator++(int);
+
+    // >>> DEREFERENCE
+    // Dereference
+    inline reference operator*() const;
+
+    // >>> ACCESSORS
+    //! Return the curve code of the current point
+    code_type code() const { return *m_code; }
+
+    //! Return the zero-based coordinates of the current point
+    const Point_t& point() const { return m_point; }
+
+    //! Equality
+    bool operator==(const This& other) const
+    {
+        return m_code == other.m_code;
+    }
+
+    //! Inequality
+    bool operator!=(const This& other) const { return !(*this == other); }
+
+  private:
+    // Decode the current code, skipping codes outside the index space
+    inline void settle();
+
+    // Whether the aligned cube of side 2^level holding the point is outside
+    inline bool outside(unsigned int level) const;
+
+    // >>> DATA
+    //! The traversed range
+    const CurveRangeType* m_range = nullptr;
+
+    //! The current curve code
+    RangeIterator<code_type> m_code;
+
+    //! The coordinates of the current point
+    Point_t m_point = {};
+};
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Construct with the traversed range and a curve code
+ *
+ * The iterator moves on to the first code at or after \p code that lies in
+ * the index space.
+ *
+ * \param[in] range  The traversed range
+ * \param[in] code   Iterator to a code of the range's curve
+ */
+template<typename CurveRangeType>
+CurveIterator<CurveRangeType>::CurveIterator(const CurveRangeType* range,
+                                             RangeIterator<code_type> code)
+    : m_range(range), m_code(code)
+{
+    IT_REQUIRE(range);
+
+    this->settle();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance to the next point of the curve in the index space
+ *
+ * \return A reference to this iterator after the increment
+ */
+template<typename CurveRangeType>
+auto CurveIterator<CurveRangeType>::operator++() -> This&
+{
+    IT_REQUIRE(m_code != m_range->codes().end());
+
+    ++m_code;
+    this->settle();
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-increment
+ *
+ * \return A copy of this iterator before the increment
+ */
+template<typename CurveRangeType>
+auto CurveIterator<CurveRangeType>::operator++(int) -> This
+{
+    This copy = *this;
+    ++(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the index tuple of the current point
+ *
+ * \return The values of each dimension's Range at the current coordinates
+ */
+template<typename CurveRangeType>
+auto CurveIterator<CurveRangeType>::operator*() const -> reference
+{
+    value_type result;
+    for (std::size_t d = 0; d < num_dims; ++d)
+    {
+        result[d] = m_range->dimension(d)[m_point[d]];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Decode the current code, skipping codes outside the index space
+ */
+template<typename CurveRangeType>
+void CurveIterator<CurveRangeType>::settle()
+{
+    using Curve_t = typename CurveRangeType::curve_type;
+
+    const auto last = m_range->codes().end();
+    const unsigned int order = m_range->order();
+    while (m_code != last)
+    {
+        m_point = Curve_t::template decode<num_dims>(*m_code, order);
+        if (!this->outside(0))
+        {
+            return;
+        }
+
+        // Skip the largest aligned block of codes outside the index space
+        unsigned int level = 0;
+        while (level < order && this->outside(level + 1))
+        {
+            ++level;
+        }
+        const code_type block = code_type(1) << (num_dims * level);
+        const code_type next = (*m_code & ~(block - 1)) + block;
+        m_code += static_cast<difference_type>(next - *m_code);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Whether the aligned cube of side <tt>2^level</tt> holding the
+ *        current point lies entirely outside the index space
+ *
+ * \param[in] level  The base-two logarithm of the cube side
+ *
+ * \return True if the cube's lowest corner is outside the index space
+ */
+template<typename CurveRangeType>
+bool CurveIterator<CurveRangeType>::outside(unsigned int level) const
+{
+    const auto& extents = m_range->extents();
+    for (std::size_t d = 0; d < num_dims; ++d)
+    {
+        if (((m_point[d] >> level) << level) >= extents[d])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_DETAIL_CURVEITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/range/detail/CurveIterator.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,533 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/detail/NdRangeIterator.hh
+ * \brief  NdRangeIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_DETAIL_NDRANGEITERATOR_HH
+#define ITERTOOLS_SRC_RANGE_DETAIL_NDRANGEITERATOR_HH
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+#include "core/DBC.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class NdRangeIterator
+ * \brief Iterates over the index tuples of an NdRange in tiled order
+ *
+ * The iterator stores its position in the traversal order along with the
+ * per-dimension indices of the current point, and the origin and extent of
+ * the current tile.  Incrementing only touches the innermost dimensions in
+ * the common case; moving to the next tile resets the indices to the tile
+ * origin.  Random access recomputes the tile and point from the position
+ * with a constant number of divisions per dimension, so the parallel loops
+ * can split a traversal anywhere.
+ *
+ * Iterators refer to their NdRange, which must outlive them.  Two iterators
+ * compare through their positions only.
+ *
+ * \tparam NdRangeType  The NdRange type being traversed
+ *
+ * \example range/tests/tstNdRange.cc
+ */
+//===========================================================================//
+
+template<typename NdRangeType>
+class NdRangeIterator
+{
+  public:
+    //! Public type aliases
+    using This = NdRangeIterator<NdRangeType>;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename NdRangeType::value_type;
+    using reference = value_type;
+    using pointer = void;
+    using iterator_category = std::random_access_iterator_tag;
+    using size_type = std::size_t;
+
+  private:
+    //! Number of dimensions
+    static constexpr size_type num_dims = NdRangeType::dims();
+
+    //! Per-dimension unsigned indices
+    using Indices_t = std::array<size_type, num_dims>;
+
+  public:
+    // Default constructor
+    NdRangeIterator() = default;
+
+    // Construct with the traversed range and a position in traversal order
+    inline NdRangeIterator(const NdRangeType* range, size_type position);
+
+    // >>> INCREMENT
+    // Pre-increment
+    inline This& operator++();
+
+    // Post-increment
+    inline This operator++(int);
+
+    // >>> DECREMENT
+    // Pre-decrement
+    inline This& operator--();
+
+    // Post-decrement
+    inline This operator--(int);
+
+    // >>> DEREFERENCE, INDEXING
+    // Dereference
+    inline reference operator*() const;
+
+    //! Indexing
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    // >>> COMPOUND ARITHMETIC
+    // Compound arithmetic operators
+    inline This& operator+=(difference_type n);
+    inline This& operator-=(difference_type n);
+
+    // >>> ACCESSORS
+    //! Return the position in traversal order
+    size_type position() const { return m_position; }
+
+    //! Return the zero-based per-dimension indices of the current point
+    const Indices_t& indices() const { return m_index; }
+
+  private:
+    // Compute the tile and point at the current position
+    inline void locate();
+
+    // >>> DATA
+    //! The traversed range
+    const NdRangeType* m_range = nullptr;
+
+    //! Position in traversal order
+    size_type m_position = 0;
+
+    //! Zero-based indices of the current point
+    Indices_t m_index = {};
+
+    //! Zero-based origin of the current tile
+    Indices_t m_origin = {};
+
+    //! Extent of the current tile
+    Indices_t m_extent = {};
+};
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+// Sum between an iterator and a distance
+template<typename NdRangeType>
+inline NdRangeIterator<NdRangeType>
+operator+(NdRangeIterator<NdRangeType> iter,
+          typename NdRangeIterator<NdRangeType>::difference_type n);
+
+// Sum between a distance and an iterator
+template<typename NdRangeType>
+inline NdRangeIterator<NdRangeType>
+operator+(typename NdRangeIterator<NdRangeType>::difference_type n,
+          NdRangeIterator<NdRangeType> iter);
+
+// Difference between an iterator and a distance
+template<typename NdRangeType>
+inline NdRangeIterator<NdRangeType>
+operator-(NdRangeIterator<NdRangeType> iter,
+          typename NdRangeIterator<NdRangeType>::difference_type n);
+
+// Distance between two iterators
+template<typename NdRangeType>
+inline typename NdRangeIterator<NdRangeType>::difference_type
+operator-(const NdRangeIterator<NdRangeType>& iter1,
+          const NdRangeIterator<NdRangeType>& iter2);
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+template<typename NdRangeType>
+inline bool operator==(const NdRangeIterator<NdRangeType>& iter1,
+                       const NdRangeIterator<NdRangeType>& iter2);
+
+template<typename NdRangeType>
+inline bool operator!=(const NdRangeIterator<NdRangeType>& iter1,
+                       const NdRangeIterator<NdRangeType>& iter2);
+
+template<typename NdRangeType>
+inline bool operator<(const NdRangeIterator<NdRangeType>& iter1,
+                      const NdRangeIterator<NdRangeType>& iter2);
+
+template<typename NdRangeType>
+inline bool operator<=(const NdRangeIterator<NdRangeType>& iter1,
+                       const NdRangeIterator<NdRangeType>& iter2);
+
+template<typename NdRangeType>
+inline bool operator>(const NdRangeIterator<NdRangeType>& iter1,
+                      const NdRangeIterator<NdRangeType>& iter2);
+
+template<typename NdRangeType>
+inline bool operator>=(const NdRangeIterator<NdRangeType>& iter1,
+                       const NdRangeIterator<NdRangeType>& iter2);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Construct with the traversed range and a position
+ *
+ * \param[in] range     The traversed range
+ * \param[in] position  The position in traversal order
+ */
+template<typename NdRangeType>
+NdRangeIterator<NdRangeType>::NdRangeIterator(const NdRangeType* range,
+                                              size_type position)
+    : m_range(range), m_position(position)
+{
+    IT_REQUIRE(range);
+    IT_REQUIRE(position <= range->count());
+
+    this->locate();
+}
+
+//---------------------------------------------------------------------------//
+// INCREMENT
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance to the next point of the traversal
+ *
+ * The innermost dimension of the tile is advanced first; when the whole tile
+ * has been visited, the tile origin advances the same way over the tile grid.
+ *
+ * \return A reference to this iterator after the increment
+ */
+template<typename NdRangeType>
+auto NdRangeIterator<NdRangeType>::operator++() -> This&
+{
+    IT_REQUIRE(m_position < m_range->count());
+
+    ++m_position;
+
+    // Next point within the tile
+    for (size_type d = num_dims; d-- > 0;)
+    {
+        if (++m_index[d] < m_origin[d] + m_extent[d])
+        {
+            return *this;
+        }
+        m_index[d] = m_origin[d];
+    }
+
+    // Next tile
+    const auto& extents = m_range->extents();
+    const auto& tile = m_range->tile();
+    for (size_type d = num_dims; d-- > 0;)
+    {
+        m_origin[d] += tile[d];
+        if (m_origin[d] < extents[d])
+        {
+            m_extent[d] = std::min(tile[d], extents[d] - m_origin[d]);
+            std::copy(
+                m_origin.begin() + d, m_origin.end(), m_index.begin() + d);
+            return *this;
+        }
+        m_origin[d] = 0;
+        m_extent[d] = std::min(tile[d], extents[d]);
+        m_index[d] = 0;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-increment
+ *
+ * \return A copy of this iterator before the increment
+ */
+template<typename NdRangeType>
+auto NdRangeIterator<NdRangeType>::operator++(int) -> This
+{
+    This copy = *this;
+    ++(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+// DECREMENT
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move back to the previous point of the traversal
+ *
+ * \return A reference to this iterator after the decrement
+ */
+template<typename NdRangeType>
+auto NdRangeIterator<NdRangeType>::operator--() -> This&
+{
+    return *this -= 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-decrement
+ *
+ * \return A copy of this iterator before the decrement
+ */
+template<typename NdRangeType>
+auto NdRangeIterator<NdRangeType>::operator--(int) -> This
+{
+    This copy = *this;
+    --(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+// DEREFERENCE
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the index tuple of the current point
+ *
+ * \return The values of each dimension's Range at the current indices
+ */
+template<typename NdRangeType>
+auto NdRangeIterator<NdRangeType>::operator*() const -> reference
+{
+    IT_REQUIRE(m_position < m_range->count());
+
+    value_type result;
+    for (size_type d = 0; d < num_dims; ++d)
+    {
+        result[d] = m_range->dimension(d)[m_index[d]];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// COMPOUND ARITHMETIC
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance by \p n points
+ *
+ * \param[in] n  The number of points to advance by
+ *
+ * \return A reference to this iterator
+ */
+template<typename NdRangeType>
+auto NdRangeIterator<NdRangeType>::operator+=(difference_type n) -> This&
+{
+    m_position += static_cast<size_type>(n);
+    IT_REQUIRE(m_position <= m_range->count());
+
+    this->locate();
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move back by \p n points
+ *
+ * \param[in] n  The number of points to move back by
+ *
+ * \return A reference to this iterator
+ */
+template<typename NdRangeType>
+auto NdRangeIterator<NdRangeType>::operator-=(difference_type n) -> This&
+{
+    return *this += -n;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the tile and point at the current position
+ *
+ * Tiles are visited in row-major order over the tile grid and points in
+ * row-major order within a tile.  Only the last tile along a dimension can be
+ * partial, so the tiles preceding the current one along dimension \c d all
+ * hold \c tile[d] slices: the tile index along each dimension is a single
+ * division, and the remainder is the row-major offset within the tile.
+ */
+template<typename NdRangeType>
+void NdRangeIterator<NdRangeType>::locate()
+{
+    const auto& extents = m_range->extents();
+    const auto& tile = m_range->tile();
+
+    if (m_position >= m_range->count())
+    {
+        // The past-the-end iterator holds the state after the last tile
+        for (size_type d = 0; d < num_dims; ++d)
+        {
+            m_origin[d] = 0;
+            m_extent[d] = std::min(tile[d], extents[d]);
+            m_index[d] = 0;
+        }
+        return;
+    }
+
+    // Number of points in the trailing dimensions
+    Indices_t trailing;
+    trailing[num_dims - 1] = 1;
+    for (size_type d = num_dims - 1; d-- > 0;)
+    {
+        trailing[d] = trailing[d + 1] * extents[d + 1];
+    }
+
+    // Locate the tile
+    size_type offset = m_position;
+    size_type leading = 1;
+    for (size_type d = 0; d < num_dims; ++d)
+    {
+        const size_type slab = leading * tile[d] * trailing[d];
+        const size_type t = offset / slab;
+        offset -= t * slab;
+        m_origin[d] = t * tile[d];
+        m_extent[d] = std::min(tile[d], extents[d] - m_origin[d]);
+        leading *= m_extent[d];
+    }
+
+    // Locate the point within the tile
+    for (size_type d = num_dims; d-- > 0;)
+    {
+        m_index[d] = m_origin[d] + offset % m_extent[d];
+        offset /= m_extent[d];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between an iterator and a distance
+ *
+ * \param[in] iter  The iterator
+ * \param[in] n     The distance
+ *
+ * \return An iterator \p n points past \p iter
+ */
+template<typename NdRangeType>
+NdRangeIterator<NdRangeType>
+operator+(NdRangeIterator<NdRangeType> iter,
+          typename NdRangeIterator<NdRangeType>::difference_type n)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a distance and an iterator
+ *
+ * \param[in] n     The distance
+ * \param[in] iter  The iterator
+ *
+ * \return An iterator \p n points past \p iter
+ */
+template<typename NdRangeType>
+NdRangeIterator<NdRangeType>
+operator+(typename NdRangeIterator<NdRangeType>::difference_type n,
+          NdRangeIterator<NdRangeType> iter)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between an iterator and a distance
+ *
+ * \param[in] iter  The iterator
+ * \param[in] n     The distance
+ *
+ * \return An iterator \p n points before \p iter
+ */
+template<typename NdRangeType>
+NdRangeIterator<NdRangeType>
+operator-(NdRangeIterator<NdRangeType> iter,
+          typename NdRangeIterator<NdRangeType>::difference_type n)
+{
+    return iter -= n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Distance between two iterators
+ *
+ * \param[in] iter1  The ending iterator
+ * \param[in] iter2  The beginning iterator
+ *
+ * \return The number of points from \p iter2 to \p iter1
+ */
+template<typename NdRangeType>
+typename NdRangeIterator<NdRangeType>::difference_type
+operator-(const NdRangeIterator<NdRangeType>& iter1,
+          const NdRangeIterator<NdRangeType>& iter2)
+{
+    using difference_type =
+        typename NdRangeIterator<NdRangeType>::difference_type;
+    return static_cast<difference_type>(iter1.position() - iter2.position());
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+template<typename NdRangeType>
+bool operator==(const NdRangeIterator<NdRangeType>& iter1,
+                const NdRangeIterator<NdRangeType>& iter2)
+{
+    return iter1.position() == iter2.position();
+}
+
+//---------------------------------------------------------------------------//
+template<typename NdRangeType>
+bool operator!=(const NdRangeIterator<NdRangeType>& iter1,
+                const NdRangeIterator<NdRangeType>& iter2)
+{
+    return !(iter1 == iter2);
+}
+
+//---------------------------------------------------------------------------//
+template<typename NdRangeType>
+bool operator<(const NdRangeIterator<NdRangeType>& iter1,
+               const NdRangeIterator<NdRangeType>& iter2)
+{
+    return iter1.position() < iter2.position();
+}
+
+//---------------------------------------------------------------------------//
+template<typename NdRangeType>
+bool operator<=(const NdRangeIterator<NdRangeType>& iter1,
+                const NdRangeIterator<NdRangeType>& iter2)
+{
+    return !(iter2 < iter1);
+}
+
+//---------------------------------------------------------------------------//
+template<typename NdRangeType>
+bool operator>(const NdRangeIterator<NdRangeType>& iter1,
+               const NdRangeIterator<NdRangeType>& iter2)
+{
+    return iter2 < iter1;
+}
+
+//---------------------------------------------------------------------------//
+template<typename NdRangeType>
+bool operator>=(const NdRangeIterator<NdRangeType>& iter1,
+                const NdRangeIterator<NdRangeType>& iter2)
+{
+    return !(iter1 < iter2);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_DETAIL_NDRANGEITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/range/detail/NdRangeIterator.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,422 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/detail/RangeBlocks.hh
+ * \brief  RangeBlock and RangeBlocks class declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_DETAIL_RANGEBLOCKS_HH
+#define ITERTOOLS_SRC_RANGE_DETAIL_RANGEBLOCKS_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "core/DBC.hh"
+#include "RangeIterator.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class RangeBlock
+ * \brief A block of \c W lanes holding consecutive values of a range
+ *
+ * Lane \c l of the block holds the value <tt>start() + l * step()</tt>.  Only
+ * the lanes in <tt>[firstLane(), lastLane())</tt> belong to the range; the
+ * others are masked off.  Full blocks have every lane active, so a SIMD
+ * kernel can process them with plain vector loads and stores and fall back to
+ * masked operations (or a scalar loop over the block) otherwise:
+ * \code
+ * for (auto block : range(n).blocks<8>())
+ * {
+ *     if (block.full()) { ... _mm256_loadu_ps(x + block.start()) ... }
+ *     else { for (auto i : block) { ... } }
+ * }
+ * \endcode
+ *
+ * \tparam Integer  The integral type of the range values
+ * \tparam W        The number of lanes
+ */
+//===========================================================================//
+
+template<typename Integer, std::size_t W>
+class RangeBlock
+{
+    static_assert(W > 0 && W <= 64);
+
+    // Unsigned type used for wrap-free lane computations
+    using Unsigned_t
+        = std::common_type_t<std::make_unsigned_t<Integer>, std::size_t>;
+
+  public:
+    //! Public type aliases
+    using value_type = Integer;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = RangeIterator<Integer>;
+    using const_iterator = RangeIterator<Integer>;
+    using mask_type = std::uint64_t;
+
+  public:
+    // Construct from the value of lane 0 and the active lanes
+    inline RangeBlock(Integer start,
+                      Integer step,
+                      size_type first_lane,
+                      size_type last_lane);
+
+    //! Return the number of lanes
+    static constexpr size_type width() { return W; }
+
+    // Return the signed value of lane 0 (which may be masked off)
+    inline difference_type start() const;
+
+    //! Return the step between consecutive lanes
+    value_type step() const { return m_step; }
+
+    //! Return the first active lane
+    size_type firstLane() const { return m_first; }
+
+    //! Return one past the last active lane
+    size_type lastLane() const { return m_last; }
+
+    //! Return the number of active lanes
+    size_type size() const { return m_last - m_first; }
+
+    //! Return whether every lane is active
+    bool full() const { return m_first == 0 && m_last == W; }
+
+    //! Return whether lane \p lane is active
+    bool active(size_type lane) const
+    {
+        return m_first <= lane && lane < m_last;
+    }
+
+    // Return the bit mask of the active lanes
+    inline mask_type mask() const;
+
+    // Return the value of lane \p lane
+    inline value_type operator[](size_type lane) const;
+
+    //! Return an iterator to the first active value
+    const_iterator begin() const
+    {
+        return const_iterator((*this)[m_first], m_step);
+    }
+
+    //! Return an iterator past the last active value
+    const_iterator end() const
+    {
+        return this->begin() + static_cast<std::ptrdiff_t>(this->size());
+    }
+
+  private:
+    // >>> DATA
+    //! Value of lane 0
+    Integer m_start;
+
+    //! Step between consecutive lanes
+    Integer m_step;
+
+    //! First active lane
+    size_type m_first;
+
+    //! One past the last active lane
+    size_type m_last;
+};
+
+//===========================================================================//
+/*!
+ * \class RangeBlocks
+ * \brief A view of a range as consecutive blocks of \c W values
+ *
+ * The blocks tile the range with a leading offset: block \c k holds the
+ * values at indices <tt>k * W - lead</tt> through
+ * <tt>(k + 1) * W - lead - 1</tt> of the range, with the lanes outside of the
+ * range masked off.  Without a lead, every block is full except possibly the
+ * last.  With a lead (see Range::alignedBlocks), the first block is masked
+ * so that every following block starts at an aligned address.
+ *
+ * Like RangePartitions, the blocks are computed on demand from their index.
+ *
+ * \tparam RangeType  The type of the blocked range
+ * \tparam W          The number of lanes in each block
+ *
+ * \example range/tests/tstRange.cc
+ */
+//===========================================================================//
+
+template<typename RangeType, std::size_t W>
+class RangeBlocks
+{
+  public:
+    //! Public type aliases
+    using This = RangeBlocks<RangeType, W>;
+    using value_type = RangeBlock<typename RangeType::value_type, W>;
+    using size_type = std::size_t;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+  public:
+    // Constructor
+    inline RangeBlocks(const RangeType& range, size_type lead);
+
+    //! Return the number of blocks
+    size_type size() const { return m_count; }
+
+    //! Return whether there are no blocks
+    bool empty() const { return m_count == 0; }
+
+    //! Return the number of masked lanes leading the first block
+    size_type lead() const { return m_lead; }
+
+    // Return the block at index i
+    inline value_type operator[](size_type i) const;
+
+    //! Return beginning iterator
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    //! Return ending iterator
+    const_iterator end() const { return const_iterator(this, m_count); }
+
+  private:
+    // >>> DATA
+    //! The blocked range
+    RangeType m_range;
+
+    //! Number of masked lanes leading the first block
+    size_type m_lead;
+
+    //! The number of blocks
+    size_type m_count;
+};
+
+//===========================================================================//
+/*!
+ * \class RangeBlocks::const_iterator
+ * \brief Forward iterator over the blocks of a range
+ *
+ * The iterator advances the current block incrementally, so that a loop over
+ * the blocks only tests for the leading and trailing partial blocks.
+ */
+//===========================================================================//
+
+template<typename RangeType, std::size_t W>
+class RangeBlocks<RangeType, W>::const_iterator
+{
+    using Value_t = typename RangeType::value_type;
+    using Unsigned_t
+        = std::common_type_t<std::make_unsigned_t<Value_t>, size_type>;
+
+  public:
+    //! Public type aliases
+    using difference_type = std::ptrdiff_t;
+    using value_type = RangeBlock<Value_t, W>;
+    using reference = value_type;
+    using pointer = void;
+    using iterator_category = std::forward_iterator_tag;
+
+  public:
+    //! Default constructor
+    const_iterator() = default;
+
+    //! Construct with the parent view and a block index
+    const_iterator(const RangeBlocks* parent, size_type index)
+        : m_start(Unsigned_t(parent->m_range.beginValue())
+                  + (Unsigned_t(index) * W - parent->m_lead)
+                        * Unsigned_t(parent->m_range.step()))
+        , m_step(parent->m_range.step())
+        , m_first(index == 0 ? parent->m_lead : 0)
+        , m_remaining(parent->m_range.size() + parent->m_lead - index * W)
+        , m_index(index)
+    {
+    }
+
+    //! Dereference
+    reference operator*() const
+    {
+        return value_type(static_cast<Value_t>(m_start),
+                          m_step,
+                          m_first,
+                          std::min<size_type>(W, m_remaining));
+    }
+
+    //! Pre-increment
+    const_iterator& operator++()
+    {
+        m_start += Unsigned_t(W) * Unsigned_t(m_step);
+        m_first = 0;
+        m_remaining -= W;
+        ++m_index;
+        return *this;
+    }
+
+    //! Post-increment
+    const_iterator operator++(int)
+    {
+        const_iterator copy = *this;
+        ++(*this);
+        return copy;
+    }
+
+    //! Equality
+    bool operator==(const const_iterator& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    //! Inequality
+    bool operator!=(const const_iterator& other) const
+    {
+        return m_index != other.m_index;
+    }
+
+  private:
+    // >>> DATA
+    //! Value of lane 0 of the current block
+    Unsigned_t m_start = 0;
+
+    //! Step between consecutive values
+    Value_t m_step = 1;
+
+    //! First active lane of the current block
+    size_type m_first = 0;
+
+    //! Number of lanes from lane 0 of the current block to the range end
+    size_type m_remaining = 0;
+
+    //! Index of the current block
+    size_type m_index = 0;
+};
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+// RANGEBLOCK
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct a block from the value of lane 0 and the active lanes
+ *
+ * \param[in] start       The value of lane 0
+ * \param[in] step        The step between consecutive lanes
+ * \param[in] first_lane  The first active lane
+ * \param[in] last_lane   One past the last active lane
+ */
+template<typename Integer, std::size_t W>
+RangeBlock<Integer, W>::RangeBlock(Integer start,
+                                   Integer step,
+                                   size_type first_lane,
+                                   size_type last_lane)
+    : m_start(start), m_step(step), m_first(first_lane), m_last(last_lane)
+{
+    IT_REQUIRE(first_lane <= last_lane);
+    IT_REQUIRE(last_lane <= W);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the signed value of lane 0
+ *
+ * The value of a masked lane 0 may precede the range and not be representable
+ * in \c Integer, e.g., in the first block of an unsigned range starting at
+ * zero (see Range::alignedBlocks), so it is computed from the first active
+ * lane as a signed offset.  <tt>data + start()</tt> is therefore the address
+ * of lane 0 for any integral type, provided the values of the range fit in a
+ * \c std::ptrdiff_t.
+ *
+ * \return The value <tt>(*this)[firstLane()] - firstLane() * step()</tt>
+ */
+template<typename Integer, std::size_t W>
+auto RangeBlock<Integer, W>::start() const -> difference_type
+{
+    return static_cast<difference_type>((*this)[m_first])
+           - static_cast<difference_type>(m_first)
+                 * static_cast<difference_type>(m_step);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the bit mask of the active lanes
+ *
+ * \return A mask with bit \c l set when lane \c l is active, e.g., for an
+ *         AVX-512 \c __mmask
+ */
+template<typename Integer, std::size_t W>
+auto RangeBlock<Integer, W>::mask() const -> mask_type
+{
+    const auto below = [](size_type lane) {
+        return lane < 64 ? (mask_type(1) << lane) - 1 : ~mask_type(0);
+    };
+    return below(m_last) & ~below(m_first);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the value of lane \p lane
+ *
+ * \param[in] lane  The lane index (up to and including W)
+ *
+ * \return The value <tt>start() + lane * step()</tt>, wrapped to \c Integer
+ *         for a masked lane whose value precedes the range
+ */
+template<typename Integer, std::size_t W>
+auto RangeBlock<Integer, W>::operator[](size_type lane) const -> value_type
+{
+    IT_REQUIRE(lane <= W);
+
+    return static_cast<value_type>(Unsigned_t(m_start)
+                                   + Unsigned_t(lane) * Unsigned_t(m_step));
+}
+
+//---------------------------------------------------------------------------//
+// RANGEBLOCKS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct a view of \p range in blocks of \c W values
+ *
+ * \param[in] range  The range to block
+ * \param[in] lead   The number of masked lanes leading the first block
+ */
+template<typename RangeType, std::size_t W>
+RangeBlocks<RangeType, W>::RangeBlocks(const RangeType& range,
+                                       size_type lead)
+    : m_range(range)
+    , m_lead(lead)
+    , m_count(range.empty() ? 0 : (lead + range.size() + W - 1) / W)
+{
+    IT_REQUIRE(lead < W);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the block at index \p i
+ *
+ * \param[in] i  The index of the block
+ *
+ * \return The block holding the values at indices <tt>i * W - lead()</tt>
+ *         and up
+ */
+template<typename RangeType, std::size_t W>
+auto RangeBlocks<RangeType, W>::operator[](size_type i) const -> value_type
+{
+    IT_REQUIRE(i < m_count);
+
+    return *const_iterator(this, i);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_DETAIL_RANGEBLOCKS_HH
+//---------------------------------------------------------------------------//
+// end of src/range/detail/RangeBlocks.hh
+//---------------------------------------------------------------------------//
@@ -8,20 +8,45 @@
 #ifndef ITERTOOLS_SRC_RANGE_DETAIL_RANGEITERATOR_HH
 #define ITERTOOLS_SRC_RANGE_DETAIL_RANGEITERATOR_HH
 
-#include <cmath>
+#include <cstddef>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "core/DBC.hh"
+#include "core/Macros.hh"
 
 namespace itertools
 {
+namespace detail
+{
 //===========================================================================//
 /*!
  * \class RangeIterator
  * \brief Enables iterating over a range of Integer values
  *
- * Long description or discussion goes here.
+ * The iterator stores the current value, the step length and its position,
+ * i.e., the number of steps from the first value of its range.  Range
+ * iterators are compared by position, so a loop over a Range has a single
+ * comparison per iteration and ends after the right number of values even
+ * when the value past the last one is not representable, e.g., for
+ * <tt>range<std::uint8_t>(0, 255, 2)</tt>.  Only iterators of the same range
+ * may be compared or subtracted.
+ *
+ * Values narrower than 64 bits are stored in a \c std::ptrdiff_t, in which
+ * stepping past the last value of a range is exact, so equality compares the
+ * stored values and the loop keeps a single induction variable.  The compiler
+ * is told that a dereferenced value is representable, which lets it vectorize
+ * a loop over a range with a step known at compile time as it does the
+ * hand-written loop.  64-bit values wrap around in unsigned arithmetic, and
+ * equality compares the positions.
+ *
+ * RangeIterator is a random-access iterator whose \c reference type is the
+ * value type itself: dereferencing produces the value rather than a reference
+ * to storage, and there is no \c operator->.  Advancing and computing
+ * distances are constant time, so the standard algorithms (including the
+ * parallel ones) can split a range without walking it.  Ordering follows the
+ * position, i.e., the direction of the step.
  *
  * \example range/tests/tstRangeIterator.cc
  */
@@ -33,21 +58,41 @@ class RangeIterator
     using Integer_t = std::remove_reference_t<Integer>;
     static_assert(std::is_integral_v<Integer_t>);
 
+    // Unsigned type used for wrap-free distance computations
+    using Unsigned_t
+        = std::common_type_t<std::make_unsigned_t<Integer_t>, std::size_t>;
+
+    // Type storing the value: wide enough for the value past the last one of
+    // a range when narrower than 64 bits, wrapping around otherwise
+    using Storage_t = std::conditional_t<(sizeof(Integer_t)
+                                          < sizeof(std::ptrdiff_t)),
+                                         std::ptrdiff_t,
+                                         Integer_t>;
+
+    // Whether the stored values are exact and identify the position
+    static constexpr bool exact_value = !std::is_same_v<Storage_t, Integer_t>;
+
+    template<typename Integer1, typename Integer2>
+    friend bool operator==(const RangeIterator<Integer1>& iter1,
+                           const RangeIterator<Integer2>& iter2);
+
   public:
     //! Public type aliases
-    using This = RangeIterator<Iterator>;
+    using This = RangeIterator<Integer>;
     using difference_type = std::ptrdiff_t;
     using value_type = Integer_t;
-    using reference = std::add_reference<Integer_t>;
-    using pointer = std::add_pointer<Integer_t>;
-    using iterator_category = std::forward_iterator_tag;
+    using reference = value_type;
+    using pointer = void;
+    using iterator_category = std::random_access_iterator_tag;
 
   public:
     // Default constructor
     RangeIterator() = default;
 
-    // Constructor with value and optional step
-    inline RangeIterator(Integer value, Integer step = 1);
+    // Constructor with value, optional step and position
+    inline RangeIterator(Integer_t value,
+                         Integer_t step = 1,
+                         difference_type index = 0);
 
     // >>> INCREMENT
     // Pre-increment
@@ -63,49 +108,67 @@ class RangeIterator
     // Post-decrement
     inline This operator--(int);
 
-    // >>> DEREFERENCE, POINTER, INDEXING
+    // >>> DEREFERENCE, INDEXING
     //! Dereference
-    reference operator*() { return m_value; }
-
-    //! Pointer
-    pointer operator->() { return &m_value; }
+    reference operator*() const { return narrow(m_value); }
 
-    //! Indexing
-    reference operator[](difference_type n) { return m_value + m_step * n; }
+    // Indexing
+    inline reference operator[](difference_type n) const;
 
     // >>> COMPOUND ARITHMETIC
     // Compound arithmetic operators
-    This& operator+=(difference_type n);
-    This& operator-=(difference_type n);
+    inline This& operator+=(difference_type n);
+    inline This& operator-=(difference_type n);
 
     // >>> ACCESSORS
-    //! Return the current value
-    const reference value() const { return m_value; }
+    //! Return the current value, which wraps around past the type limits
+    value_type value() const { return static_cast<value_type>(m_value); }
 
     //! Return the step length
-    Integer step() const { return m_step; }
+    value_type step() const { return m_step; }
+
+    //! Return the number of steps from the first value of the range
+    difference_type index() const
+    {
+        return static_cast<difference_type>(m_index);
+    }
+
+    // Return the number of steps from \p other to this iterator
+    inline difference_type distanceFrom(const This& other) const;
 
   private:
+    // Return the stored value n steps away from the current value
+    inline Storage_t advanced(difference_type n) const;
+
+    // Convert a stored value known to be representable
+    static inline value_type narrow(Storage_t value);
+
     // >>> DATA
     //! Stores the integral value of the iterator
-    Integer m_value;
+    Storage_t m_value = 0;
 
     //! Stores the distance to travel each iteration
-    Integer m_step;
+    Integer_t m_step = 1;
+
+    //! Stores the number of steps from the first value of the range, modulo
+    //! the width of std::size_t so that a range of any size can be traversed
+    std::size_t m_index = 0;
 };
 
 //---------------------------------------------------------------------------//
 // ARITHMETIC OPERATORS
 //---------------------------------------------------------------------------//
-// Sum between a range iterator and an integral value
-template<typename Integer1, typename Integer2>
-RangeIterator<std::common_type_t<Integer1, Integer2>>
-operator+(const RangeIterator<Integer1>& iter, Integer2 n);
+// Sum between a range iterator and a distance
+template<typename Integer>
+inline RangeIterator<Integer>
+operator+(const RangeIterator<Integer>& iter,
+          typename RangeIterator<Integer>::difference_type n);
 
-// Sum between a range iterator and an integral value
-template<typename Integer1, typename Integer2>
-RangeIterator<std::common_type_t<Integer1, Integer2>>
-operator+(Integer2 n, const RangeIterator<Integer1>& iter);
+// Sum between a distance and a range iterator
+template<typename Integer>
+inline RangeIterator<Integer>
+operator+(typename RangeIterator<Integer>::difference_type n,
+          const RangeIterator<Integer>& iter);
 
 // Sum two range iterators
 template<typename Integer1, typename Integer2>
@@ -113,16 +176,17 @@ RangeIterator<std::common_type_t<Integer1, Integer2>>
 operator+(const RangeIterator<Integer1>& iter1,
           const RangeIterator<Integer2>& iter2);
 
-// Difference between a range iterator and an integral value
-template<typename Integer1, typename Integer2>
-RangeIterator<Integer1>
-operator-(const RangeIterator<Integer1>& iter, Integer2 n);
+// Difference between a range iterator and a distance
+template<typename Integer>
+inline RangeIterator<Integer>
+operator-(const RangeIterator<Integer>& iter,
+          typename RangeIterator<Integer>::difference_type n);
 
 // Difference between two range iterators
-template<typename Integer1, typename Integer2>
-typename RangeIterator<Integer1>::difference_type
-operator-(const RangeIterator<Integer1>& iter1,
-          const RangeIterator<Integer2>& iter2);
+template<typename Integer>
+inline typename RangeIterator<Integer>::difference_type
+operator-(const RangeIterator<Integer>& iter1,
+          const RangeIterator<Integer>& iter2);
 
 //---------------------------------------------------------------------------//
 // BOOLEAN OPERATORS
@@ -163,7 +227,9 @@ bool operator>=(const RangeIterator<Integer1>& iter1,
 // Build a range iterator
 template<typename Integer>
 inline RangeIterator<Integer>
-makeRangeIterator(Integer value, Integer step = 1);
+makeRangeIterator(Integer value,
+                  Integer step = 1,
+                  std::ptrdiff_t index = 0);
 
 //===========================================================================//
 // INLINE FUNCTION IMPLEMENTATION
@@ -174,18 +240,19 @@ makeRangeIterator(Integer value, Integer step = 1);
 //---------------------------------------------------------------------------//
 /*!
  * \brief Construct the range iterator with the given value and optional step
- *        length
+ *        length and position
  *
  * \param[in] value  The value to initialize the range iterator with
  * \param[in] step   The step size
+ * \param[in] index  The number of steps from the first value of the range
  */
 template<typename Integer>
-RangeIterator<Iterator>::RangeIterator(Iterator value, Iterator step)
-    : m_value(value), m_step(step)
+RangeIterator<Integer>::RangeIterator(Integer_t value,
+                                      Integer_t step,
+                                      difference_type index)
+    : m_value(value), m_step(step), m_index(static_cast<std::size_t>(index))
 {
-    IM_REQUIRE(std::isfinite(value));
-    IM_REQUIRE(std::isfinite(step));
-    IM_REQUIRE(m_step != 0);
+    IT_REQUIRE(m_step != 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -197,9 +264,10 @@ RangeIterator<Iterator>::RangeIterator(Iterator value, Iterator step)
  * \return A reference to this iterator after the increment
  */
 template<typename Integer>
-auto RangeIterator<Iterator>::operator++() -> This&
+auto RangeIterator<Integer>::operator++() -> This&
 {
-    m_value += m_step;
+    m_value = this->advanced(1);
+    ++m_index;
     return *this;
 }
 
@@ -210,7 +278,7 @@ auto RangeIterator<Iterator>::operator++() -> This&
  * \return A copy of this iterator prior to the increment
  */
 template<typename Integer>
-auto RangeIterator<Iterator>::operator++(int) -> This
+auto RangeIterator<Integer>::operator++(int) -> This
 {
     This copy = *this;
     ++(*this);
@@ -226,11 +294,10 @@ auto RangeIterator<Iterator>::operator++(int) -> This
  * \return A reference to this iterator after the decrement
  */
 template<typename Integer>
-auto RangeIterator<Iterator>::operator--() -> This&
+auto RangeIterator<Integer>::operator--() -> This&
 {
-    IM_REQUIRE(std::is_signed_v<Integer> || m_value >= m_step);
-
-    m_value -= m_step;
+    m_value = this->advanced(-1);
+    --m_index;
     return *this;
 }
 
@@ -241,31 +308,44 @@ auto RangeIterator<Iterator>::operator--() -> This&
  * \return A copy of this iterator prior to the decrement
  */
 template<typename Integer>
-auto RangeIterator<Iterator>::operator--(int) -> This
+auto RangeIterator<Integer>::operator--(int) -> This
 {
-    IM_REQUIRE(std::is_signed_v<Integer> || m_value > 0);
-
     This copy = *this;
     --(*this);
     return copy;
 }
 
+//---------------------------------------------------------------------------//
+// INDEXING
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the value \p n steps away from the iterator
+ *
+ * \param[in] n  The number of steps
+ *
+ * \return The value of <tt>*(*this + n)</tt>
+ */
+template<typename Integer>
+auto RangeIterator<Integer>::operator[](difference_type n) const -> reference
+{
+    return narrow(this->advanced(n));
+}
+
 //---------------------------------------------------------------------------//
 // COMPOUND ARITHMETIC
 //---------------------------------------------------------------------------//
 /*!
  * \brief Compound addition-assignment operator
  *
- * \param[in] n  The amount to add to the iterator
+ * \param[in] n  The number of steps to advance the iterator
  *
  * \return A reference to this iterator
  */
 template<typename Integer>
-auto RangeIterator<Iterator>::operator+=(difference_type n) -> This&
+auto RangeIterator<Integer>::operator+=(difference_type n) -> This&
 {
-    IM_REQUIRE(std::isfinite(n));
-
-    m_value += n * step;
+    m_value = this->advanced(n);
+    m_index += static_cast<std::size_t>(n);
     return *this;
 }
 
@@ -273,68 +353,141 @@ auto RangeIterator<Iterator>::operator+=(difference_type n) -> This&
 /*!
  * \brief Compound subtraction-assignment operator
  *
- * \param[in] n The amoutn to subtract from the iterator
+ * \param[in] n  The number of steps to move the iterator back
  *
  * \return A reference to this iterator
  */
 template<typename Integer>
 auto RangeIterator<Integer>::operator-=(difference_type n) -> This&
 {
-    IM_REQUIRE(std::is_signed_v<Integer> || m_value > 0);
-    IM_REQUIRE(std::finite(n));
-
-    m_value -= n * step;
+    m_value = this->advanced(-n);
+    m_index -= static_cast<std::size_t>(n);
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+// ACCESSORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the number of steps from \p other to this iterator
+ *
+ * \warning This operation is undefined if the iterators do not belong to the
+ *          same range
+ *
+ * \param[in] other  The iterator to measure from
+ *
+ * \return The number of steps \c n such that <tt>other + n == *this</tt>
+ */
+template<typename Integer>
+auto RangeIterator<Integer>::distanceFrom(const This& other) const
+    -> difference_type
+{
+    IT_REQUIRE(m_step == other.m_step);
+
+    return static_cast<difference_type>(m_index - other.m_index);
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the stored value \p n steps away from the current value
+ *
+ * Values narrower than 64 bits are computed exactly in the wide storage
+ * type.  64-bit values are computed modulo the width of the unsigned type so
+ * that intermediate products never overflow; the result is exact whenever
+ * the advanced value is representable.
+ *
+ * \param[in] n  The number of steps (may be negative)
+ *
+ * \return The advanced value
+ */
+template<typename Integer>
+auto RangeIterator<Integer>::advanced(difference_type n) const -> Storage_t
+{
+    if constexpr (!exact_value)
+    {
+        return static_cast<Storage_t>(Unsigned_t(m_value)
+                                      + Unsigned_t(n) * Unsigned_t(m_step));
+    }
+    else
+    {
+        return m_value + n * static_cast<Storage_t>(m_step);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Convert a stored value that is known to be representable
+ *
+ * Dereferencing an iterator is only valid within its range, where every value
+ * is representable; the compiler is told so.
+ *
+ * \param[in] value  The stored value
+ *
+ * \return The value as the integral type
+ */
+template<typename Integer>
+auto RangeIterator<Integer>::narrow(Storage_t value) -> value_type
+{
+    if constexpr (exact_value)
+    {
+        // Representable values have no significant bits above the sign bit
+        // (signed) or above the value bits (unsigned).  This form, unlike a
+        // pair of bound checks, does not get in the way of vectorization.
+        constexpr int digits = std::numeric_limits<Integer_t>::digits;
+        if constexpr (std::is_signed_v<Integer_t>)
+        {
+            ITERTOOLS_ASSUME(static_cast<std::size_t>((value >> digits) + 1)
+                             <= 1);
+        }
+        else
+        {
+            ITERTOOLS_ASSUME((value >> digits) == 0);
+        }
+    }
+    return static_cast<value_type>(value);
+}
+
 //---------------------------------------------------------------------------//
 // ARITHMETIC OPERATORS
 //---------------------------------------------------------------------------//
 /*!
  * \brief Add a distance \p n to iterator \p iter and return the result
  *
- * \tparam Integer1  The integral type for RangeIterator \p iter
- * \tparam Integer2  The integral type of the distance to add
+ * \tparam Integer  The integral type for RangeIterator \p iter
  *
- * \param[in] iter  The integer to add to
+ * \param[in] iter  The iterator to add to
  * \param[in] n     The distance to add to \p iter
  *
  * \return A new iterator pointing \p n distance from \p iter
  */
-template<typename Integer1, typename Integer2>
-auto operator+(const RangeIterator<Integer1>& iter, Integer2 n)
-    -> RangeIterator<std::common_type_t<Integer1, Integer2>>
+template<typename Integer>
+RangeIterator<Integer>
+operator+(const RangeIterator<Integer>& iter,
+          typename RangeIterator<Integer>::difference_type n)
 {
-    static_assert(std::is_integral_v<Integer2>());
-    IM_REQUIRE(std::isfinite(n));
-
-    using IT_t = std::common_type_t<Integer1, Integer2>;
-
-    return RangeIterator<IT_t>(iter.value() + n * iter.step(), iter.step());
+    RangeIterator<Integer> result(iter);
+    return result += n;
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * \brief Add a distance \p n to iterator \p iter and return the result
  *
- * \tparam Integer1  The integral type for RangeIterator \p iter
- * \tparam Integer2  The integral type of the distance to add
+ * \tparam Integer  The integral type for RangeIterator \p iter
  *
- * \param[in] iter  The integer to add to
  * \param[in] n     The distance to add to \p iter
+ * \param[in] iter  The iterator to add to
  *
  * \return A new iterator pointing \p n distance from \p iter
  */
-template<typename Integer1, typename Integer2>
-auto operator+(Integer1 n, const RangeIterator<Integer2>& iter)
-    -> RnageIterator<std::common_type_t<Integer1, Integer2>>
+template<typename Integer>
+RangeIterator<Integer>
+operator+(typename RangeIterator<Integer>::difference_type n,
+          const RangeIterator<Integer>& iter)
 {
-    static_assert(std::is_integral_v<Integer1>());
-    IM_REQUIRE(std::isfinite(n));
-
-    using IT_t = std::common_type_t<Integer1, Integer2>;
-
-    return RangeIterator<IT_t>(iter.value() + n * iter.step(), iter.step());
+    return iter + n;
 }
 
 //---------------------------------------------------------------------------//
@@ -342,7 +495,8 @@ auto operator+(Integer1 n, const RangeIterator<Integer2>& iter)
  * \brief Produce the sum of two iterators
  *
  * \warning This operation is undefined if \p iter1 and \p iter2 do not have
- *          the same step length
+ *          the same step length; the position of the result is the sum of
+ *          the positions
  *
  * \tparam Integer1  The integral type of the first range iterator
  * \tparam Integer2  The integral type of the second range iterator
@@ -355,66 +509,58 @@ auto operator+(Integer1 n, const RangeIterator<Integer2>& iter)
 template<typename Integer1, typename Integer2>
 auto operator+(const RangeIterator<Integer1>& iter1,
                const RangeIterator<Integer2>& iter2)
-    -> RnageIterator<std::common_type_t<Integer1, Integer2>>
+    -> RangeIterator<std::common_type_t<Integer1, Integer2>>
 {
-    IM_REQUIRE(iter1.step() == iter2.step());
+    IT_REQUIRE(iter1.step() == iter2.step());
     using IT_t = std::common_type_t<Integer1, Integer2>;
 
-    return RangeIterator<IT_t>(iter1.value() + iter2.value(), iter1.step());
+    return RangeIterator<IT_t>(iter1.value() + iter2.value(),
+                               iter1.step(),
+                               static_cast<std::ptrdiff_t>(
+                                   std::size_t(iter1.index())
+                                   + std::size_t(iter2.index())));
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * \brief Produce an iterator subtracted \p n distance from \p iter
  *
- * \tparam Integer1  The integral type of the range iterator
- * \tparam Integer2  The distance type to subtract from \p iter
+ * \tparam Integer  The integral type of the range iterator
  *
  * \param[in] iter  The range iterator to subtract from
  * \param[in] n     The distance to subtract
  *
  * \return A new range iterator \p n distance subtracted from \p iter
  */
-template<typename Integer1, typename Integer2>
-auto operator-(const RangeIterator<Integer1>& iter, Integer2 n)
-    -> RangeIterator<std::common_type_t<Integer1, Integer2>>
+template<typename Integer>
+RangeIterator<Integer>
+operator-(const RangeIterator<Integer>& iter,
+          typename RangeIterator<Integer>::difference_type n)
 {
-    static_assert(std::is_integral_v<Integer2>());
-
-    using IT_t = std::common_type_t<Integer1, Integer2>;
-    IM_REQUIRE(std::issigned_v<IT_t> || iter1.value() >= n * iter1.step());
-    IM_REQUIRE(std::isfinite(n));
-
-    return RangeIterator<Integer1>(iter1.value() - n * iter1.step(),
-                                   iter1.step());
+    RangeIterator<Integer> result(iter);
+    return result -= n;
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * \brief Compute the distance between \p iter1 and \p iter2
  *
- * \warning This operation is undefined if \p iter1 and \p iter2 do not have
- *          an equal step length
+ * \warning This operation is undefined if \p iter1 and \p iter2 do not
+ *          belong to the same range
  *
- * \tparam Integer1  The integral type of the first range iterator
- * \tparam Integer2  The integral type of the second range iterator
+ * \tparam Integer  The integral type of the range iterators
  *
  * \param[in] iter1  The first range iterator to subtract from
  * \param[in] iter2  The second range iterator to subtract
  *
- * \return The distance between \p iter1 and \p iter2
+ * \return The number of steps from \p iter2 to \p iter1
  */
-template<typename Integer1, typename Integer2>
-typename RangeIterator<Integer1>::difference_type
-operator-(const RangeIterator<Integer1>& iter1,
-          const RangeIterator<Integer2>& iter2)
+template<typename Integer>
+typename RangeIterator<Integer>::difference_type
+operator-(const RangeIterator<Integer>& iter1,
+          const RangeIterator<Integer>& iter2)
 {
-    IM_REQUIRE(iter1.step() == iter2.step());
-    using diff_t = RangeIterator<Integer1>::difference_type;
-
-    diff_t diff = static_cast<diff_t>(iter1.value())
-                  - static_cast<diff_t>(iter2.value());
-    return diff / iter1.step();
+    return iter1.distanceFrom(iter2);
 }
 
 //---------------------------------------------------------------------------//
@@ -423,8 +569,9 @@ operator-(const RangeIterator<Integer1>& iter1,
 /*!
  * \brief Returns whether \p iter1 and \p iter2 are equal
  *
- * Two range iterators are considered equal if both the value and their step
- * size are equal
+ * Two range iterators are considered equal if they are at the same position.
+ * Only iterators of the same range may be compared.  Exact stored values are
+ * compared rather than positions, which are then redundant in a loop.
  *
  * \tparam Integer1  The integral type for the first range iterator
  * \tparam Integer2  The integral type for the second range iterator
@@ -438,7 +585,17 @@ template<typename Integer1, typename Integer2>
 bool operator==(const RangeIterator<Integer1>& iter1,
                 const RangeIterator<Integer2>& iter2)
 {
-    return iter1.value() == iter2.value() && iter1.step() == iter2.step();
+    IT_REQUIRE(iter1.step() == iter2.step());
+
+    if constexpr (RangeIterator<Integer1>::exact_value
+                  && RangeIterator<Integer2>::exact_value)
+    {
+        return iter1.m_value == iter2.m_value;
+    }
+    else
+    {
+        return iter1.index() == iter2.index();
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -462,10 +619,10 @@ bool operator!=(const RangeIterator<Integer1>& iter1,
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Return whether \p iter1 is less than \p iter2
+ * \brief Return whether \p iter1 precedes \p iter2
  *
- * \warning This comparison is only valid if the step lengths of the two
- *          iterators are equal
+ * \warning This comparison is only valid if the two iterators belong to the
+ *          same range
  *
  * \tparam Integer1  The integral type for the first range iterator
  * \tparam Integer2  The integral type for the second range iterator
@@ -473,23 +630,26 @@ bool operator!=(const RangeIterator<Integer1>& iter1,
  * \param[in] iter1  The first range iterator to test
  * \param[in] iter2  The second range iterator to test
  *
- * \return True if \p iter1 is less than \p iter2
+ * \return True if \p iter1 comes before \p iter2 in the direction of the step
  */
 template<typename Integer1, typename Integer2>
-bool operator<(const RnageIterator<Integer1>& iter1,
+bool operator<(const RangeIterator<Integer1>& iter1,
                const RangeIterator<Integer2>& iter2)
 {
-    IM_REQUIRE(iter1.step() == iter2.step());
+    IT_REQUIRE(iter1.step() == iter2.step());
 
-    return iter1.value() < iter2.value();
+    // Positions wrap around like the values: compare their difference
+    return static_cast<std::ptrdiff_t>(std::size_t(iter1.index())
+                                       - std::size_t(iter2.index()))
+           < 0;
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Return whether \p iter1 is less-than or equal to \p iter2
+ * \brief Return whether \p iter1 precedes or is equal to \p iter2
  *
- * \warning This comparison is only valid if the step lengths of the two
- *          iterators are equal
+ * \warning This comparison is only valid if the two iterators belong to the
+ *          same range
  *
  * \tparam Integer1  The integral type for the first range iterator
  * \tparam Integer2  The integral type for the second range iterator
@@ -497,23 +657,21 @@ bool operator<(const RnageIterator<Integer1>& iter1,
  * \param[in] iter1  The first range iterator to test
  * \param[in] iter2  The second range iterator to test
  *
- * \return True if \p iter1 is less than \p iter2
+ * \return True if \p iter1 does not come after \p iter2
  */
 template<typename Integer1, typename Integer2>
 bool operator<=(const RangeIterator<Integer1>& iter1,
                 const RangeIterator<Integer2>& iter2)
 {
-    IM_REQUIRE(iter1.step() == iter2.step());
-
-    return iter1.value() <= iter2.value();
+    return !operator<(iter2, iter1);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Return whether \p iter1 is greater than \p iter2
+ * \brief Return whether \p iter1 comes after \p iter2
  *
- * \warning This comparison is only valid if the step lengths of the two
- *          iterators are equal
+ * \warning This comparison is only valid if the two iterators belong to the
+ *          same range
  *
  * \tparam Integer1  The integral type for the first range iterator
  * \tparam Integer2  The integral type for the second range iterator
@@ -521,23 +679,21 @@ bool operator<=(const RangeIterator<Integer1>& iter1,
  * \param[in] iter1  The first range iterator to test
  * \param[in] iter2  The second range iterator to test
  *
- * \return True if \p iter1 is greater than \p iter2
+ * \return True if \p iter1 comes after \p iter2 in the direction of the step
  */
 template<typename Integer1, typename Integer2>
 bool operator>(const RangeIterator<Integer1>& iter1,
                const RangeIterator<Integer2>& iter2)
 {
-    IM_REQUIRE(iter1.step() == iter2.step());
-
-    return !operator<=(iter1, iter2);
+    return operator<(iter2, iter1);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Return whether \p iter1 is greater-than or equal to \p iter2
+ * \brief Return whether \p iter1 comes after or is equal to \p iter2
  *
- * \warning This comparison is only valid if the step lengths of the two
- *          iterators are equal
+ * \warning This comparison is only valid if the two iterators belong to the
+ *          same range
  *
  * \tparam Integer1  The integral type for the first range iterator
  * \tparam Integer2  The integral type for the second range iterator
@@ -545,14 +701,12 @@ bool operator>(const RangeIterator<Integer1>& iter1,
  * \param[in] iter1  The first range iterator to test
  * \param[in] iter2  The second range iterator to test
  *
- * \return True if \p iter1 is greater-than or equal \p iter2
+ * \return True if \p iter1 does not come before \p iter2
  */
 template<typename Integer1, typename Integer2>
 bool operator>=(const RangeIterator<Integer1>& iter1,
                 const RangeIterator<Integer2>& iter2)
 {
-    IM_REQUIRE(iter1.step() == iter2.step());
-
     return !operator<(iter1, iter2);
 }
 
@@ -566,18 +720,21 @@ bool operator>=(const RangeIterator<Integer1>& iter1,
  *
  * \param[in] value  The value of the iterator
  * \param[in] step   The step length for the iterator
+ * \param[in] index  The number of steps from the first value of the range
  *
  * \return The constructed range iterator
  */
 template<typename Integer>
-RangeIterator<Iterator> makeRangeIterator(Integer value, Integer step = 1)
+RangeIterator<Integer>
+makeRangeIterator(Integer value, Integer step, std::ptrdiff_t index)
 {
-    static_assert(std::is_integral_v<Integer_t>);
+    static_assert(std::is_integral_v<Integer>);
 
-    return RangeIterator<Integer>(value, step);
+    return RangeIterator<Integer>(value, step, index);
 }
 
 //---------------------------------------------------------------------------//
+}  // namespace detail
 }  // namespace itertools
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,238 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/detail/RangePartitions.hh
+ * \brief  RangePartitions class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_RANGE_DETAIL_RANGEPARTITIONS_HH
+#define ITERTOOLS_SRC_RANGE_DETAIL_RANGEPARTITIONS_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "core/DBC.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class RangePartitions
+ * \brief A view of a range split into balanced, contiguous partitions
+ *
+ * The partitions are computed on demand from the index of the partition, so
+ * the view neither allocates nor walks the underlying range.  When the size
+ * of the range is not a multiple of the number of partitions, the leading
+ * partitions hold one extra value.
+ *
+ * The underlying range type must provide \c size() and
+ * <tt>slice(offset, length)</tt>.
+ *
+ * \tparam RangeType  The type of the partitioned range
+ *
+ * \example range/tests/tstRange.cc
+ */
+//===========================================================================//
+
+template<typename RangeType>
+class RangePartitions
+{
+  public:
+    //! Public type aliases
+    using This = RangePartitions<RangeType>;
+    using value_type = RangeType;
+    using size_type = std::size_t;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+  public:
+    // Constructor
+    inline RangePartitions(const RangeType& range, size_type count);
+
+    //! Return the number of partitions
+    size_type size() const { return m_count; }
+
+    //! Return whether there are no partitions
+    bool empty() const { return m_count == 0; }
+
+    // Return the partition at index i
+    inline value_type operator[](size_type i) const;
+
+    // Return the offset of partition i in the underlying range
+    inline size_type offset(size_type i) const;
+
+    // Return the length of partition i
+    inline size_type length(size_type i) const;
+
+    //! Return beginning iterator
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    //! Return ending iterator
+    const_iterator end() const { return const_iterator(this, m_count); }
+
+  private:
+    // >>> DATA
+    //! The partitioned range
+    RangeType m_range;
+
+    //! The number of partitions
+    size_type m_count;
+
+    //! Minimum number of values in each partition
+    size_type m_quotient;
+
+    //! Number of leading partitions with one extra value
+    size_type m_remainder;
+};
+
+//===========================================================================//
+/*!
+ * \class RangePartitions::const_iterator
+ * \brief Forward iterator over the partitions of a range
+ */
+//===========================================================================//
+
+template<typename RangeType>
+class RangePartitions<RangeType>::const_iterator
+{
+  public:
+    //! Public type aliases
+    using difference_type = std::ptrdiff_t;
+    using value_type = RangeType;
+    using reference = value_type;
+    using pointer = void;
+    using iterator_category = std::forward_iterator_tag;
+
+  public:
+    //! Default constructor
+    const_iterator() = default;
+
+    //! Construct with the parent view and a partition index
+    const_iterator(const RangePartitions* parent, size_type index)
+        : m_parent(parent), m_index(index)
+    {
+    }
+
+    //! Dereference
+    reference operator*() const { return (*m_parent)[m_index]; }
+
+    //! Pre-increment
+    const_iterator& operator++()
+    {
+        ++m_index;
+        return *this;
+    }
+
+    //! Post-increment
+    const_iterator operator++(int)
+    {
+        const_iterator copy = *this;
+        ++m_index;
+        return copy;
+    }
+
+    //! Equality
+    bool operator==(const const_iterator& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    //! Inequality
+    bool operator!=(const const_iterator& other) const
+    {
+        return m_index != other.m_index;
+    }
+
+  private:
+    // >>> DATA
+    const RangePartitions* m_parent = nullptr;
+    size_type m_index = 0;
+};
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct a view of \p count partitions of \p range
+ *
+ * \param[in] range  The range to partition
+ * \param[in] count  The number of partitions
+ */
+template<typename RangeType>
+RangePartitions<RangeType>::RangePartitions(const RangeType& range,
+                                            size_type count)
+    : m_range(range)
+    , m_count(count)
+    , m_quotient(count > 0 ? range.size() / count : 0)
+    , m_remainder(count > 0 ? range.size() % count : 0)
+{
+    IT_REQUIRE(count > 0 || range.size() == 0);
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the partition at index \p i
+ *
+ * \param[in] i  The index of the partition
+ *
+ * \return The contiguous sub-range forming partition \p i
+ */
+template<typename RangeType>
+auto RangePartitions<RangeType>::operator[](size_type i) const -> value_type
+{
+    IT_REQUIRE(i < m_count);
+
+    return m_range.slice(this->offset(i), this->length(i));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the offset of partition \p i within the partitioned range
+ *
+ * \param[in] i  The index of the partition (may equal size())
+ *
+ * \return The index of the first value of partition \p i
+ */
+template<typename RangeType>
+auto RangePartitions<RangeType>::offset(size_type i) const -> size_type
+{
+    IT_REQUIRE(i <= m_count);
+
+    return i * m_quotient + std::min(i, m_remainder);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the number of values in partition \p i
+ *
+ * \param[in] i  The index of the partition
+ *
+ * \return The length of partition \p i
+ */
+template<typename RangeType>
+auto RangePartitions<RangeType>::length(size_type i) const -> size_type
+{
+    IT_REQUIRE(i < m_count);
+
+    return m_quotient + (i < m_remainder ? 1 : 0);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_RANGE_DETAIL_RANGEPARTITIONS_HH
+//---------------------------------------------------------------------------//
+// end of src/range/detail/RangePartitions.hh
+//---------------------------------------------------------------------------//
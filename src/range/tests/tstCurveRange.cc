@@ -0,0 +1,254 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/tests/tstCurveRange.cc
+ * \brief  Tests for class CurveRange and the space-filling curves.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../CurveRange.hh"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using itertools::HilbertCurve;
+using itertools::MortonCurve;
+using itertools::hilbertRange;
+using itertools::mortonRange;
+using itertools::range;
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+template<typename R>
+std::vector<typename R::value_type> collect(const R& r)
+{
+    return std::vector<typename R::value_type>(r.begin(), r.end());
+}
+
+// Bit-by-bit reference interleave, first coordinate most significant
+template<std::size_t Dims>
+std::uint64_t naiveInterleave(const std::array<std::uint64_t, Dims>& coords)
+{
+    std::uint64_t code = 0;
+    for (std::size_t bit = 0; bit * Dims < 64; ++bit)
+    {
+        for (std::size_t d = 0; d < Dims && bit * Dims + d < 64; ++d)
+        {
+            const std::uint64_t b = (coords[d] >> bit) & 1u;
+            code |= b << (bit * Dims + Dims - 1 - d);
+        }
+    }
+    return code;
+}
+
+// Whether two points differ by one along exactly one dimension
+template<typename A>
+bool adjacent(const A& a, const A& b)
+{
+    int distance = 0;
+    for (std::size_t d = 0; d < a.size(); ++d)
+    {
+        distance += std::abs(static_cast<int>(a[d]) - static_cast<int>(b[d]));
+    }
+    return distance == 1;
+}
+
+// Check that a curve visits every point of the index space once, in the
+// order of the curve codes
+template<typename Curve, std::size_t Dims>
+void checkCoverage(const std::array<int, Dims>& n)
+{
+    const auto r = itertools::CurveRange<Curve, Dims, int>(
+        std::apply([](auto... e) { return std::array{range(e)...}; }, n));
+    const auto points = collect(r);
+
+    std::size_t size = 1;
+    for (int e : n)
+    {
+        size *= e;
+    }
+    ASSERT_EQ(size, r.size());
+    ASSERT_EQ(size, points.size());
+    EXPECT_EQ(size,
+              (std::set<std::array<int, Dims>>(points.begin(), points.end())
+                   .size()));
+
+    std::uint64_t previous = 0;
+    for (auto iter = r.begin(); iter != r.end(); ++iter)
+    {
+        std::array<std::uint64_t, Dims> coords;
+        for (std::size_t d = 0; d < Dims; ++d)
+        {
+            EXPECT_LT((*iter)[d], n[d]);
+            coords[d] = (*iter)[d];
+        }
+        const auto code = Curve::template encode<Dims>(coords, r.order());
+        EXPECT_EQ(iter.code(), code);
+        EXPECT_TRUE(iter == r.begin() || previous < code);
+        previous = code;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// TRAITS
+//---------------------------------------------------------------------------//
+
+using Iter_t = itertools::CurveRange<MortonCurve, 2, int>::iterator;
+static_assert(std::is_same_v<std::iterator_traits<Iter_t>::iterator_category,
+                             std::forward_iterator_tag>);
+static_assert(std::is_same_v<std::iterator_traits<Iter_t>::value_type,
+                             std::array<int, 2>>);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(SpaceFillingCurvesTest, Interleave)
+{
+    using itertools::detail::deinterleave;
+    using itertools::detail::interleave;
+
+    std::uint64_t state = 12345;
+    auto next = [&state] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 11;
+    };
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const std::array<std::uint64_t, 2> c2 = {next() & 0xFFFFFFFF,
+                                                 next() & 0xFFFFFFFF};
+        EXPECT_EQ(naiveInterleave<2>(c2), interleave<2>(c2));
+        EXPECT_EQ(c2, deinterleave<2>(interleave<2>(c2)));
+
+        const std::array<std::uint64_t, 3> c3
+            = {next() & 0x1FFFFF, next() & 0x1FFFFF, next() & 0x1FFFFF};
+        EXPECT_EQ(naiveInterleave<3>(c3), interleave<3>(c3));
+        EXPECT_EQ(c3, deinterleave<3>(interleave<3>(c3)));
+
+        const std::array<std::uint64_t, 4> c4
+            = {next() & 0xFFFF, next() & 0xFFFF, next() & 0xFFFF,
+               next() & 0xFFFF};
+        EXPECT_EQ(naiveInterleave<4>(c4), interleave<4>(c4));
+        EXPECT_EQ(c4, deinterleave<4>(interleave<4>(c4)));
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(SpaceFillingCurvesTest, HilbertRoundTrip)
+{
+    for (unsigned int order = 1; order <= 5; ++order)
+    {
+        const std::uint64_t side = std::uint64_t(1) << order;
+        for (std::uint64_t code = 0; code < side * side * side; ++code)
+        {
+            const auto p = HilbertCurve::decode<3>(code, order);
+            for (auto c : p)
+            {
+                EXPECT_LT(c, side);
+            }
+            EXPECT_EQ(code, HilbertCurve::encode<3>(p, order));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(CurveRangeTest, Morton)
+{
+    const auto r = mortonRange(4, 4);
+    EXPECT_EQ(16, r.size());
+    EXPECT_EQ(2, r.order());
+
+    using A = std::array<int, 2>;
+    EXPECT_EQ((std::vector<A>{{0, 0},
+                              {0, 1},
+                              {1, 0},
+                              {1, 1},
+                              {0, 2},
+                              {0, 3},
+                              {1, 2},
+                              {1, 3},
+                              {2, 0},
+                              {2, 1},
+                              {3, 0},
+                              {3, 1},
+                              {2, 2},
+                              {2, 3},
+                              {3, 2},
+                              {3, 3}}),
+              collect(r));
+}
+
+//---------------------------------------------------------------------------//
+TEST(CurveRangeTest, HilbertAdjacency)
+{
+    const auto r2 = hilbertRange(16, 16);
+    const auto p2 = collect(r2);
+    ASSERT_EQ(256, p2.size());
+    EXPECT_EQ((std::array<int, 2>{0, 0}), p2.front());
+    for (std::size_t i = 1; i < p2.size(); ++i)
+    {
+        EXPECT_TRUE(adjacent(p2[i - 1], p2[i])) << "at " << i;
+    }
+
+    const auto r3 = hilbertRange(8, 8, 8);
+    const auto p3 = collect(r3);
+    ASSERT_EQ(512, p3.size());
+    for (std::size_t i = 1; i < p3.size(); ++i)
+    {
+        EXPECT_TRUE(adjacent(p3[i - 1], p3[i])) << "at " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(CurveRangeTest, Coverage)
+{
+    checkCoverage<MortonCurve, 2>({5, 3});
+    checkCoverage<MortonCurve, 2>({1, 17});
+    checkCoverage<MortonCurve, 3>({6, 9, 2});
+    checkCoverage<HilbertCurve, 2>({5, 3});
+    checkCoverage<HilbertCurve, 2>({33, 7});
+    checkCoverage<HilbertCurve, 3>({6, 9, 2});
+    checkCoverage<HilbertCurve, 3>({1, 1, 1});
+    checkCoverage<HilbertCurve, 4>({3, 2, 5, 2});
+}
+
+//---------------------------------------------------------------------------//
+TEST(CurveRangeTest, Ranges)
+{
+    const auto r = itertools::curveRange<MortonCurve>(range(10, 14, 2),
+                                                      range(3, 0, -1));
+    EXPECT_EQ(2, r.extents()[0]);
+    EXPECT_EQ(3, r.extents()[1]);
+
+    using A = std::array<int, 2>;
+    EXPECT_EQ(
+        (std::vector<A>{{10, 3}, {10, 2}, {12, 3}, {12, 2}, {10, 1}, {12, 1}}),
+        collect(r));
+}
+
+//---------------------------------------------------------------------------//
+TEST(CurveRangeTest, Empty)
+{
+    const auto r = hilbertRange(4, 0, 3);
+    EXPECT_TRUE(r.empty());
+    EXPECT_EQ(r.begin(), r.end());
+    EXPECT_TRUE(collect(r).empty());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/range/tests/tstCurveRange.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,210 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/tests/tstNdRange.cc
+ * \brief  Tests for class NdRange.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../NdRange.hh"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using itertools::ndRange;
+using itertools::range;
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+template<typename R>
+std::vector<typename R::value_type> collect(const R& r)
+{
+    return std::vector<typename R::value_type>(r.begin(), r.end());
+}
+
+// Reference tiled traversal of a 3-D index space from nested loops
+std::vector<std::array<int, 3>>
+tiledReference(const std::array<int, 3>& n, const std::array<int, 3>& t)
+{
+    std::vector<std::array<int, 3>> result;
+    for (int ti = 0; ti < n[0]; ti += t[0])
+        for (int tj = 0; tj < n[1]; tj += t[1])
+            for (int tk = 0; tk < n[2]; tk += t[2])
+                for (int i = ti; i < std::min(ti + t[0], n[0]); ++i)
+                    for (int j = tj; j < std::min(tj + t[1], n[1]); ++j)
+                        for (int k = tk; k < std::min(tk + t[2], n[2]); ++k)
+                            result.push_back({i, j, k});
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// TRAITS
+//---------------------------------------------------------------------------//
+
+using Iter_t = itertools::NdRange<2, int>::iterator;
+static_assert(std::is_same_v<std::iterator_traits<Iter_t>::iterator_category,
+                             std::random_access_iterator_tag>);
+static_assert(std::is_same_v<std::iterator_traits<Iter_t>::value_type,
+                             std::array<int, 2>>);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(NdRangeTest, RowMajor)
+{
+    const auto r = ndRange(2, 3);
+    EXPECT_EQ(6, r.size());
+    EXPECT_EQ(2, r.dims());
+
+    using A = std::array<int, 2>;
+    EXPECT_EQ((std::vector<A>{{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}}),
+              collect(r));
+
+    std::vector<int> sums;
+    for (auto [i, j] : r)
+    {
+        sums.push_back(10 * i + j);
+    }
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 10, 11, 12}), sums);
+}
+
+//---------------------------------------------------------------------------//
+TEST(NdRangeTest, Ranges)
+{
+    const auto r = ndRange(range(1, 7, 2), range(4, 0, -2));
+    using A = std::array<int, 2>;
+    EXPECT_EQ(
+        (std::vector<A>{{1, 4}, {1, 2}, {3, 4}, {3, 2}, {5, 4}, {5, 2}}),
+        collect(r));
+    EXPECT_EQ(3, r.extents()[0]);
+    EXPECT_EQ(2, r.extents()[1]);
+}
+
+//---------------------------------------------------------------------------//
+TEST(NdRangeTest, Empty)
+{
+    const auto r = ndRange(3, 0, 4);
+    EXPECT_TRUE(r.empty());
+    EXPECT_EQ(r.begin(), r.end());
+    EXPECT_TRUE(collect(r.tiled({2, 2, 2})).empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST(NdRangeTest, Tiled2D)
+{
+    const auto r = ndRange(3, 4).tiled({2, 3});
+    using A = std::array<int, 2>;
+    EXPECT_EQ((std::vector<A>{{0, 0},
+                              {0, 1},
+                              {0, 2},
+                              {1, 0},
+                              {1, 1},
+                              {1, 2},
+                              {0, 3},
+                              {1, 3},
+                              {2, 0},
+                              {2, 1},
+                              {2, 2},
+                              {2, 3}}),
+              collect(r));
+}
+
+//---------------------------------------------------------------------------//
+TEST(NdRangeTest, Tiled3D)
+{
+    const std::array<std::array<int, 3>, 4> shapes
+        = {{{5, 7, 3}, {4, 4, 4}, {1, 9, 2}, {6, 1, 5}}};
+    const std::array<std::array<int, 3>, 4> tiles
+        = {{{2, 3, 2}, {4, 4, 4}, {1, 1, 1}, {10, 2, 3}}};
+
+    for (const auto& n : shapes)
+    {
+        for (const auto& t : tiles)
+        {
+            const auto r = ndRange(n[0], n[1], n[2]).tiled(
+                {std::size_t(t[0]), std::size_t(t[1]), std::size_t(t[2])});
+            const auto expected = tiledReference(n, t);
+            EXPECT_EQ(expected, collect(r));
+
+            // Random access agrees with the incremental traversal
+            ASSERT_EQ(expected.size(), r.size());
+            for (std::size_t i = 0; i < r.size(); ++i)
+            {
+                EXPECT_EQ(expected[i], r[i]);
+            }
+
+            // Decrementing walks the traversal backwards
+            std::vector<std::array<int, 3>> backwards;
+            for (auto iter = r.end(); iter != r.begin();)
+            {
+                backwards.push_back(*--iter);
+            }
+            std::reverse(backwards.begin(), backwards.end());
+            EXPECT_EQ(expected, backwards);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(NdRangeTest, Arithmetic)
+{
+    const auto r = ndRange(4, 5).tiled({2, 2});
+    auto first = r.begin();
+    auto last = r.end();
+
+    EXPECT_EQ(20, last - first);
+    EXPECT_EQ(20, std::distance(first, last));
+
+    auto mid = first + 7;
+    EXPECT_EQ(7, mid - first);
+    EXPECT_EQ(r[7], *mid);
+    EXPECT_EQ(r[9], mid[2]);
+    EXPECT_EQ(mid, 7 + first);
+    EXPECT_EQ(first, mid - 7);
+    EXPECT_TRUE(first < mid && mid <= last && last > mid && mid >= first);
+
+    // Incrementing from a located position continues the traversal
+    std::vector<std::array<int, 2>> rest(mid, last);
+    const std::vector<std::array<int, 2>> tail(r.begin() + 7, r.end());
+    EXPECT_EQ(tail, rest);
+    EXPECT_EQ(collect(r.slice(7, 13)), rest);
+}
+
+//---------------------------------------------------------------------------//
+TEST(NdRangeTest, Split)
+{
+    const auto r = ndRange(range(0, 9), range(0, 11)).tiled({4, 4});
+    const auto expected = collect(r);
+
+    for (std::size_t count : {1, 2, 3, 7, 100, 200})
+    {
+        const auto parts = r.split(count);
+        EXPECT_EQ(count, parts.size());
+
+        std::vector<std::array<int, 2>> joined;
+        for (const auto& part : parts)
+        {
+            for (auto idx : part)
+            {
+                joined.push_back(idx);
+            }
+        }
+        EXPECT_EQ(expected, joined);
+    }
+
+    EXPECT_EQ(4, r.split(10, 20).size());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/range/tests/tstNdRange.cc
+//---------------------------------------------------------------------------//
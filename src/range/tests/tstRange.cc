@@ -0,0 +1,436 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/tests/tstRange.cc
+ * \brief  Tests for class Range.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Range.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/Exception.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+template<typename T>
+class RangeTest : public ::testing::Test
+{
+  protected:
+    template<typename R>
+    static std::vector<T> collect(const R& r)
+    {
+        std::vector<T> result;
+        for (auto v : r)
+        {
+            result.push_back(v);
+        }
+        return result;
+    }
+};
+
+using IntegralTypes = ::testing::Types<char,
+                                       std::int8_t,
+                                       std::uint8_t,
+                                       std::int16_t,
+                                       std::uint16_t,
+                                       std::int32_t,
+                                       std::uint32_t,
+                                       std::int64_t,
+                                       std::uint64_t>;
+TYPED_TEST_SUITE(RangeTest, IntegralTypes);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, EndOnly)
+{
+    using T = TypeParam;
+    auto r = itertools::range(T(5));
+
+    EXPECT_EQ(5, r.size());
+    EXPECT_FALSE(r.empty());
+    EXPECT_EQ(T(0), r.beginValue());
+    EXPECT_EQ(T(5), r.endValue());
+    EXPECT_EQ(T(1), r.step());
+    EXPECT_EQ((std::vector<T>{0, 1, 2, 3, 4}), this->collect(r));
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, Empty)
+{
+    using T = TypeParam;
+    auto r = itertools::range(T(7), T(7), T(3));
+
+    EXPECT_EQ(0, r.size());
+    EXPECT_TRUE(r.empty());
+    EXPECT_TRUE(r.begin() == r.end());
+    EXPECT_TRUE(this->collect(r).empty());
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, UnevenStep)
+{
+    using T = TypeParam;
+
+    // The step does not divide the span, so the ending value is aligned
+    auto r = itertools::range(T(1), T(11), T(3));
+    EXPECT_EQ(4, r.size());
+    EXPECT_EQ(T(13), r.endValue());
+    EXPECT_EQ((std::vector<T>{1, 4, 7, 10}), this->collect(r));
+
+    // The step divides the span
+    auto s = itertools::range(T(1), T(10), T(3));
+    EXPECT_EQ(3, s.size());
+    EXPECT_EQ(T(10), s.endValue());
+    EXPECT_EQ((std::vector<T>{1, 4, 7}), this->collect(s));
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, NegativeStep)
+{
+    using T = TypeParam;
+    if constexpr (std::is_signed_v<T>)
+    {
+        auto r = itertools::range(T(10), T(-1), T(-4));
+        EXPECT_EQ(3, r.size());
+        EXPECT_EQ(T(-2), r.endValue());
+        EXPECT_EQ((std::vector<T>{10, 6, 2}), this->collect(r));
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, Limits)
+{
+    using T = TypeParam;
+    using limits = std::numeric_limits<T>;
+
+    // Span the full type, excluding the maximum which is the aligned end
+    auto r = itertools::range(limits::min(), limits::max());
+    EXPECT_EQ(std::size_t(limits::max()) - std::size_t(limits::min()),
+              r.size());
+    EXPECT_EQ(limits::max(), r.endValue());
+
+    auto count = r.size();
+    if (count <= 0xffff)
+    {
+        EXPECT_EQ(count, this->collect(r).size());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, MaxValue)
+{
+    using T = TypeParam;
+    using limits = std::numeric_limits<T>;
+
+    // The value past the last one is not representable
+    auto top = itertools::range(T(limits::max() - 10), limits::max(), T(3));
+    EXPECT_EQ(4, top.size());
+    EXPECT_EQ((std::vector<T>{T(limits::max() - 10),
+                              T(limits::max() - 7),
+                              T(limits::max() - 4),
+                              T(limits::max() - 1)}),
+              this->collect(top));
+
+    if constexpr (std::is_signed_v<T>)
+    {
+        auto bottom
+            = itertools::range(T(limits::min() + 10), limits::min(), T(-3));
+        EXPECT_EQ((std::vector<T>{T(limits::min() + 10),
+                                  T(limits::min() + 7),
+                                  T(limits::min() + 4),
+                                  T(limits::min() + 1)}),
+                  this->collect(bottom));
+    }
+
+    // Every other value of the type ends with the largest even offset
+    auto r = itertools::range(limits::min(), limits::max(), T(2));
+    const std::size_t count = std::size_t(1) << (8 * sizeof(T) - 1);
+    EXPECT_EQ(count, r.size());
+    EXPECT_EQ(count, std::size_t(std::distance(r.begin(), r.end())));
+    EXPECT_EQ(T(limits::max() - 1), *std::prev(r.end()));
+    EXPECT_EQ(T(limits::max() - 1), r[count - 1]);
+    if (count <= 0xffff)
+    {
+        auto values = this->collect(r);
+        EXPECT_EQ(count, values.size());
+        EXPECT_EQ(T(limits::max() - 1), values.back());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, Slice)
+{
+    using T = TypeParam;
+    auto r = itertools::range(T(2), T(40), T(3));
+
+    auto s = r.slice(3, 4);
+    EXPECT_EQ(4, s.size());
+    EXPECT_EQ(T(3), s.step());
+    EXPECT_EQ((std::vector<T>{11, 14, 17, 20}), this->collect(s));
+
+    EXPECT_TRUE(r.slice(r.size(), 0).empty());
+    EXPECT_EQ(this->collect(r), this->collect(r.slice(0, r.size())));
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, Split)
+{
+    using T = TypeParam;
+    auto r = itertools::range(T(1), T(24), T(2));
+    ASSERT_EQ(12, r.size());
+
+    // Five partitions of 12 values: 3, 3, 2, 2, 2
+    auto parts = r.split(5);
+    ASSERT_EQ(5, parts.size());
+
+    std::vector<std::size_t> sizes;
+    std::vector<T> joined;
+    for (auto part : parts)
+    {
+        sizes.push_back(part.size());
+        EXPECT_EQ(T(2), part.step());
+        auto values = this->collect(part);
+        joined.insert(joined.end(), values.begin(), values.end());
+    }
+    EXPECT_EQ((std::vector<std::size_t>{3, 3, 2, 2, 2}), sizes);
+    EXPECT_EQ(this->collect(r), joined);
+    EXPECT_EQ(T(17), parts[3].beginValue());
+    EXPECT_EQ(T(21), parts[3].endValue());
+
+    // More partitions than values
+    auto many = r.split(20);
+    EXPECT_EQ(20, many.size());
+    EXPECT_EQ(1, many[11].size());
+    EXPECT_TRUE(many[12].empty());
+    EXPECT_TRUE(many[19].empty());
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, SplitGrain)
+{
+    using T = TypeParam;
+    auto r = itertools::range(T(0), T(100));
+
+    // Grain limits the number of partitions
+    auto parts = r.split(16, 30);
+    ASSERT_EQ(3, parts.size());
+    EXPECT_EQ(34, parts[0].size());
+    EXPECT_EQ(33, parts[2].size());
+
+    // Count limits the number of partitions
+    EXPECT_EQ(4, r.split(4, 10).size());
+
+    // Small ranges produce a single partition
+    auto small = itertools::range(T(0), T(5)).split(8, 10);
+    ASSERT_EQ(1, small.size());
+    EXPECT_EQ(5, small[0].size());
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, SplitNegativeStep)
+{
+    using T = TypeParam;
+    if constexpr (std::is_signed_v<T>)
+    {
+        auto r = itertools::range(T(20), T(-3), T(-3));
+        ASSERT_EQ(8, r.size());
+
+        auto parts = r.split(3);
+        EXPECT_EQ((std::vector<T>{20, 17, 14}), this->collect(parts[0]));
+        EXPECT_EQ((std::vector<T>{11, 8, 5}), this->collect(parts[1]));
+        EXPECT_EQ((std::vector<T>{2, -1}), this->collect(parts[2]));
+        EXPECT_EQ(T(-4), parts[2].endValue());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(RangeTest, Blocks)
+{
+    using T = TypeParam;
+    auto r = itertools::range(T(3), T(60), T(5));
+    ASSERT_EQ(12, r.size());
+
+    // Two full blocks of 5 and a tail of 2
+    auto blocks = r.template blocks<5>();
+    ASSERT_EQ(3, blocks.size());
+    EXPECT_EQ(0, blocks.lead());
+
+    std::vector<T> joined;
+    for (auto block : blocks)
+    {
+        EXPECT_EQ(5, block.width());
+        EXPECT_EQ(T(5), block.step());
+        auto values = this->collect(block);
+        joined.insert(joined.end(), values.begin(), values.end());
+    }
+    EXPECT_EQ(this->collect(r), joined);
+
+    EXPECT_TRUE(blocks[1].full());
+    EXPECT_EQ(28, blocks[1].start());
+    EXPECT_EQ(T(38), blocks[1][2]);
+    EXPECT_EQ(0b11111u, blocks[1].mask());
+
+    auto tail = blocks[2];
+    EXPECT_FALSE(tail.full());
+    EXPECT_EQ(2, tail.size());
+    EXPECT_EQ(0, tail.firstLane());
+    EXPECT_EQ(2, tail.lastLane());
+    EXPECT_EQ(0b00011u, tail.mask());
+    EXPECT_TRUE(tail.active(1));
+    EXPECT_FALSE(tail.active(2));
+    EXPECT_EQ((std::vector<T>{53, 58}), this->collect(tail));
+
+    // Exact multiple and empty ranges have no partial block
+    EXPECT_TRUE(itertools::range(T(16)).template blocks<8>()[1].full());
+    EXPECT_TRUE(itertools::range(T(0)).template blocks<8>().empty());
+
+    if constexpr (std::is_signed_v<T>)
+    {
+        auto down = itertools::range(T(10), T(-1), T(-1)).template blocks<4>();
+        ASSERT_EQ(3, down.size());
+        EXPECT_EQ((std::vector<T>{6, 5, 4, 3}), this->collect(down[1]));
+        EXPECT_EQ((std::vector<T>{2, 1, 0}), this->collect(down[2]));
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeBlocksTest, Aligned)
+{
+    constexpr std::size_t width = 8;
+    alignas(64) float data[64] = {};
+
+    for (std::size_t shift = 0; shift < width; ++shift)
+    {
+        const float* base = data + shift;
+        for (int begin : {0, 1, 5, 8, 13})
+        {
+            auto r = itertools::range(begin, 40);
+            auto blocks = r.alignedBlocks<width>(base);
+            EXPECT_EQ((shift + begin) % width, blocks.lead());
+
+            std::vector<int> joined;
+            for (std::size_t b = 0; b < blocks.size(); ++b)
+            {
+                auto block = blocks[b];
+
+                // Every block starts on an aligned address
+                const auto address
+                    = reinterpret_cast<std::uintptr_t>(base + block.start());
+                EXPECT_EQ(0, address % (width * sizeof(float)));
+
+                // Only the first and last blocks are partial
+                if (b > 0 && b + 1 < blocks.size())
+                {
+                    EXPECT_TRUE(block.full());
+                }
+                EXPECT_EQ(b == 0 ? blocks.lead() : 0, block.firstLane());
+
+                for (std::size_t lane = 0; lane < width; ++lane)
+                {
+                    EXPECT_EQ(block.active(lane),
+                              ((block.mask() >> lane) & 1u) != 0);
+                }
+                for (auto i : block)
+                {
+                    joined.push_back(i);
+                }
+            }
+
+            std::vector<int> expected;
+            for (auto i : r)
+            {
+                expected.push_back(i);
+            }
+            EXPECT_EQ(expected, joined);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeBlocksTest, AlignedUnsigned)
+{
+    constexpr std::size_t width = 8;
+    alignas(64) float data[64] = {};
+    const float* base = data + 3;
+
+    // Lane 0 of the first block precedes zero
+    auto blocks = itertools::range<std::uint32_t>(0, 20).alignedBlocks<width>(
+        base);
+    ASSERT_EQ(3, blocks.size());
+    EXPECT_EQ(3, blocks.lead());
+
+    auto first = blocks[0];
+    EXPECT_EQ(-3, first.start());
+    EXPECT_EQ(base - 3, base + first.start());
+    EXPECT_EQ(0u, first[3]);
+    EXPECT_EQ(5, blocks[1].start());
+
+    std::vector<std::uint32_t> joined;
+    for (auto block : blocks)
+    {
+        const auto address
+            = reinterpret_cast<std::uintptr_t>(base + block.start());
+        EXPECT_EQ(0, address % (width * sizeof(float)));
+        for (auto i : block)
+        {
+            joined.push_back(i);
+        }
+    }
+    EXPECT_EQ(20, joined.size());
+    EXPECT_EQ(19u, joined.back());
+
+    // Values beyond the signed range of the type
+    auto high = itertools::range<std::uint8_t>(200, 210).blocks<4>();
+    EXPECT_EQ(204, high[1].start());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeDBCTest, Preconditions)
+{
+    if (!ITERTOOLS_DBC)
+    {
+        GTEST_SKIP() << "DBC checks are disabled";
+    }
+
+    // Zero step
+    EXPECT_THROW(itertools::range(0, 10, 0), itertools::DBCException);
+
+    // Step points away from the end
+    EXPECT_THROW(itertools::range(0, 10, -1), itertools::DBCException);
+
+    // Aligned blocks need a unit step
+    const float data[4] = {};
+    EXPECT_THROW(itertools::range(0, 4, 2).alignedBlocks<4>(data),
+                 itertools::DBCException);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/range/tests/tstRange.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,176 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/tests/tstRangeIterator.cc
+ * \brief  Tests for class RangeIterator.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../detail/RangeIterator.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <execution>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../Range.hh"
+
+using itertools::detail::makeRangeIterator;
+using itertools::detail::RangeIterator;
+
+//---------------------------------------------------------------------------//
+// TRAITS
+//---------------------------------------------------------------------------//
+
+using Traits_t = std::iterator_traits<RangeIterator<int>>;
+static_assert(std::is_same_v<Traits_t::iterator_category,
+                             std::random_access_iterator_tag>);
+static_assert(std::is_same_v<Traits_t::value_type, int>);
+static_assert(std::is_same_v<Traits_t::reference, int>);
+static_assert(std::is_same_v<Traits_t::difference_type, std::ptrdiff_t>);
+static_assert(std::is_trivially_copyable_v<RangeIterator<int>>);
+static_assert(std::is_same_v<decltype(std::declval<RangeIterator<char>>()
+                                      + std::ptrdiff_t(1)),
+                             RangeIterator<char>>);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(RangeIteratorTest, Arithmetic)
+{
+    auto iter = makeRangeIterator(4, 3);
+
+    EXPECT_EQ(4, *iter);
+    EXPECT_EQ(7, *++iter);
+    EXPECT_EQ(7, *iter++);
+    EXPECT_EQ(10, *iter);
+    EXPECT_EQ(7, *--iter);
+    EXPECT_EQ(7, *iter--);
+    EXPECT_EQ(4, *iter);
+
+    EXPECT_EQ(19, *(iter + 5));
+    EXPECT_EQ(19, *(5 + iter));
+    EXPECT_EQ(-2, *(iter - 2));
+    EXPECT_EQ(16, iter[4]);
+    EXPECT_EQ(1, iter[-1]);
+
+    iter += 3;
+    EXPECT_EQ(13, *iter);
+    iter -= 4;
+    EXPECT_EQ(1, *iter);
+
+    EXPECT_EQ(5, (iter + 5) - iter);
+    EXPECT_EQ(-5, iter - (iter + 5));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeIteratorTest, NegativeStep)
+{
+    auto first = makeRangeIterator(10, -2);
+    auto last = makeRangeIterator(0, -2, 5);
+
+    EXPECT_EQ(5, last - first);
+    EXPECT_EQ(5, std::distance(first, last));
+    EXPECT_TRUE(first < last);
+    EXPECT_TRUE(first <= last);
+    EXPECT_FALSE(first > last);
+    EXPECT_FALSE(first >= last);
+    EXPECT_EQ(4, first[3]);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeIteratorTest, UnsignedLimits)
+{
+    const std::uint64_t big = std::uint64_t(1) << 63;
+    auto first = makeRangeIterator<std::uint64_t>(big - 4, 2);
+    auto last = makeRangeIterator<std::uint64_t>(big + 6, 2, 5);
+
+    EXPECT_EQ(5, last - first);
+    EXPECT_EQ(big + 2, first[3]);
+    EXPECT_EQ(big - 4, *(last - 5));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeIteratorTest, PastTheLimits)
+{
+    // Positions are compared, so stepping past the largest value is exact
+    auto first = makeRangeIterator<std::uint8_t>(250, 3);
+    auto last = first + 2;
+
+    EXPECT_EQ(253, first[1]);
+    EXPECT_EQ(2, last - first);
+    EXPECT_TRUE(first + 2 == last);
+    EXPECT_TRUE(first + 1 < last);
+    EXPECT_EQ(253, *--last);
+
+    auto low = makeRangeIterator<std::int8_t>(-126, -2);
+    EXPECT_EQ(-128, *++low);
+    EXPECT_EQ(1, low.index());
+    EXPECT_EQ(2, (low + 1) - (low - 1));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeIteratorTest, StandardAlgorithms)
+{
+    auto r = itertools::range(3, 40, 4);
+    ASSERT_EQ(10, r.size());
+
+    EXPECT_EQ(10, std::distance(r.begin(), r.end()));
+    EXPECT_EQ(19, r[4]);
+
+    // Binary search requires random access to be efficient
+    auto iter = std::lower_bound(r.begin(), r.end(), 20);
+    EXPECT_EQ(5, iter - r.begin());
+    EXPECT_EQ(23, *iter);
+
+    std::vector<int> values(r.begin(), r.end());
+    EXPECT_EQ(3, values.front());
+    EXPECT_EQ(39, values.back());
+
+    std::vector<int> reversed(std::make_reverse_iterator(r.end()),
+                              std::make_reverse_iterator(r.begin()));
+    EXPECT_EQ(39, reversed.front());
+    EXPECT_EQ(3, reversed.back());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(RangeIteratorTest, ParallelAlgorithms)
+{
+    auto r = itertools::range(0L, 100000L, 3L);
+    std::vector<std::atomic<int>> visited(100000);
+
+    std::for_each(std::execution::par_unseq,
+                  r.begin(),
+                  r.end(),
+                  [&visited](long i) { visited[i].fetch_add(1); });
+
+    for (long i = 0; i < 100000; ++i)
+    {
+        EXPECT_EQ(i % 3 == 0 ? 1 : 0, visited[i].load());
+    }
+
+    auto total = std::transform_reduce(std::execution::par,
+                                       r.begin(),
+                                       r.end(),
+                                       0L,
+                                       std::plus<>(),
+                                       [](long i) { return i; });
+    EXPECT_EQ(std::accumulate(r.begin(), r.end(), 0L), total);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/range/tests/tstRangeIterator.cc
+//---------------------------------------------------------------------------//
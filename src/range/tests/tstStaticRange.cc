@@ -0,0 +1,135 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/tests/tstStaticRange.cc
+ * \brief  Tests for class StaticRange.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../StaticRange.hh"
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using itertools::StaticRange;
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+template<typename R>
+std::vector<typename R::value_type> collect(const R& r)
+{
+    std::vector<typename R::value_type> result;
+    for (auto v : r)
+    {
+        result.push_back(v);
+    }
+    return result;
+}
+
+template<typename R>
+std::vector<typename R::value_type> collectUnrolled()
+{
+    std::vector<typename R::value_type> result;
+    R::forEach([&result](auto v) { result.push_back(v); });
+    return result;
+}
+
+// Sum of the values of a static range, computed at compile time
+template<typename R>
+constexpr long staticSum()
+{
+    long sum = 0;
+    R::forEach([&sum](auto v) { sum += decltype(v)::value; });
+    return sum;
+}
+
+//---------------------------------------------------------------------------//
+// COMPILE-TIME PROPERTIES
+//---------------------------------------------------------------------------//
+
+static_assert(StaticRange<0, 4>::size() == 4);
+static_assert(StaticRange<0, 10, 3>::size() == 4);
+static_assert(StaticRange<0, 10, 3>::endValue() == 12);
+static_assert(StaticRange<8, 0, -2>::size() == 4);
+static_assert(StaticRange<3, 3>::empty());
+static_assert(StaticRange<1, 4>::value<2> == 3);
+static_assert(std::is_same_v<StaticRange<0, 4u>::value_type, unsigned int>);
+static_assert(std::is_same_v<
+              StaticRange<std::int8_t(0), std::int8_t(8)>::value_type,
+              std::int8_t>);
+static_assert(staticSum<StaticRange<1, 5>>() == 10);
+static_assert(staticSum<StaticRange<-3, 4, 3>>() == 0);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(StaticRangeTest, Values)
+{
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), collect(StaticRange<0, 4>()));
+    EXPECT_EQ((std::vector<int>{0, 3, 6, 9}),
+              collect(StaticRange<0, 10, 3>()));
+    EXPECT_EQ((std::vector<int>{8, 6, 4, 2}),
+              collect(StaticRange<8, 0, -2>()));
+    EXPECT_TRUE(collect(StaticRange<3, 3>()).empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST(StaticRangeTest, Unsigned)
+{
+    using R = StaticRange<std::uint8_t(100), std::uint8_t(180), 25>;
+    EXPECT_EQ(4, R::size());
+    EXPECT_EQ((std::vector<std::uint8_t>{100, 125, 150, 175}), collect(R()));
+    EXPECT_EQ(collect(R()), collectUnrolled<R>());
+
+    using Down = StaticRange<10u, 0u, -5>;
+    EXPECT_EQ((std::vector<unsigned int>{10, 5}), collectUnrolled<Down>());
+}
+
+//---------------------------------------------------------------------------//
+TEST(StaticRangeTest, ForEach)
+{
+    using Stencil = StaticRange<0, 27>;
+    EXPECT_EQ(collect(Stencil()), collectUnrolled<Stencil>());
+
+    using Down = StaticRange<8, 0, -2>;
+    EXPECT_EQ((std::vector<int>{8, 6, 4, 2}), collectUnrolled<Down>());
+
+    using Empty = StaticRange<5, 5>;
+    EXPECT_TRUE(collectUnrolled<Empty>().empty());
+
+    // Values are constant expressions
+    const std::tuple<int, double, char> t{1, 2.5, 'c'};
+    double sum = 0;
+    StaticRange<0, 3>::forEach(
+        [&](auto i) { sum += std::get<decltype(i)::value>(t); });
+    EXPECT_DOUBLE_EQ(1 + 2.5 + 'c', sum);
+}
+
+//---------------------------------------------------------------------------//
+TEST(StaticRangeTest, ForEachIterator)
+{
+    std::array<int, 8> a;
+    std::iota(a.begin(), a.end(), 0);
+
+    std::vector<int> visited;
+    StaticRange<1, 8, 2>::forEach(a.begin(),
+                                  [&visited](int v) { visited.push_back(v); });
+    EXPECT_EQ((std::vector<int>{1, 3, 5, 7}), visited);
+
+    StaticRange<0, 4>::forEach(a.data() + 4, [](int& v) { v = -v; });
+    EXPECT_EQ((std::array<int, 8>{0, 1, 2, 3, -4, -5, -6, -7}), a);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/range/tests/tstStaticRange.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,87 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/range/tests/vecRange.cc
+ * \brief  Kernels that must vectorize when looping over a Range.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Range.hh"
+
+#include <cstddef>
+#include <cstdint>
+
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+// The loops marked "// vectorized" are checked by the vecRange test.
+
+void saxpyPtrdiff(float a, const float* x, float* y, std::ptrdiff_t n)
+{
+    for (auto i : itertools::range(n))  // vectorized
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void saxpyInt(float a, const float* x, float* y, int n)
+{
+    for (auto i : itertools::range(n))  // vectorized
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void saxpyUint64(float a, const float* x, float* y, std::uint64_t n)
+{
+    for (auto i : itertools::range(n))  // vectorized
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void saxpyOffset(float a, const float* x, float* y, std::ptrdiff_t n)
+{
+    for (auto i : itertools::range<std::ptrdiff_t>(3, n))  // vectorized
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void saxpyStrided(float a, const float* x, float* y, std::ptrdiff_t n)
+{
+    for (auto i : itertools::range<std::ptrdiff_t>(0, n, 2))  // vectorized
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void saxpyReversed(float a, const float* x, float* y, std::ptrdiff_t n)
+{
+    const auto reversed = itertools::range<std::ptrdiff_t>(n - 1, -1, -1);
+    for (auto i : reversed)  // vectorized
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+int sum(const int* x, std::ptrdiff_t n)
+{
+    int result = 0;
+    for (auto i : itertools::range(n))  // vectorized
+    {
+        result += x[i];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// end of src/range/tests/vecRange.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,343 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/Indirect.hh
+ * \brief  IndirectRange class and gather function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_INDIRECT_HH
+#define ITERTOOLS_SRC_ZIP_INDIRECT_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/DBC.hh"
+#include "core/Macros.hh"
+#include "detail/IndirectIterator.hh"
+#include "detail/ZipIterator.hh"
+#include "detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class IndirectRange
+ * \brief The elements of a sequence selected by a sequence of indices
+ *
+ * Indirect ranges are created by indirect().  Iterating yields
+ * <tt>data[indices[i]]</tt> for each position \c i of the indices, as
+ * references into the data, and the range composes with zip():
+ * \code
+ * // Gather the vertex coordinates of the faces of a mesh
+ * for (auto [xf, xv] : zip(x_face, indirect(x_vertex, face_vertex)))
+ * {
+ *     xf = xv;
+ * }
+ * \endcode
+ * The data and indices are not copied and must outlive the range.  Loops
+ * dominated by the latency of the gathered loads should use gatherForEach(),
+ * which prefetches the elements ahead of their use.
+ *
+ * \example zip/tests/tstIndirect.cc
+ */
+//===========================================================================//
+
+template<typename DataIterator, typename IndexIterator>
+class IndirectRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = detail::IndirectIterator<DataIterator, IndexIterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+    using reference = typename iterator::reference;
+    using size_type = std::size_t;
+    //@}
+
+  public:
+    //! Construct with the data and the range of indices
+    IndirectRange(DataIterator data, IndexIterator first, IndexIterator last)
+        : m_begin(data, first), m_end(data, last)
+    {
+    }
+
+    //! Return beginning iterator
+    iterator begin() const { return m_begin; }
+
+    //! Return ending iterator
+    iterator end() const { return m_end; }
+
+    //! Return the number of elements
+    size_type size() const { return static_cast<size_type>(m_end - m_begin); }
+
+    //! Return whether the range is empty
+    bool empty() const { return m_begin == m_end; }
+
+    //! Return the element at position i
+    reference operator[](size_type i) const
+    {
+        return m_begin[static_cast<typename iterator::difference_type>(i)];
+    }
+
+  private:
+    // >>> DATA
+    iterator m_begin;
+    iterator m_end;
+};
+
+//---------------------------------------------------------------------------//
+//! Order in which gatherForEach visits the elements of a batch
+enum class GatherOrder
+{
+    original,  //!< The order of the indices
+    sorted     //!< Increasing indices, for locality in the data
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Select the elements of a sequence with a sequence of indices
+template<typename DataRange, typename IndexRange>
+inline IndirectRange<detail::range_iterator_t<DataRange>,
+                     detail::range_iterator_t<IndexRange>>
+indirect(DataRange&& data, IndexRange&& indices);
+
+// Apply a function to the elements of [first, last), prefetching the
+// gathered elements one batch ahead
+template<typename Iterator, typename Function>
+inline void gatherForEach(Iterator first,
+                          Iterator last,
+                          Function&& function,
+                          std::size_t batch = 64,
+                          GatherOrder order = GatherOrder::original);
+
+// Apply a function to the elements of a range, prefetching the gathered
+// elements one batch ahead
+template<typename RangeType, typename Function>
+inline void gatherForEach(RangeType&& range,
+                          Function&& function,
+                          std::size_t batch = 64,
+                          GatherOrder order = GatherOrder::original);
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Whether an iterator is an indirect iterator
+template<typename Iterator>
+struct is_indirect_iterator : public std::false_type
+{
+};
+template<typename DataIterator, typename IndexIterator>
+struct is_indirect_iterator<IndirectIterator<DataIterator, IndexIterator>>
+    : public std::true_type
+{
+};
+template<typename Iterator>
+constexpr bool is_indirect_iterator_v = is_indirect_iterator<Iterator>::value;
+
+//---------------------------------------------------------------------------//
+// Prefetch the element n positions after an iterator
+template<typename Iterator, typename Difference>
+inline void prefetchElement(const Iterator& iter, Difference n)
+{
+    if constexpr (is_indirect_iterator_v<Iterator>)
+    {
+        ITERTOOLS_PREFETCH(std::addressof(iter.data()[iter.indexIter()[n]]),
+                           0,
+                           3);
+    }
+    else if constexpr (is_contiguous_iterator_v<Iterator>)
+    {
+        ITERTOOLS_PREFETCH(std::addressof(iter[n]), 0, 3);
+    }
+    else if constexpr (is_zip_iterator_v<Iterator>)
+    {
+        std::apply([n](const auto&... streams)
+                   { (prefetchElement(streams, n), ...); },
+                   iter.getIters());
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Return the index gathered n positions after an indirect iterator, or after
+// the first stream of a zip iterator; other iterators gather position n
+template<typename Iterator, typename Difference>
+inline auto gatherIndex(const Iterator& iter, Difference n)
+{
+    if constexpr (is_zip_iterator_v<Iterator>)
+    {
+        return gatherIndex(iter.template get<0>(), n);
+    }
+    else if constexpr (is_indirect_iterator_v<Iterator>)
+    {
+        return iter.indexIter()[n];
+    }
+    else
+    {
+        return n;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Select the elements of a sequence with a sequence of indices
+ *
+ * \param[in] data     A random-access sequence
+ * \param[in] indices  The positions of the selected elements in \p data
+ *
+ * \return A range over <tt>data[indices[i]]</tt>
+ */
+template<typename DataRange, typename IndexRange>
+IndirectRange<detail::range_iterator_t<DataRange>,
+              detail::range_iterator_t<IndexRange>>
+indirect(DataRange&& data, IndexRange&& indices)
+{
+    using std::begin;
+    using std::end;
+    return IndirectRange<detail::range_iterator_t<DataRange>,
+                         detail::range_iterator_t<IndexRange>>(
+        begin(data), begin(indices), end(indices));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply \p function to the elements of [\p first, \p last),
+ *        prefetching the gathered elements one batch ahead
+ *
+ * The elements are processed in batches of \p batch positions.  Before a
+ * batch is processed, the indices of the next one are read and the elements
+ * they select are prefetched, so that the gathered loads of a batch overlap
+ * the work on the previous one; \p batch should cover the memory latency.
+ * Every stream of a zip is prefetched: indirect streams at their gathered
+ * elements and contiguous streams at their positions.
+ *
+ * With GatherOrder::sorted, the positions of each batch are visited in order
+ * of increasing index (of the first stream of a zip), which makes elements
+ * sharing cache lines or pages adjacent; ranges that are not indirect keep
+ * their order.  \p function still receives the element of each position, so
+ * the outputs zipped with the gather land at their original positions:
+ * \code
+ * gatherForEach(zip(indirect(x, idx), y), [](auto elem) {
+ *     auto [xi, yi] = elem;
+ *     yi = 2 * xi;
+ * }, 128, GatherOrder::sorted);
+ * \endcode
+ * The function must then not depend on the order of the positions.
+ *
+ * \param[in] first     The beginning of the elements
+ * \param[in] last      The ending of the elements
+ * \param[in] function  The function applied to each element
+ * \param[in] batch     The number of positions per batch
+ * \param[in] order     The order of the positions within a batch
+ */
+template<typename Iterator, typename Function>
+void gatherForEach(Iterator first,
+                   Iterator last,
+                   Function&& function,
+                   std::size_t batch,
+                   GatherOrder order)
+{
+    static_assert(
+        std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>,
+        "gatherForEach requires random-access iterators");
+    IT_REQUIRE(batch > 0);
+    IT_REQUIRE(!(last < first));
+
+    using Difference_t =
+        typename std::iterator_traits<Iterator>::difference_type;
+
+    const Difference_t n = last - first;
+    const auto step = static_cast<Difference_t>(batch);
+    auto prefetch = [first](Difference_t begin, Difference_t end) {
+        for (Difference_t i = begin; i < end; ++i)
+        {
+            detail::prefetchElement(first, i);
+        }
+    };
+
+    std::vector<Difference_t> positions;
+    if (order == GatherOrder::sorted)
+    {
+        positions.resize(batch);
+    }
+
+    prefetch(0, std::min(step, n));
+    for (Difference_t begin = 0; begin < n; begin += step)
+    {
+        const Difference_t end = std::min(begin + step, n);
+        prefetch(end, std::min(end + step, n));
+
+        if (order == GatherOrder::original)
+        {
+            for (Difference_t i = begin; i < end; ++i)
+            {
+                function(first[i]);
+            }
+        }
+        else
+        {
+            const auto last_position = positions.begin() + (end - begin);
+            std::iota(positions.begin(), last_position, begin);
+            std::sort(positions.begin(),
+                      last_position,
+                      [&first](Difference_t i, Difference_t j) {
+                          return detail::gatherIndex(first, i)
+                                 < detail::gatherIndex(first, j);
+                      });
+            for (auto pos = positions.begin(); pos != last_position; ++pos)
+            {
+                function(first[*pos]);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply \p function to the elements of \p range, prefetching the
+ *        gathered elements one batch ahead
+ *
+ * \param[in] range     A random-access range, e.g., an indirect range or a
+ *                      zip of one
+ * \param[in] function  The function applied to each element
+ * \param[in] batch     The number of positions per batch
+ * \param[in] order     The order of the positions within a batch
+ */
+template<typename RangeType, typename Function>
+void gatherForEach(RangeType&& range,
+                   Function&& function,
+                   std::size_t batch,
+                   GatherOrder order)
+{
+    using std::begin;
+    using std::end;
+    gatherForEach(begin(range),
+                  end(range),
+                  std::forward<Function>(function),
+                  batch,
+                  order);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_INDIRECT_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/Indirect.hh
+//---------------------------------------------------------------------------//
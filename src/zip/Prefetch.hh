@@ -0,0 +1,174 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/Prefetch.hh
+ * \brief  PrefetchRange class and prefetched function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_PREFETCH_HH
+#define ITERTOOLS_SRC_ZIP_PREFETCH_HH
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "detail/PrefetchIterator.hh"
+#include "detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class PrefetchRange
+ * \brief A random-access sequence iterated with prefetch iterators
+ *
+ * Prefetch ranges are created by prefetched() and are meant to be zipped with
+ * other sequences.  They do not copy the sequence, which must outlive them.
+ * Besides contiguous sequences, they accept indirect and strided ones, such
+ * as the ranges of indirect() and the columns of aosColumns():
+ * \code
+ * for (auto&& [xi, yi] : zip(prefetched<16>(indirect(x, indices)), y))
+ * {
+ *     yi += xi;
+ * }
+ * \endcode
+ *
+ * \example zip/tests/tstPrefetch.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+class PrefetchRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = detail::PrefetchIterator<Iterator, Distance, Access>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+    using size_type = std::size_t;
+    //@}
+
+  public:
+    //! Construct with the beginning and ending iterators of the sequence
+    PrefetchRange(Iterator first, Iterator last)
+        : m_begin(first, last), m_end(last, last)
+    {
+    }
+
+    //! Return beginning iterator
+    iterator begin() const { return m_begin; }
+
+    //! Return ending iterator
+    iterator end() const { return m_end; }
+
+    //! Return the number of elements
+    size_type size() const { return static_cast<size_type>(m_end - m_begin); }
+
+    //! Return whether the range is empty
+    bool empty() const { return m_begin == m_end; }
+
+  private:
+    // >>> DATA
+    iterator m_begin;
+    iterator m_end;
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Whether a type is a range rather than an iterator
+template<typename T, typename = void>
+struct is_range : public std::false_type
+{
+};
+template<typename T>
+struct is_range<T, std::void_t<range_iterator_t<T>>> : public std::true_type
+{
+};
+template<typename T>
+constexpr bool is_range_v = is_range<T>::value;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Wrap a contiguous iterator to prefetch Distance elements ahead
+template<std::ptrdiff_t Distance,
+         PrefetchAccess Access = PrefetchAccess::read,
+         typename Iterator,
+         std::enable_if_t<!detail::is_range_v<Iterator>, bool> = true>
+inline detail::PrefetchIterator<Iterator, Distance, Access>
+prefetched(Iterator iter);
+
+// Iterate over a random-access sequence prefetching Distance elements ahead
+template<std::ptrdiff_t Distance,
+         PrefetchAccess Access = PrefetchAccess::read,
+         typename RangeType,
+         std::enable_if_t<detail::is_range_v<RangeType>, bool> = true>
+inline PrefetchRange<detail::range_iterator_t<RangeType>, Distance, Access>
+prefetched(RangeType&& range);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Wrap a contiguous iterator to prefetch \c Distance elements ahead
+ *
+ * \tparam Distance  The prefetch distance, in elements
+ * \tparam Access    Whether the elements will be read or written
+ *
+ * \param[in] iter  The contiguous iterator
+ *
+ * \return A prefetch iterator at the position of \p iter
+ */
+template<std::ptrdiff_t Distance,
+         PrefetchAccess Access,
+         typename Iterator,
+         std::enable_if_t<!detail::is_range_v<Iterator>, bool>>
+detail::PrefetchIterator<Iterator, Distance, Access> prefetched(Iterator iter)
+{
+    return detail::PrefetchIterator<Iterator, Distance, Access>(iter);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Iterate over a random-access sequence prefetching \c Distance
+ *        elements ahead
+ *
+ * Non-contiguous sequences, whose iterators cannot be wrapped alone, must be
+ * prefetched through this overload.
+ *
+ * \tparam Distance  The prefetch distance, in elements
+ * \tparam Access    Whether the elements will be read or written
+ *
+ * \param[in] range  The sequence, e.g., a vector, an indirect range or a
+ *                   column of structures
+ *
+ * \return A range over the sequence with prefetch iterators
+ */
+template<std::ptrdiff_t Distance,
+         PrefetchAccess Access,
+         typename RangeType,
+         std::enable_if_t<detail::is_range_v<RangeType>, bool>>
+PrefetchRange<detail::range_iterator_t<RangeType>, Distance, Access>
+prefetched(RangeType&& range)
+{
+    using std::begin;
+    using std::end;
+    return PrefetchRange<detail::range_iterator_t<RangeType>,
+                         Distance,
+                         Access>(begin(range), end(range));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_PREFETCH_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/Prefetch.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,185 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/RadixSort.hh
+ * \brief  radixSort function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_RADIXSORT_HH
+#define ITERTOOLS_SRC_ZIP_RADIXSORT_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "core/DBC.hh"
+#include "detail/RadixSortPass.hh"
+
+namespace itertools
+{
+//---------------------------------------------------------------------------//
+// SORTING
+//---------------------------------------------------------------------------//
+// Sort [first, last) by key with a least-significant-digit radix sort
+template<typename Iterator>
+inline void radixSort(Iterator first, Iterator last);
+
+// Sort a range by key with a least-significant-digit radix sort
+template<typename RangeType>
+inline void radixSort(RangeType&& range);
+
+namespace detail
+{
+//! Number of elements below which radixSort falls back to a merge sort
+constexpr std::size_t radix_sort_cutoff = 256;
+
+// Stable comparison sort of [first, last) by key
+template<typename Iterator>
+inline void radixFallbackSort(Iterator first, Iterator last);
+}  // namespace detail
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Sort [\p first, \p last) by key with a least-significant-digit
+ *        radix sort
+ *
+ * When \p first is a ZipIterator, the keys are the elements of its first
+ * stream and the elements of the other streams (the payloads) are permuted
+ * with them:
+ * \code
+ * radixSort(zip(keys, x, y));
+ * \endcode
+ * Otherwise the elements are the keys.  Keys are integers or IEEE floating
+ * point numbers, ordered as by \c operator< except that -0 precedes +0 (see
+ * detail::RadixKey).
+ *
+ * The keys are sorted one 8-bit digit at a time.  A first sweep counts the
+ * digits of every pass; each pass then scatters all the columns together from
+ * one buffer to the other, so the columns are read and written once per pass
+ * whatever their number.  Passes in which every key has the same digit are
+ * skipped.  The sort is stable, needs one scratch copy of every column (whose
+ * value types must be default constructible), and falls back to a merge sort
+ * below \c radix_sort_cutoff elements.
+ *
+ * \tparam Iterator  A random-access iterator, or a ZipIterator over
+ *                   random-access iterators
+ *
+ * \param[in] first  The beginning of the elements
+ * \param[in] last   The ending of the elements
+ */
+template<typename Iterator>
+void radixSort(Iterator first, Iterator last)
+{
+    static_assert(
+        std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>,
+        "radixSort requires random-access iterators");
+    IT_REQUIRE(!(last < first));
+
+    using Columns_t = detail::radix_columns_t<Iterator>;
+    using Indices_t = std::make_index_sequence<std::tuple_size_v<Columns_t>>;
+
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n < detail::radix_sort_cutoff)
+    {
+        detail::radixFallbackSort(first, last);
+        return;
+    }
+
+    const Columns_t columns = detail::radixColumns(first);
+    detail::radix_histograms_t<Iterator> histograms{};
+    detail::radixCountAll(std::get<0>(columns), 0, n, histograms);
+
+    detail::RadixBuffers<Columns_t> buffers(n);
+    const auto scratch = buffers.columns();
+
+    // Alternate between the columns and the scratch buffers
+    bool in_scratch = false;
+    for (std::size_t pass = 0; pass < histograms.size(); ++pass)
+    {
+        detail::RadixHistogram& offsets = histograms[pass];
+        if (detail::radixPassIsTrivial(offsets, n))
+        {
+            continue;
+        }
+        std::size_t sum = 0;
+        for (std::size_t& count : offsets)
+        {
+            sum += std::exchange(count, sum);
+        }
+
+        if (in_scratch)
+        {
+            detail::radixScatter(
+                scratch, columns, 0, n, pass, offsets, Indices_t());
+        }
+        else
+        {
+            detail::radixScatter(
+                columns, scratch, 0, n, pass, offsets, Indices_t());
+        }
+        in_scratch = !in_scratch;
+    }
+    if (in_scratch)
+    {
+        detail::radixMove(scratch, columns, 0, n, Indices_t());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sort \p range by key with a least-significant-digit radix sort
+ *
+ * \param[in] range  A range with random-access iterators, e.g., a zip
+ */
+template<typename RangeType>
+void radixSort(RangeType&& range)
+{
+    using std::begin;
+    using std::end;
+    radixSort(begin(range), end(range));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Stable comparison sort of [\p first, \p last) by key
+ *
+ * The keys are compared through their radix bits, so the order is the same
+ * as the radix sort's.
+ *
+ * \param[in] first  The beginning of the elements
+ * \param[in] last   The ending of the elements
+ */
+template<typename Iterator>
+void detail::radixFallbackSort(Iterator first, Iterator last)
+{
+    using Radix_t = RadixKey<radix_key_t<Iterator>>;
+
+    std::stable_sort(
+        first, last, [](const auto& lhs, const auto& rhs) {
+            if constexpr (is_zip_iterator_v<Iterator>)
+            {
+                return Radix_t::bits(std::get<0>(lhs))
+                       < Radix_t::bits(std::get<0>(rhs));
+            }
+            else
+            {
+                return Radix_t::bits(lhs) < Radix_t::bits(rhs);
+            }
+        });
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_RADIXSORT_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/RadixSort.hh
+//---------------------------------------------------------------------------//
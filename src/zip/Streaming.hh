@@ -0,0 +1,208 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/Streaming.hh
+ * \brief  StreamingRange class and streamed function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_STREAMING_HH
+#define ITERTOOLS_SRC_ZIP_STREAMING_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "core/DBC.hh"
+#include "detail/NonTemporal.hh"
+#include "detail/StreamingIterator.hh"
+#include "detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class StreamingRange
+ * \brief A contiguous output sequence written with non-temporal stores
+ *
+ * A streaming range buffers the cache line of the sequence being written and
+ * stores every completed line with non-temporal instructions, which bypass
+ * the caches and skip reading the line from memory before overwriting it.
+ * This halves the memory traffic of large writes and leaves the caches to
+ * the data that is read.  It is meant for outputs that are much larger than
+ * the last-level cache and are not read again soon; small outputs are
+ * faster with ordinary stores.
+ *
+ * The range is zipped with the inputs, each output stream having its own
+ * line buffer:
+ * \code
+ * auto out_y = streamed(y);
+ * auto out_z = streamed(z);
+ * for (auto [xi, yi, zi] : zip(x, out_y, out_z))
+ * {
+ *     yi = 2 * xi;
+ *     zi = xi * xi;
+ * }
+ * \endcode
+ *
+ * Dereferencing yields a proxy reference that records assignments in the
+ * buffer, so only the elements actually assigned are written: a loop may
+ * skip elements or exit early.  This bookkeeping costs several instructions
+ * per element and keeps the loop from being vectorized.  Kernels that can
+ * compute a block of elements at a time should store it with store(), which
+ * streams the whole lines of the block directly from the source:
+ * \code
+ * auto out = streamed(y);
+ * float block[256];
+ * for (std::size_t i = 0; i < n; i += 256)
+ * {
+ *     const std::size_t count = std::min<std::size_t>(256, n - i);
+ *     for (std::size_t k = 0; k < count; ++k) { block[k] = 2 * x[i + k]; }
+ *     out.store(i, block, count);
+ * }
+ * \endcode
+ * Lines that are not written whole, such as the partial lines at the ends of
+ * the sequence, are written with ordinary stores.  The buffered line is
+ * written out and the stores are fenced when an iterator reaches the end of
+ * the sequence, by flush(), and on destruction.
+ *
+ * Since the iterators refer to the line buffer, the range cannot be copied
+ * or moved and must outlive them: declare it as a variable rather than
+ * zipping a temporary.  For the same reason, a streaming range and its
+ * iterators may only be used by one thread at a time, which their forward
+ * category enforces for parallelFor; to write a sequence in parallel, give
+ * each thread a StreamingRange of its own part of the sequence.  On targets
+ * without non-temporal stores (see \c ITERTOOLS_HAVE_NONTEMPORAL_STORES),
+ * the lines are written with ordinary stores.
+ *
+ * \tparam T  The element type, trivially copyable with a size dividing a
+ *            cache line
+ *
+ * \example zip/tests/tstStreaming.cc
+ */
+//===========================================================================//
+
+template<typename T>
+class StreamingRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = detail::StreamingIterator<T>;
+    using value_type = T;
+    using size_type = std::size_t;
+    //@}
+
+    //! Whether the lines bypass the caches on this target
+    static constexpr bool is_nontemporal = ITERTOOLS_HAVE_NONTEMPORAL_STORES;
+
+  public:
+    // Construct with the beginning and ending pointers of the sequence
+    inline StreamingRange(T* first, T* last);
+
+    // Not copyable or movable: iterators refer to the buffer
+    StreamingRange(const StreamingRange&) = delete;
+    StreamingRange& operator=(const StreamingRange&) = delete;
+
+    //! Return beginning iterator
+    iterator begin() { return iterator(m_first, m_last, &m_buffer); }
+
+    //! Return ending iterator
+    iterator end() { return iterator(m_last, m_last, &m_buffer); }
+
+    //! Return the number of elements
+    size_type size() const { return static_cast<size_type>(m_last - m_first); }
+
+    //! Return whether the range is empty
+    bool empty() const { return m_first == m_last; }
+
+    // Store a block of elements starting at position pos
+    inline void store(size_type pos, const T* values, size_type count);
+
+    //! Write out the buffered line and fence the non-temporal stores
+    void flush() { m_buffer.flush(); }
+
+  private:
+    // >>> DATA
+    detail::StreamingBuffer<T> m_buffer;
+    T* m_first;
+    T* m_last;
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Write a contiguous sequence with non-temporal stores
+template<typename RangeType>
+inline StreamingRange<
+    std::remove_reference_t<decltype(*std::data(std::declval<RangeType&>()))>>
+streamed(RangeType& range);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Construct with the beginning and ending pointers of the sequence
+ *
+ * \param[in] first  The first element
+ * \param[in] last   The end of the sequence
+ */
+template<typename T>
+StreamingRange<T>::StreamingRange(T* first, T* last)
+    : m_first(first), m_last(last)
+{
+    IT_REQUIRE(m_first <= m_last);
+    IT_REQUIRE(reinterpret_cast<std::uintptr_t>(m_first) % sizeof(T) == 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Store a block of elements starting at position \p pos
+ *
+ * Blocks stored in turn need not be aligned to the cache lines: a line left
+ * partial by one block is completed by the next one.
+ *
+ * \param[in] pos     The position of the first element in the range
+ * \param[in] values  The elements to store
+ * \param[in] count   The number of elements
+ */
+template<typename T>
+void StreamingRange<T>::store(size_type pos, const T* values, size_type count)
+{
+    IT_REQUIRE(pos + count <= this->size());
+
+    m_buffer.store(m_first + pos, values, count);
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write a contiguous sequence with non-temporal stores
+ *
+ * \param[in] range  The contiguous sequence, e.g., a vector or an array
+ *
+ * \return A streaming range over the sequence, to be declared as a variable
+ */
+template<typename RangeType>
+StreamingRange<
+    std::remove_reference_t<decltype(*std::data(std::declval<RangeType&>()))>>
+streamed(RangeType& range)
+{
+    static_assert(
+        detail::is_contiguous_iterator_v<detail::range_iterator_t<RangeType>>,
+        "only contiguous sequences can be streamed");
+
+    auto* const first = std::data(range);
+    return StreamingRange<std::remove_reference_t<decltype(*first)>>(
+        first, first + std::size(range));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_STREAMING_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/Streaming.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,486 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/Transpose.hh
+ * \brief  ColumnRange class and AoS/SoA transposition function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_TRANSPOSE_HH
+#define ITERTOOLS_SRC_ZIP_TRANSPOSE_HH
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "core/DBC.hh"
+#include "detail/MemberIterator.hh"
+#include "detail/ZipIteratorTraits.hh"
+#include "Zip.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class ColumnRange
+ * \brief One data member of a sequence of records, viewed as a column
+ *
+ * Column ranges are created by aosColumns(), which presents an array of
+ * structures as one strided column per member.  The columns are sized and
+ * have the category of the records, so they zip with each other and with
+ * ordinary arrays:
+ * \code
+ * struct Particle { double x, y, z, mass; };
+ * auto [x, mass] = aosColumns<&Particle::x, &Particle::mass>(particles);
+ * for (auto [xi, mi, fi] : zip(x, mass, force)) { fi = mi * g(xi); }
+ * \endcode
+ * The records are not copied and must outlive the column.
+ *
+ * \example zip/tests/tstTranspose.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, auto Member>
+class ColumnRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = detail::MemberIterator<Iterator, Member>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+    using reference = typename iterator::reference;
+    using size_type = std::size_t;
+    //@}
+
+  public:
+    //! Construct with the beginning and ending iterators of the records
+    ColumnRange(Iterator first, Iterator last) : m_begin(first), m_end(last)
+    {
+    }
+
+    //! Return beginning iterator
+    iterator begin() const { return m_begin; }
+
+    //! Return ending iterator
+    iterator end() const { return m_end; }
+
+    //! Return the number of elements
+    size_type size() const
+    {
+        return static_cast<size_type>(std::distance(m_begin, m_end));
+    }
+
+    //! Return whether the column is empty
+    bool empty() const { return m_begin == m_end; }
+
+    //! Return the member of the record at position i (random access only)
+    reference operator[](size_type i) const
+    {
+        return m_begin[static_cast<typename iterator::difference_type>(i)];
+    }
+
+  private:
+    // >>> DATA
+    iterator m_begin;
+    iterator m_end;
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Type of a zip over the elements of a tuple of columns
+template<typename ColumnTuple, typename Indices>
+struct soa_range;
+template<typename ColumnTuple, std::size_t... I>
+struct soa_range<ColumnTuple, std::index_sequence<I...>>
+{
+    using type = zip_range_t<
+        std::remove_reference_t<decltype(std::get<I>(
+            std::declval<std::remove_reference_t<ColumnTuple>&>()))>...>;
+};
+template<typename ColumnTuple>
+using soa_range_t = typename soa_range<
+    ColumnTuple,
+    std::make_index_sequence<
+        std::tuple_size_v<std::remove_reference_t<ColumnTuple>>>>::type;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// View the members of an array of structures as columns
+template<auto... Members, typename RecordRange>
+inline std::tuple<ColumnRange<detail::range_iterator_t<RecordRange>,
+                              Members>...>
+aosColumns(RecordRange&& records);
+
+// View a tuple of columns as a sequence of records
+template<typename ColumnTuple>
+inline detail::soa_range_t<ColumnTuple> soaView(ColumnTuple&& columns);
+
+// Copy the members of an array of structures into columns
+template<auto... Members, typename RecordRange, typename... Columns>
+inline void transposeInto(const RecordRange& records,
+                          const std::tuple<Columns&...>& columns);
+
+// Copy columns into the members of an array of structures
+template<auto... Members, typename... Columns, typename RecordRange>
+inline void transposeInto(const std::tuple<Columns&...>& columns,
+                          RecordRange&& records);
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// TRANSPOSITION KERNELS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Copy \p n records of \c K interleaved elements into \c K arrays
+ *
+ * The stride and the offsets are compile-time constants, so the compiler
+ * vectorizes the loop with shuffles that split each group of loaded records
+ * into the columns (e.g., 3-way de-interleaving of floats).  The loop is
+ * checked by the vecZipIterator test.
+ *
+ * \param[in]  src  The records, as an array of \c K * \p n elements
+ * \param[out] dst  The column of each element of a record, in memory order
+ * \param[in]  n    The number of records
+ */
+template<std::size_t K, typename T, std::size_t... I>
+inline void deinterleave(const T* src,
+                         T* const (&dst)[K],
+                         std::ptrdiff_t n,
+                         std::index_sequence<I...>)
+{
+    T* const columns[K] = {dst[I]...};
+    for (std::ptrdiff_t i = 0; i < n; ++i)  // vectorized
+    {
+        ((columns[I][i] = src[K * i + I]), ...);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Copy \c K arrays of \p n elements into \p n interleaved records
+ *
+ * Vectorized like deinterleave(), with interleaving shuffles; some of them
+ * (e.g., 3-way interleaving of floats) need more than SSE2.
+ *
+ * \param[in]  src  The column of each element of a record, in memory order
+ * \param[out] dst  The records, as an array of \c K * \p n elements
+ * \param[in]  n    The number of records
+ */
+template<std::size_t K, typename T, std::size_t... I>
+inline void interleave(const T* const (&src)[K],
+                       T* dst,
+                       std::ptrdiff_t n,
+                       std::index_sequence<I...>)
+{
+    const T* const columns[K] = {src[I]...};
+    for (std::ptrdiff_t i = 0; i < n; ++i)  // vectorized
+    {
+        ((dst[K * i + I] = columns[I][i]), ...);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Whether records and columns can be transposed by the kernels
+ *
+ * The records and the columns must be contiguous, and the selected members
+ * must be all the members of the record, of a single trivially copyable
+ * type: the record is then an array of \c K elements.
+ */
+template<typename RecordIterator, typename ColumnIterators, auto... Members>
+struct is_transposable;
+template<typename RecordIterator, typename... ColumnIterators, auto... Members>
+struct is_transposable<RecordIterator,
+                       std::tuple<ColumnIterators...>,
+                       Members...>
+{
+    using Record_t = typename std::iterator_traits<RecordIterator>::value_type;
+    using Element_t = std::tuple_element_t<
+        0,
+        std::tuple<
+            typename MemberIterator<RecordIterator, Members>::value_type...>>;
+
+    static constexpr bool value
+        = sizeof...(Members) >= 2
+          && is_contiguous_iterator_v<RecordIterator>
+          && (is_contiguous_iterator_v<ColumnIterators> && ...)
+          && (std::is_same_v<
+                  Element_t,
+                  typename MemberIterator<RecordIterator,
+                                          Members>::value_type> && ...)
+          && (std::is_same_v<
+                  Element_t,
+                  typename std::iterator_traits<ColumnIterators>::value_type>
+              && ...)
+          && std::is_trivially_copyable_v<Element_t>
+          && sizeof(Record_t) == sizeof...(Members) * sizeof(Element_t);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the position in the record of each member
+ *
+ * \param[in]  record     A record
+ * \param[out] positions  The index of each member among the elements of the
+ *                        record
+ *
+ * \return Whether the members are distinct, i.e., cover the whole record
+ */
+template<typename Element, typename Record, auto... Members>
+inline bool memberPositions(const Record& record,
+                            std::size_t (&positions)[sizeof...(Members)])
+{
+    constexpr std::size_t K = sizeof...(Members);
+    const auto* const base = reinterpret_cast<const char*>(&record);
+
+    std::size_t k = 0;
+    ((positions[k++] = static_cast<std::size_t>(
+                           reinterpret_cast<const char*>(&(record.*Members))
+                           - base)
+                       / sizeof(Element)),
+     ...);
+
+    bool covered[K] = {};
+    for (std::size_t position : positions)
+    {
+        if (position >= K || covered[position])
+        {
+            return false;
+        }
+        covered[position] = true;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+//! Direction of a copy between records and columns
+enum class TransposeDirection
+{
+    to_columns,  //!< Members of the records into the columns
+    to_records   //!< Columns into the members of the records
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Copy between the members of an array of structures and columns
+ *
+ * Implements both overloads of transposeInto: the sizes are checked and the
+ * iterators set up the same way, then the copy is done by deinterleave() or
+ * interleave() when the records and columns are transposable, or member by
+ * member otherwise.
+ *
+ * \tparam Direction  Whether the records or the columns are written
+ * \tparam Members    Pointers to the data members, one per column
+ *
+ * \param[in,out] records  The records
+ * \param[in,out] columns  A tuple of references to the columns, each at
+ *                         least as long as \p records
+ */
+template<TransposeDirection Direction,
+         auto... Members,
+         typename RecordRange,
+         typename... Columns>
+inline void
+transpose(RecordRange&& records, const std::tuple<Columns&...>& columns)
+{
+    static_assert(sizeof...(Members) == sizeof...(Columns),
+                  "there must be one column per member");
+
+    using std::begin;
+    using std::size;
+    using RecordIter_t = range_iterator_t<RecordRange>;
+    using Columns_t = std::tuple<range_iterator_t<Columns>...>;
+    using Transposable_t
+        = is_transposable<RecordIter_t, Columns_t, Members...>;
+    constexpr bool to_columns = (Direction == TransposeDirection::to_columns);
+
+    const auto n = static_cast<std::ptrdiff_t>(size(records));
+    IT_REQUIRE(std::apply(
+        [n](const auto&... column) {
+            return ((static_cast<std::ptrdiff_t>(size(column)) >= n) && ...);
+        },
+        columns));
+    if (n == 0)
+    {
+        return;
+    }
+
+    RecordIter_t record = begin(records);
+    Columns_t column_iters = std::apply(
+        [](auto&... column) { return Columns_t(begin(column)...); }, columns);
+
+    if constexpr (Transposable_t::value)
+    {
+        using Element_t = typename Transposable_t::Element_t;
+        using Pointer_t
+            = std::conditional_t<to_columns, Element_t*, const Element_t*>;
+        constexpr std::size_t K = sizeof...(Members);
+
+        std::size_t positions[K];
+        if (memberPositions<Element_t,
+                            typename Transposable_t::Record_t,
+                            Members...>(*record, positions))
+        {
+            Pointer_t pointers[K];
+            std::size_t k = 0;
+            std::apply(
+                [&](auto&... iter) {
+                    ((pointers[positions[k++]] = std::addressof(*iter)), ...);
+                },
+                column_iters);
+
+            auto* const base = std::addressof(*record);
+            if constexpr (to_columns)
+            {
+                deinterleave<K>(reinterpret_cast<const Element_t*>(base),
+                                pointers,
+                                n,
+                                std::make_index_sequence<K>());
+            }
+            else
+            {
+                interleave<K>(pointers,
+                              reinterpret_cast<Element_t*>(base),
+                              n,
+                              std::make_index_sequence<K>());
+            }
+            return;
+        }
+    }
+
+    std::apply(
+        [&](auto&... iter) {
+            for (std::ptrdiff_t i = 0; i < n; ++i, ++record)
+            {
+                if constexpr (to_columns)
+                {
+                    ((*iter = (*record).*Members, ++iter), ...);
+                }
+                else
+                {
+                    (((*record).*Members = *iter, ++iter), ...);
+                }
+            }
+        },
+        column_iters);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief View the members of an array of structures as columns
+ *
+ * \tparam Members  Pointers to the data members, e.g., <tt>&Particle::x</tt>
+ *
+ * \param[in] records  The records, e.g., a vector of structures
+ *
+ * \return A tuple of one column range per member, which can be unpacked with
+ *         structured bindings
+ */
+template<auto... Members, typename RecordRange>
+std::tuple<ColumnRange<detail::range_iterator_t<RecordRange>, Members>...>
+aosColumns(RecordRange&& records)
+{
+    static_assert(sizeof...(Members) > 0, "no member selected");
+
+    using std::begin;
+    using std::end;
+    return {ColumnRange<detail::range_iterator_t<RecordRange>, Members>(
+        begin(records), end(records))...};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief View a tuple of columns as a sequence of records
+ *
+ * The columns are zipped, so each record is a tuple of references to the
+ * elements of the columns at one position:
+ * \code
+ * auto columns = std::tie(x, y, z);
+ * for (auto [xi, yi, zi] : soaView(columns)) { ... }
+ * \endcode
+ *
+ * \param[in] columns  A tuple of columns or of references to columns, which
+ *                     must outlive the view
+ *
+ * \return A zip range over the columns, up to the end of the shortest one
+ */
+template<typename ColumnTuple>
+detail::soa_range_t<ColumnTuple> soaView(ColumnTuple&& columns)
+{
+    return std::apply(
+        [](auto&... column) { return zip(column...); }, columns);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Copy the members of an array of structures into columns
+ *
+ * The records are read once, and the \c k-th member of every record is
+ * written to the \c k-th column:
+ * \code
+ * transposeInto<&Vec3::x, &Vec3::y, &Vec3::z>(points, std::tie(x, y, z));
+ * \endcode
+ * When the records and columns are contiguous and the members are all the
+ * members of the record, of a single type (e.g., <tt>struct { float x, y,
+ * z; }</tt>), the copy is done by a kernel that the compiler vectorizes with
+ * de-interleaving shuffles.  Otherwise, the members are copied record by
+ * record.
+ *
+ * \tparam Members  Pointers to the data members, one per column
+ *
+ * \param[in]  records  The records
+ * \param[out] columns  A tuple of references to the columns (e.g., made by
+ *                      \c std::tie), each at least as long as \p records
+ */
+template<auto... Members, typename RecordRange, typename... Columns>
+void transposeInto(const RecordRange& records,
+                   const std::tuple<Columns&...>& columns)
+{
+    detail::transpose<detail::TransposeDirection::to_columns, Members...>(
+        records, columns);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Copy columns into the members of an array of structures
+ *
+ * The inverse of the other overload: the \c k-th column is written to the
+ * \c k-th member of every record, in a single pass over the records, and
+ * with an interleaving kernel under the same conditions.  Members that are
+ * not selected are left untouched.
+ *
+ * \tparam Members  Pointers to the data members, one per column
+ *
+ * \param[in]  columns  A tuple of references to the columns, each at least
+ *                      as long as \p records
+ * \param[out] records  The records
+ */
+template<auto... Members, typename... Columns, typename RecordRange>
+void transposeInto(const std::tuple<Columns&...>& columns,
+                   RecordRange&& records)
+{
+    detail::transpose<detail::TransposeDirection::to_records, Members...>(
+        std::forward<RecordRange>(records), columns);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_TRANSPOSE_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/Transpose.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,142 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/Unzip.hh
+ * \brief  Unzip function declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_UNZIP_HH
+#define ITERTOOLS_SRC_ZIP_UNZIP_HH
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "detail/UnzipIterator.hh"
+#include "detail/ZipIteratorTraits.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Whether a range of tuples is unzipped by the indexed kernel
+template<typename Range, typename... Outputs>
+constexpr bool is_indexed_unzip_v
+    = std::is_same_v<range_iterator_t<Range>, range_sentinel_t<Range>>
+      && std::is_base_of_v<std::random_access_iterator_tag,
+                           typename std::iterator_traits<
+                               range_iterator_t<Range>>::iterator_category>
+      && (is_contiguous_iterator_v<Outputs> && ...);
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write the elements of \p n tuples to contiguous outputs
+ *
+ * The outputs are raw pointers indexed like the tuples, and the assignment of
+ * the elements is unrolled over the outputs, so for tuples of arithmetic
+ * types the compiler vectorizes the loop into strided loads and contiguous
+ * stores.  The loop is checked by the vecZipIterator test.
+ *
+ * \param[in]  first    Iterator to the first tuple
+ * \param[in]  n        The number of tuples
+ * \param[out] outputs  Pointers to the first element of each output
+ */
+template<typename Iterator, typename... Pointers, std::size_t... I>
+inline void unzipIndexed(Iterator first,
+                         std::ptrdiff_t n,
+                         std::tuple<Pointers...> outputs,
+                         std::index_sequence<I...>)
+{
+    using std::get;
+    for (std::ptrdiff_t i = 0; i < n; ++i)  // vectorized
+    {
+        auto&& values = first[i];
+        ((std::get<I>(outputs)[i] = get<I>(values)), ...);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Write the elements of a range of tuples to separate outputs
+template<typename Range, typename... Outputs>
+inline std::tuple<Outputs...> unzip(Range&& tuples, Outputs... outputs);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+/*!
+ * \brief Write the elements of a range of tuples to separate outputs
+ *
+ * Reads the tuples once and writes the \c k-th element of each tuple through
+ * the \c k-th output iterator, replacing one \c std::transform pass over the
+ * tuples per element:
+ * \code
+ * std::vector<std::pair<int, double>> pairs = ...;
+ * unzip(pairs, keys.begin(), values.begin());
+ * \endcode
+ * The tuples are any tuple-like values, including the references of a zip
+ * range.  When the range has random access and the outputs are contiguous,
+ * the tuples are written by an indexed kernel that vectorizes; otherwise,
+ * the outputs are plain output iterators (e.g., \c std::back_inserter) written
+ * through an UnzipIterator.
+ *
+ * \param[in]  tuples   The range of tuples
+ * \param[out] outputs  The output iterators, one per element of the tuples
+ *
+ * \return The output iterators past the last element written
+ */
+template<typename Range, typename... Outputs>
+std::tuple<Outputs...> unzip(Range&& tuples, Outputs... outputs)
+{
+    using Reference_t
+        = decltype(*std::declval<detail::range_iterator_t<Range>&>());
+    static_assert(
+        std::tuple_size<std::decay_t<Reference_t>>::value
+            == sizeof...(Outputs),
+        "there must be one output per element of the tuples");
+
+    using std::begin;
+    using std::end;
+    auto first = begin(tuples);
+    auto last = end(tuples);
+
+    if constexpr (detail::is_indexed_unzip_v<Range, Outputs...>)
+    {
+        const std::ptrdiff_t n = last - first;
+        if (n > 0)
+        {
+            detail::unzipIndexed(
+                first,
+                n,
+                std::make_tuple(std::addressof(*outputs)...),
+                std::index_sequence_for<Outputs...>());
+        }
+        return std::tuple<Outputs...>(std::next(outputs, n)...);
+    }
+    else
+    {
+        UnzipIterator<Outputs...> out(std::move(outputs)...);
+        for (; first != last; ++first, ++out)
+        {
+            *out = *first;
+        }
+        return out.base();
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_UNZIP_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/Unzip.hh
+//---------------------------------------------------------------------------//
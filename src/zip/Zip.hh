@@ -0,0 +1,277 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/Zip.hh
+ * \brief  ZipRange class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_ZIP_HH
+#define ITERTOOLS_SRC_ZIP_ZIP_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "detail/ZipIterator.hh"
+#include "detail/ZipIteratorTraits.hh"
+#include "detail/ZipLongestIterator.hh"
+#include "detail/ZipSentinel.hh"
+#include "detail/ZipStorage.hh"
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class ZipRange
+ * \brief An iterable view of several sequences in lockstep
+ *
+ * Zip ranges are created by zip() and zipLongest().  When the sizes of all
+ * the sequences are known, the length of the zip is computed once at
+ * construction and its ending iterator is positioned accordingly, so a loop
+ * over the zip tests a single iterator per iteration and never runs past the
+ * end of a shorter sequence:
+ * \code
+ * for (auto [xi, yi] : zip(x, y)) { yi += a * xi; }
+ * \endcode
+ * Otherwise, zip() ends at a sentinel that tests every sequence for its end
+ * in each iteration.
+ *
+ * The sequences are not copied: they must outlive the zip range, except for
+ * views such as Range whose iterators do not refer to them.
+ *
+ * \tparam Iterator  The iterator type
+ * \tparam Sentinel  The type of the ending iterator
+ * \tparam Sized     Whether the length of the zip is known
+ *
+ * \example zip/tests/tstZip.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, typename Sentinel, bool Sized>
+class ZipRange
+{
+  public:
+    //@{
+    //! Public type aliases
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+    using sentinel = Sentinel;
+    using value_type = typename Iterator::value_type;
+    using reference = typename Iterator::reference;
+    using size_type = std::size_t;
+    //@}
+
+    //! Whether the length of the zip is known
+    static constexpr bool is_sized = Sized;
+
+  public:
+    // Construct with the beginning and ending iterators and the length
+    inline ZipRange(Iterator first, Sentinel last, size_type size);
+
+    //! Return beginning iterator
+    iterator begin() const { return m_begin; }
+
+    //! Return const beginning iterator
+    const_iterator cbegin() const { return m_begin; }
+
+    //! Return ending iterator
+    sentinel end() const { return m_end; }
+
+    //! Return const ending iterator
+    sentinel cend() const { return m_end; }
+
+    // Return the number of elements in the zip
+    inline size_type size() const;
+
+    //! Return whether the zip is empty
+    bool empty() const { return m_begin == m_end; }
+
+  private:
+    // >>> DATA
+    Iterator m_begin;
+    Sentinel m_end;
+    size_type m_size;
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Type of the zip of sequences with the shortest semantics
+template<typename... Ranges>
+using zip_range_t = ZipRange<
+    ZipIterator<range_iterator_t<Ranges>...>,
+    std::conditional_t<(is_sized_range_v<Ranges> && ...),
+                       ZipIterator<range_iterator_t<Ranges>...>,
+                       ZipSentinel<range_sentinel_t<Ranges>...>>,
+    (is_sized_range_v<Ranges> && ...)>;
+
+//---------------------------------------------------------------------------//
+// Type of the zip of sequences with the longest semantics
+template<typename Fill, typename... Ranges>
+using zip_longest_range_t
+    = ZipRange<ZipLongestIterator<Fill, range_iterator_t<Ranges>...>,
+               ZipLongestIterator<Fill, range_iterator_t<Ranges>...>,
+               (is_sized_range_v<Ranges> && ...)>;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Zip sequences up to the end of the shortest one
+template<typename Range1, typename... Ranges>
+inline detail::zip_range_t<Range1, Ranges...>
+zip(Range1&& range1, Ranges&&... ranges);
+
+// Zip sequences up to the end of the longest one
+template<typename Fill, typename Range1, typename... Ranges>
+inline detail::zip_longest_range_t<Fill, Range1, Ranges...>
+zipLongest(Fill fill, Range1&& range1, Ranges&&... ranges);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct with the beginning and ending iterators and the length
+ *
+ * \param[in] first  The beginning iterator
+ * \param[in] last   The ending iterator
+ * \param[in] size   The number of elements (ignored unless sized)
+ */
+template<typename Iterator, typename Sentinel, bool Sized>
+ZipRange<Iterator, Sentinel, Sized>::ZipRange(Iterator first,
+                                              Sentinel last,
+                                              size_type size)
+    : m_begin(std::move(first)), m_end(std::move(last)), m_size(size)
+{
+    /* * */
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the number of elements in the zip
+ *
+ * Only available when the sizes of all the sequences are known.
+ *
+ * \return The number of elements
+ */
+template<typename Iterator, typename Sentinel, bool Sized>
+auto ZipRange<Iterator, Sentinel, Sized>::size() const -> size_type
+{
+    static_assert(Sized, "the length of the zip is unknown");
+
+    return m_size;
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Zip sequences up to the end of the shortest one
+ *
+ * When all the sequences are sized, the length of the zip is their minimum
+ * size and the ending iterator is computed once, in constant time for random
+ * access sequences.  Otherwise, the zip ends at a sentinel that tests every
+ * sequence for its end.
+ *
+ * \param[in] range1  The first sequence
+ * \param[in] ranges  The remaining sequences
+ *
+ * \return A range over the zipped sequences
+ */
+template<typename Range1, typename... Ranges>
+detail::zip_range_t<Range1, Ranges...> zip(Range1&& range1, Ranges&&... ranges)
+{
+    using std::begin;
+    using std::end;
+    using std::size;
+    using Result_t = detail::zip_range_t<Range1, Ranges...>;
+    using Iterator_t = typename Result_t::iterator;
+    using Sentinel_t = typename Result_t::sentinel;
+
+    Iterator_t first(begin(range1), begin(ranges)...);
+    if constexpr (Result_t::is_sized)
+    {
+        const std::size_t length
+            = std::min({static_cast<std::size_t>(size(range1)),
+                        static_cast<std::size_t>(size(ranges))...});
+        if constexpr (detail::is_random_access_zip_iter_v<Iterator_t>)
+        {
+            const Iterator_t last
+                = first
+                  + static_cast<typename Iterator_t::difference_type>(length);
+            return Result_t(first, last, length);
+        }
+        else
+        {
+            const Iterator_t last(std::next(begin(range1), length),
+                                  std::next(begin(ranges), length)...);
+            return Result_t(first, last, length);
+        }
+    }
+    else
+    {
+        return Result_t(first, Sentinel_t(end(range1), end(ranges)...), 0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Zip sequences up to the end of the longest one
+ *
+ * The elements of the sequences that ended are replaced with \p fill,
+ * converted to their value types.  Every sequence must have the same
+ * iterator and sentinel types.
+ *
+ * \param[in] fill    The value of the sequences that ended
+ * \param[in] range1  The first sequence
+ * \param[in] ranges  The remaining sequences
+ *
+ * \return A range over the zipped sequences
+ */
+template<typename Fill, typename Range1, typename... Ranges>
+detail::zip_longest_range_t<Fill, Range1, Ranges...>
+zipLongest(Fill fill, Range1&& range1, Ranges&&... ranges)
+{
+    static_assert(
+        (std::is_same_v<detail::range_iterator_t<Range1>,
+                        detail::range_sentinel_t<Range1>>
+         && ...
+         && std::is_same_v<detail::range_iterator_t<Ranges>,
+                           detail::range_sentinel_t<Ranges>>));
+
+    using std::begin;
+    using std::end;
+    using std::size;
+    using Result_t = detail::zip_longest_range_t<Fill, Range1, Ranges...>;
+    using Iterator_t = typename Result_t::iterator;
+    using Pack_t = detail::IteratorPack<detail::range_iterator_t<Range1>,
+                                        detail::range_iterator_t<Ranges>...>;
+
+    const Pack_t firsts(std::in_place, begin(range1), begin(ranges)...);
+    const Pack_t lasts(std::in_place, end(range1), end(ranges)...);
+
+    std::size_t length = 0;
+    if constexpr (Result_t::is_sized)
+    {
+        length = std::max({static_cast<std::size_t>(size(range1)),
+                           static_cast<std::size_t>(size(ranges))...});
+    }
+    return Result_t(Iterator_t(firsts, lasts, fill),
+                    Iterator_t(lasts, lasts, fill),
+                    length);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_ZIP_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/Zip.hh
+//---------------------------------------------------------------------------//
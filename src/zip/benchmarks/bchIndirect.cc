@@ -0,0 +1,123 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchIndirect.cc
+ * \brief  Random gather benchmarks for indirect ranges.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Indirect.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+// Data large enough that random gathers miss the caches
+constexpr std::size_t num_data = std::size_t(1) << 24;
+
+// Number of gathered elements
+constexpr std::size_t num_elements = std::size_t(1) << 22;
+
+// Bytes moved per element: index, gathered value, output
+constexpr std::size_t bytes_per_element
+    = sizeof(std::uint32_t) + 2 * sizeof(double);
+
+// Uniformly random indices into the data
+std::vector<std::uint32_t> randomIndices()
+{
+    std::vector<std::uint32_t> indices(num_elements);
+    std::mt19937 engine(17);
+    for (auto& index : indices)
+    {
+        index = static_cast<std::uint32_t>(engine() % num_data);
+    }
+    return indices;
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Hand-written gather: y[i] = 2 x[idx[i]]
+void BM_RawGather(benchmark::State& state)
+{
+    const std::vector<double> x(num_data, 1.0);
+    const std::vector<std::uint32_t> idx = randomIndices();
+    std::vector<double> y(num_elements);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            y[i] = 2.0 * x[idx[i]];
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_RawGather);
+
+//---------------------------------------------------------------------------//
+// Zip of an indirect range and the output
+void BM_IndirectGather(benchmark::State& state)
+{
+    const std::vector<double> x(num_data, 1.0);
+    const std::vector<std::uint32_t> idx = randomIndices();
+    std::vector<double> y(num_elements);
+    for (auto _ : state)
+    {
+        for (auto [xi, yi] : itertools::zip(itertools::indirect(x, idx), y))
+        {
+            yi = 2.0 * xi;
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK(BM_IndirectGather);
+
+//---------------------------------------------------------------------------//
+// Batched, prefetched gather of the same zip; the argument is the batch
+template<itertools::GatherOrder Order>
+void BM_BatchedGather(benchmark::State& state)
+{
+    const std::vector<double> x(num_data, 1.0);
+    const std::vector<std::uint32_t> idx = randomIndices();
+    std::vector<double> y(num_elements);
+    const auto batch = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        itertools::gatherForEach(
+            itertools::zip(itertools::indirect(x, idx), y),
+            [](auto elem) {
+                auto [xi, yi] = elem;
+                yi = 2.0 * xi;
+            },
+            batch,
+            Order);
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, bytes_per_element);
+}
+BENCHMARK_TEMPLATE(BM_BatchedGather, itertools::GatherOrder::original)
+    ->RangeMultiplier(4)
+    ->Range(8, 512);
+BENCHMARK_TEMPLATE(BM_BatchedGather, itertools::GatherOrder::sorted)
+    ->RangeMultiplier(4)
+    ->Range(8, 512);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchIndirect.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,194 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchPrefetch.cc
+ * \brief  Prefetch distance benchmarks for prefetched zips.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Prefetch.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+#include "../Indirect.hh"
+#include "../Transpose.hh"
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+// Large enough to stream from memory rather than from the caches
+constexpr std::size_t num_elements = std::size_t(1) << 24;
+
+// Records spanning a cache line, of which one member is read
+constexpr std::size_t num_records = std::size_t(1) << 20;
+struct Record
+{
+    float value;
+    float padding[15];
+};
+
+// A random permutation of the element indices
+inline std::vector<std::uint32_t> shuffledIndices()
+{
+    std::vector<std::uint32_t> indices(num_elements);
+    std::iota(indices.begin(), indices.end(), 0u);
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(12345));
+    return indices;
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Hand-written loop: y += 2 x
+void BM_RawTriad(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f);
+    std::vector<float> y(num_elements, 0.0f);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            y[i] += 2.0f * x[i];
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, 3 * sizeof(float));
+}
+BENCHMARK(BM_RawTriad);
+
+//---------------------------------------------------------------------------//
+// Zip of streams prefetched Distance elements ahead: y += 2 x
+template<std::ptrdiff_t Distance>
+void BM_PrefetchedTriad(benchmark::State& state)
+{
+    using itertools::PrefetchAccess;
+    using itertools::prefetched;
+
+    std::vector<float> x(num_elements, 1.0f);
+    std::vector<float> y(num_elements, 0.0f);
+    for (auto _ : state)
+    {
+        for (auto [xi, yi] : itertools::zip(
+                 prefetched<Distance>(x),
+                 prefetched<Distance, PrefetchAccess::write>(y)))
+        {
+            yi += 2.0f * xi;
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, 3 * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_PrefetchedTriad, 0);
+BENCHMARK_TEMPLATE(BM_PrefetchedTriad, 16);
+BENCHMARK_TEMPLATE(BM_PrefetchedTriad, 64);
+BENCHMARK_TEMPLATE(BM_PrefetchedTriad, 256);
+BENCHMARK_TEMPLATE(BM_PrefetchedTriad, 1024);
+
+//---------------------------------------------------------------------------//
+// Hand-written gather through shuffled indices: y += x[indices]
+void BM_RawGather(benchmark::State& state)
+{
+    const std::vector<std::uint32_t> indices = shuffledIndices();
+    std::vector<float> x(num_elements, 1.0f);
+    std::vector<float> y(num_elements, 0.0f);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            y[i] += x[indices[i]];
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, 3 * sizeof(float) + sizeof(std::uint32_t));
+}
+BENCHMARK(BM_RawGather);
+
+//---------------------------------------------------------------------------//
+// Indirect stream prefetched Distance elements ahead: y += x[indices]
+template<std::ptrdiff_t Distance>
+void BM_PrefetchedGather(benchmark::State& state)
+{
+    using itertools::prefetched;
+
+    const std::vector<std::uint32_t> indices = shuffledIndices();
+    std::vector<float> x(num_elements, 1.0f);
+    std::vector<float> y(num_elements, 0.0f);
+    for (auto _ : state)
+    {
+        for (auto [xi, yi] : itertools::zip(
+                 prefetched<Distance>(itertools::indirect(x, indices)), y))
+        {
+            yi += xi;
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, 3 * sizeof(float) + sizeof(std::uint32_t));
+}
+BENCHMARK_TEMPLATE(BM_PrefetchedGather, 0);
+BENCHMARK_TEMPLATE(BM_PrefetchedGather, 4);
+BENCHMARK_TEMPLATE(BM_PrefetchedGather, 16);
+BENCHMARK_TEMPLATE(BM_PrefetchedGather, 64);
+
+//---------------------------------------------------------------------------//
+// Hand-written loop over one member of each record
+void BM_RawStrided(benchmark::State& state)
+{
+    std::vector<Record> records(num_records, Record{1.0f, {}});
+    for (auto _ : state)
+    {
+        float total = 0;
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            total += records[i].value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_records, sizeof(Record));
+}
+BENCHMARK(BM_RawStrided);
+
+//---------------------------------------------------------------------------//
+// Column of one member prefetched Distance records ahead
+template<std::ptrdiff_t Distance>
+void BM_PrefetchedStrided(benchmark::State& state)
+{
+    using itertools::prefetched;
+
+    std::vector<Record> records(num_records, Record{1.0f, {}});
+    auto [values] = itertools::aosColumns<&Record::value>(records);
+    for (auto _ : state)
+    {
+        float total = 0;
+        for (float value : prefetched<Distance>(values))
+        {
+            total += value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_records, sizeof(Record));
+}
+BENCHMARK_TEMPLATE(BM_PrefetchedStrided, 0);
+BENCHMARK_TEMPLATE(BM_PrefetchedStrided, 4);
+BENCHMARK_TEMPLATE(BM_PrefetchedStrided, 16);
+BENCHMARK_TEMPLATE(BM_PrefetchedStrided, 64);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchPrefetch.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,157 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchRadixSort.cc
+ * \brief  Benchmarks for radixSort.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../RadixSort.hh"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+using Payload = double;
+
+// A column of random keys and P payload columns
+template<typename Key, std::size_t P>
+class Columns
+{
+  public:
+    explicit Columns(std::size_t size)
+        : m_keys(size)
+    {
+        std::mt19937_64 engine(12345);
+        for (Key& key : m_keys)
+        {
+            if constexpr (std::is_floating_point_v<Key>)
+            {
+                key = std::uniform_real_distribution<Key>(-1, 1)(engine);
+            }
+            else
+            {
+                key = static_cast<Key>(engine());
+            }
+        }
+        for (std::size_t p = 0; p < P; ++p)
+        {
+            m_payloads[p].resize(size);
+            std::iota(m_payloads[p].begin(),
+                      m_payloads[p].end(),
+                      static_cast<Payload>(p));
+        }
+    }
+
+    // Zip the keys and the payloads
+    auto zipped() { return zipped(std::make_index_sequence<P>()); }
+
+  private:
+    template<std::size_t... I>
+    auto zipped(std::index_sequence<I...>)
+    {
+        return itertools::zip(m_keys, m_payloads[I]...);
+    }
+
+    std::vector<Key> m_keys;
+    std::array<std::vector<Payload>, P> m_payloads;
+};
+
+// Compare zipped elements by key
+struct KeyLess
+{
+    template<typename Lhs, typename Rhs>
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Comparison sort of the zipped columns
+template<typename Key, std::size_t P>
+void BM_StdSort(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const Columns<Key, P> input(size);
+    Columns<Key, P> columns = input;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        columns = input;
+        state.ResumeTiming();
+
+        auto z = columns.zipped();
+        std::sort(z.begin(), z.end(), KeyLess());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state,
+        static_cast<std::int64_t>(size),
+        sizeof(Key) + P * sizeof(Payload));
+}
+
+//---------------------------------------------------------------------------//
+// Radix sort of the zipped columns
+template<typename Key, std::size_t P>
+void BM_RadixSort(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const Columns<Key, P> input(size);
+    Columns<Key, P> columns = input;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        columns = input;
+        state.ResumeTiming();
+
+        itertools::radixSort(columns.zipped());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state,
+        static_cast<std::int64_t>(size),
+        sizeof(Key) + P * sizeof(Payload));
+}
+
+//---------------------------------------------------------------------------//
+// REGISTRATION
+//---------------------------------------------------------------------------//
+
+#define ITERTOOLS_RADIX_SORT_BENCHMARKS(KEY, P)                           \
+    BENCHMARK_TEMPLATE(BM_StdSort, KEY, P)                                \
+        ->RangeMultiplier(16)                                             \
+        ->Range(1 << 12, 1 << 20);                                        \
+    BENCHMARK_TEMPLATE(BM_RadixSort, KEY, P)                              \
+        ->RangeMultiplier(16)                                             \
+        ->Range(1 << 12, 1 << 20)
+
+ITERTOOLS_RADIX_SORT_BENCHMARKS(std::uint32_t, 0);
+ITERTOOLS_RADIX_SORT_BENCHMARKS(std::uint32_t, 1);
+ITERTOOLS_RADIX_SORT_BENCHMARKS(std::uint32_t, 3);
+ITERTOOLS_RADIX_SORT_BENCHMARKS(std::int64_t, 1);
+ITERTOOLS_RADIX_SORT_BENCHMARKS(float, 1);
+ITERTOOLS_RADIX_SORT_BENCHMARKS(double, 1);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchRadixSort.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,156 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchStreaming.cc
+ * \brief  Store bandwidth benchmarks for streamed zips.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Streaming.hh"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+// Large enough that each stream (256 MiB) exceeds the last-level cache
+constexpr std::size_t num_elements = std::size_t(1) << 26;
+
+// Output streams of the benchmarks
+template<std::size_t N>
+using Outputs_t = std::array<std::vector<float>, N>;
+
+//---------------------------------------------------------------------------//
+// Write y_k = (k + 1) x into every output stream of a zip over (x, y...)
+template<typename ZipRange, std::size_t... I>
+void scale(ZipRange&& zipped, std::index_sequence<I...>)
+{
+    for (auto z : zipped)
+    {
+        ((std::get<I + 1>(z) = static_cast<float>(I + 1) * std::get<0>(z)),
+         ...);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Zip x with the outputs using ordinary stores
+template<std::size_t... I>
+void regularStores(const std::vector<float>& x,
+                   Outputs_t<sizeof...(I)>& y,
+                   std::index_sequence<I...> indices)
+{
+    scale(itertools::zip(x, y[I]...), indices);
+}
+
+//---------------------------------------------------------------------------//
+// Zip x with the outputs using non-temporal stores
+template<std::size_t... I>
+void streamingStores(const std::vector<float>& x,
+                     Outputs_t<sizeof...(I)>& y,
+                     std::index_sequence<I...> indices)
+{
+    std::array<itertools::StreamingRange<float>, sizeof...(I)> outputs{
+        {itertools::streamed(y[I])...}};
+    scale(itertools::zip(x, outputs[I]...), indices);
+}
+
+//---------------------------------------------------------------------------//
+// Compute blocks of each output and store them with non-temporal stores
+template<std::size_t... I>
+void streamingBlocks(const std::vector<float>& x,
+                     Outputs_t<sizeof...(I)>& y,
+                     std::index_sequence<I...>)
+{
+    constexpr std::size_t block_size = 256;
+    std::array<itertools::StreamingRange<float>, sizeof...(I)> outputs{
+        {itertools::streamed(y[I])...}};
+    alignas(64) float block[block_size];
+    for (std::size_t i = 0; i < x.size(); i += block_size)
+    {
+        const std::size_t count = std::min(block_size, x.size() - i);
+        ((std::transform(x.data() + i,
+                         x.data() + i + count,
+                         block,
+                         [](float xi) { return static_cast<float>(I + 1) * xi; }),
+          outputs[I].store(i, block, count)),
+         ...);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Zip writing N streams with ordinary stores
+template<std::size_t N>
+void BM_RegularStores(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f);
+    Outputs_t<N> y;
+    y.fill(std::vector<float>(num_elements, 0.0f));
+    for (auto _ : state)
+    {
+        regularStores(x, y, std::make_index_sequence<N>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, (N + 1) * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_RegularStores, 1);
+BENCHMARK_TEMPLATE(BM_RegularStores, 2);
+BENCHMARK_TEMPLATE(BM_RegularStores, 4);
+
+//---------------------------------------------------------------------------//
+// Zip writing N streams with non-temporal stores
+template<std::size_t N>
+void BM_StreamingStores(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f);
+    Outputs_t<N> y;
+    y.fill(std::vector<float>(num_elements, 0.0f));
+    for (auto _ : state)
+    {
+        streamingStores(x, y, std::make_index_sequence<N>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, (N + 1) * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_StreamingStores, 1);
+BENCHMARK_TEMPLATE(BM_StreamingStores, 2);
+BENCHMARK_TEMPLATE(BM_StreamingStores, 4);
+
+//---------------------------------------------------------------------------//
+// Blocks of N streams stored with non-temporal stores
+template<std::size_t N>
+void BM_StreamingBlocks(benchmark::State& state)
+{
+    std::vector<float> x(num_elements, 1.0f);
+    Outputs_t<N> y;
+    y.fill(std::vector<float>(num_elements, 0.0f));
+    for (auto _ : state)
+    {
+        streamingBlocks(x, y, std::make_index_sequence<N>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, (N + 1) * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_StreamingBlocks, 1);
+BENCHMARK_TEMPLATE(BM_StreamingBlocks, 2);
+BENCHMARK_TEMPLATE(BM_StreamingBlocks, 4);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchStreaming.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,143 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchTranspose.cc
+ * \brief  Benchmarks of AoS/SoA transposition.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Transpose.hh"
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+// Small enough that the records and the columns stay in the last-level cache
+constexpr std::size_t num_records = std::size_t(1) << 16;
+
+struct Vec3
+{
+    double x;
+    double y;
+    double z;
+};
+
+struct Particle
+{
+    float x;
+    float y;
+    float z;
+    float w;
+};
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Copy points into columns with one loop per member
+void BM_Vec3PerMember(benchmark::State& state)
+{
+    const std::vector<Vec3> points(num_records, Vec3{1.0, 2.0, 3.0});
+    std::vector<double> x(num_records), y(num_records), z(num_records);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            x[i] = points[i].x;
+        }
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            y[i] = points[i].y;
+        }
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            z[i] = points[i].z;
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_records, 2 * sizeof(Vec3));
+}
+BENCHMARK(BM_Vec3PerMember);
+
+//---------------------------------------------------------------------------//
+// Copy points into columns with transposeInto
+void BM_Vec3TransposeInto(benchmark::State& state)
+{
+    const std::vector<Vec3> points(num_records, Vec3{1.0, 2.0, 3.0});
+    std::vector<double> x(num_records), y(num_records), z(num_records);
+    for (auto _ : state)
+    {
+        itertools::transposeInto<&Vec3::x, &Vec3::y, &Vec3::z>(
+            points, std::tie(x, y, z));
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_records, 2 * sizeof(Vec3));
+}
+BENCHMARK(BM_Vec3TransposeInto);
+
+//---------------------------------------------------------------------------//
+// Copy columns into particles with one loop per member
+void BM_ParticlePerMember(benchmark::State& state)
+{
+    std::vector<Particle> particles(num_records);
+    const std::vector<float> x(num_records, 1.0f), y(num_records, 2.0f),
+        z(num_records, 3.0f), w(num_records, 4.0f);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            particles[i].x = x[i];
+        }
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            particles[i].y = y[i];
+        }
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            particles[i].z = z[i];
+        }
+        for (std::size_t i = 0; i < num_records; ++i)
+        {
+            particles[i].w = w[i];
+        }
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_records, 2 * sizeof(Particle));
+}
+BENCHMARK(BM_ParticlePerMember);
+
+//---------------------------------------------------------------------------//
+// Copy columns into particles with transposeInto
+void BM_ParticleTransposeInto(benchmark::State& state)
+{
+    std::vector<Particle> particles(num_records);
+    const std::vector<float> x(num_records, 1.0f), y(num_records, 2.0f),
+        z(num_records, 3.0f), w(num_records, 4.0f);
+    for (auto _ : state)
+    {
+        itertools::transposeInto<&Particle::x,
+                                 &Particle::y,
+                                 &Particle::z,
+                                 &Particle::w>(std::tie(x, y, z, w),
+                                               particles);
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_records, 2 * sizeof(Particle));
+}
+BENCHMARK(BM_ParticleTransposeInto);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchTranspose.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,111 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchUnzip.cc
+ * \brief  Benchmarks of unzipping a range of tuples.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Unzip.hh"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+// Large enough that the tuples exceed the last-level cache
+constexpr std::size_t num_tuples = std::size_t(1) << 24;
+
+// Tuple of N floats
+template<std::size_t N, typename = std::make_index_sequence<N>>
+struct Tuple;
+template<std::size_t N, std::size_t... I>
+struct Tuple<N, std::index_sequence<I...>>
+{
+    using type = std::tuple<decltype(static_cast<float>(I))...>;
+};
+template<std::size_t N>
+using Tuple_t = typename Tuple<N>::type;
+
+// Output columns of the benchmarks
+template<std::size_t N>
+using Outputs_t = std::array<std::vector<float>, N>;
+
+//---------------------------------------------------------------------------//
+// Write each element with its own pass over the tuples
+template<std::size_t... I>
+void transformPasses(const std::vector<Tuple_t<sizeof...(I)>>& tuples,
+                     Outputs_t<sizeof...(I)>& outputs,
+                     std::index_sequence<I...>)
+{
+    (std::transform(tuples.begin(),
+                    tuples.end(),
+                    outputs[I].begin(),
+                    [](const auto& t) { return std::get<I>(t); }),
+     ...);
+}
+
+//---------------------------------------------------------------------------//
+// Write the elements in one pass
+template<std::size_t... I>
+void unzipPass(const std::vector<Tuple_t<sizeof...(I)>>& tuples,
+               Outputs_t<sizeof...(I)>& outputs,
+               std::index_sequence<I...>)
+{
+    itertools::unzip(tuples, outputs[I].begin()...);
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Unzip N elements with N transform passes
+template<std::size_t N>
+void BM_TransformPasses(benchmark::State& state)
+{
+    const std::vector<Tuple_t<N>> tuples(num_tuples);
+    Outputs_t<N> outputs;
+    outputs.fill(std::vector<float>(num_tuples));
+    for (auto _ : state)
+    {
+        transformPasses(tuples, outputs, std::make_index_sequence<N>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_tuples, 2 * N * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_TransformPasses, 2);
+BENCHMARK_TEMPLATE(BM_TransformPasses, 4);
+
+//---------------------------------------------------------------------------//
+// Unzip N elements with a single unzip pass
+template<std::size_t N>
+void BM_Unzip(benchmark::State& state)
+{
+    const std::vector<Tuple_t<N>> tuples(num_tuples);
+    Outputs_t<N> outputs;
+    outputs.fill(std::vector<float>(num_tuples));
+    for (auto _ : state)
+    {
+        unzipPass(tuples, outputs, std::make_index_sequence<N>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_tuples, 2 * N * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_Unzip, 2);
+BENCHMARK_TEMPLATE(BM_Unzip, 4);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchUnzip.cc
+//---------------------------------------------------------------------------//
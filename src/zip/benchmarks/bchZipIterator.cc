@@ -0,0 +1,132 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchZipIterator.cc
+ * \brief  Benchmarks for class ZipIterator.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../detail/ZipIterator.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+constexpr std::ptrdiff_t num_elements = 4096;
+
+// Update the first stream from the others: out = 2 out + in...
+template<typename... Inputs>
+inline void update(float& out, const Inputs&... in)
+{
+    out = 2.0f * out + (0.0f + ... + in);
+}
+
+// N streams of floats
+template<std::size_t N>
+class Streams
+{
+  public:
+    Streams()
+    {
+        for (std::size_t s = 0; s < N; ++s)
+        {
+            m_data[s].assign(num_elements, static_cast<float>(s));
+            m_pointers[s] = m_data[s].data();
+        }
+    }
+
+    const std::array<float*, N>& pointers() const { return m_pointers; }
+
+  private:
+    std::array<std::vector<float>, N> m_data;
+    std::array<float*, N> m_pointers;
+};
+
+// Hand-written loop indexing every stream
+template<std::size_t... I>
+void rawLoop(const std::array<float*, sizeof...(I)>& p,
+             std::index_sequence<I...>)
+{
+    for (std::ptrdiff_t i = 0; i < num_elements; ++i)
+    {
+        update(p[I][i]...);
+    }
+}
+
+// Loop over zipped stream iterators
+template<std::size_t... I>
+void zipLoop(const std::array<float*, sizeof...(I)>& p,
+             std::index_sequence<I...>)
+{
+    auto first = itertools::makeZipIter(p[I]...);
+    const auto last = itertools::makeZipIter((p[I] + num_elements)...);
+    for (; first != last; ++first)
+    {
+        std::apply([](auto&... values) { update(values...); }, *first);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Hand-written loop over N streams
+template<std::size_t N>
+void BM_RawLoop(benchmark::State& state)
+{
+    Streams<N> streams;
+    for (auto _ : state)
+    {
+        rawLoop(streams.pointers(), std::make_index_sequence<N>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, (N + 1) * sizeof(float));
+}
+
+//---------------------------------------------------------------------------//
+// ZipIterator loop over N streams
+template<std::size_t N>
+void BM_ZipLoop(benchmark::State& state)
+{
+    Streams<N> streams;
+    for (auto _ : state)
+    {
+        zipLoop(streams.pointers(), std::make_index_sequence<N>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state, num_elements, (N + 1) * sizeof(float));
+}
+
+//---------------------------------------------------------------------------//
+// REGISTRATION
+//---------------------------------------------------------------------------//
+
+#define ITERTOOLS_ZIP_BENCHMARKS(N)   \
+    BENCHMARK_TEMPLATE(BM_RawLoop, N); \
+    BENCHMARK_TEMPLATE(BM_ZipLoop, N)
+
+ITERTOOLS_ZIP_BENCHMARKS(1);
+ITERTOOLS_ZIP_BENCHMARKS(2);
+ITERTOOLS_ZIP_BENCHMARKS(3);
+ITERTOOLS_ZIP_BENCHMARKS(4);
+ITERTOOLS_ZIP_BENCHMARKS(5);
+ITERTOOLS_ZIP_BENCHMARKS(6);
+ITERTOOLS_ZIP_BENCHMARKS(7);
+ITERTOOLS_ZIP_BENCHMARKS(8);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchZipIterator.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,202 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/benchmarks/bchZipSort.cc
+ * \brief  Benchmarks for sorting zipped arrays in place.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Zip.hh"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/benchmarks/Counters.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+using Key = std::uint32_t;
+using Payload = double;
+
+// A column of random keys and P payload columns
+template<std::size_t P>
+class Columns
+{
+  public:
+    explicit Columns(std::size_t size)
+        : m_keys(size)
+    {
+        std::mt19937 engine(12345);
+        std::generate(m_keys.begin(), m_keys.end(), engine);
+        for (std::size_t p = 0; p < P; ++p)
+        {
+            m_payloads[p].resize(size);
+            std::iota(m_payloads[p].begin(),
+                      m_payloads[p].end(),
+                      static_cast<Payload>(p));
+        }
+    }
+
+    std::vector<Key>& keys() { return m_keys; }
+    std::array<std::vector<Payload>, P>& payloads() { return m_payloads; }
+
+  private:
+    std::vector<Key> m_keys;
+    std::array<std::vector<Payload>, P> m_payloads;
+};
+
+// Compare zipped elements by key
+struct KeyLess
+{
+    template<typename Lhs, typename Rhs>
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    }
+};
+
+// Sort the zipped columns in place
+template<bool Stable, std::size_t... I>
+void zipSort(std::vector<Key>& keys,
+             std::array<std::vector<Payload>, sizeof...(I)>& payloads,
+             std::index_sequence<I...>)
+{
+    auto z = itertools::zip(keys, payloads[I]...);
+    if constexpr (Stable)
+    {
+        std::stable_sort(z.begin(), z.end(), KeyLess());
+    }
+    else
+    {
+        std::sort(z.begin(), z.end(), KeyLess());
+    }
+}
+
+// Sort a permutation by key, then gather every column through it
+template<bool Stable, std::size_t P>
+void permutationSort(std::vector<Key>& keys,
+                     std::array<std::vector<Payload>, P>& payloads,
+                     std::vector<std::size_t>& perm,
+                     std::vector<Key>& key_buffer,
+                     std::vector<Payload>& payload_buffer)
+{
+    std::iota(perm.begin(), perm.end(), std::size_t(0));
+    auto less = [&keys](std::size_t i, std::size_t j) {
+        return keys[i] < keys[j];
+    };
+    if constexpr (Stable)
+    {
+        std::stable_sort(perm.begin(), perm.end(), less);
+    }
+    else
+    {
+        std::sort(perm.begin(), perm.end(), less);
+    }
+
+    for (std::size_t i = 0; i < perm.size(); ++i)
+    {
+        key_buffer[i] = keys[perm[i]];
+    }
+    keys.swap(key_buffer);
+    for (auto& payload : payloads)
+    {
+        for (std::size_t i = 0; i < perm.size(); ++i)
+        {
+            payload_buffer[i] = payload[perm[i]];
+        }
+        payload.swap(payload_buffer);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BENCHMARKS
+//---------------------------------------------------------------------------//
+// Sort of the zipped key and P payload columns
+template<bool Stable, std::size_t P>
+void BM_ZipSort(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const Columns<P> input(size);
+    Columns<P> columns = input;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        columns = input;
+        state.ResumeTiming();
+
+        zipSort<Stable>(
+            columns.keys(), columns.payloads(), std::make_index_sequence<P>());
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state,
+        static_cast<std::int64_t>(size),
+        sizeof(Key) + P * sizeof(Payload));
+}
+
+//---------------------------------------------------------------------------//
+// Sort of a permutation followed by a gather of every column
+template<bool Stable, std::size_t P>
+void BM_PermutationSort(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const Columns<P> input(size);
+    Columns<P> columns = input;
+    std::vector<std::size_t> perm(size);
+    std::vector<Key> key_buffer(size);
+    std::vector<Payload> payload_buffer(size);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        columns = input;
+        state.ResumeTiming();
+
+        permutationSort<Stable>(columns.keys(),
+                                columns.payloads(),
+                                perm,
+                                key_buffer,
+                                payload_buffer);
+        benchmark::ClobberMemory();
+    }
+    itertools::bench::setThroughputCounters(
+        state,
+        static_cast<std::int64_t>(size),
+        sizeof(Key) + P * sizeof(Payload));
+}
+
+//---------------------------------------------------------------------------//
+// REGISTRATION
+//---------------------------------------------------------------------------//
+
+#define ITERTOOLS_ZIP_SORT_BENCHMARKS(STABLE, P)                          \
+    BENCHMARK_TEMPLATE(BM_PermutationSort, STABLE, P)                     \
+        ->RangeMultiplier(16)                                             \
+        ->Range(1 << 12, 1 << 20);                                        \
+    BENCHMARK_TEMPLATE(BM_ZipSort, STABLE, P)                             \
+        ->RangeMultiplier(16)                                             \
+        ->Range(1 << 12, 1 << 20)
+
+ITERTOOLS_ZIP_SORT_BENCHMARKS(false, 1);
+ITERTOOLS_ZIP_SORT_BENCHMARKS(false, 2);
+ITERTOOLS_ZIP_SORT_BENCHMARKS(false, 3);
+ITERTOOLS_ZIP_SORT_BENCHMARKS(false, 4);
+ITERTOOLS_ZIP_SORT_BENCHMARKS(false, 5);
+ITERTOOLS_ZIP_SORT_BENCHMARKS(true, 1);
+ITERTOOLS_ZIP_SORT_BENCHMARKS(true, 3);
+ITERTOOLS_ZIP_SORT_BENCHMARKS(true, 5);
+
+//---------------------------------------------------------------------------//
+// end of src/zip/benchmarks/bchZipSort.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,318 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/IndirectIterator.hh
+ * \brief  IndirectIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_INDIRECTITERATOR_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_INDIRECTITERATOR_HH
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class IndirectIterator
+ * \brief Iterates over the elements of a sequence selected by indices
+ *
+ * The iterator stores the beginning of the data and the current position in
+ * the indices; dereferencing yields <tt>data[*index]</tt>, a reference into
+ * the data, so the elements can be gathered from or scattered to.  It moves,
+ * compares and computes distances through the index iterator alone, and has
+ * the category of the index iterator.
+ *
+ * \example zip/tests/tstIndirect.cc
+ */
+//===========================================================================//
+
+template<typename DataIterator, typename IndexIterator>
+class IndirectIterator
+{
+    static_assert(std::is_base_of_v<
+                      std::random_access_iterator_tag,
+                      typename std::iterator_traits<
+                          DataIterator>::iterator_category>,
+                  "the data must be random-access");
+
+  public:
+    //! Public type aliases
+    using This = IndirectIterator<DataIterator, IndexIterator>;
+    using difference_type =
+        typename std::iterator_traits<IndexIterator>::difference_type;
+    using value_type =
+        typename std::iterator_traits<DataIterator>::value_type;
+    using reference = typename std::iterator_traits<DataIterator>::reference;
+    using pointer = typename std::iterator_traits<DataIterator>::pointer;
+    using iterator_category =
+        typename std::iterator_traits<IndexIterator>::iterator_category;
+
+  public:
+    // Default constructor
+    IndirectIterator() = default;
+
+    //! Construct with the beginning of the data and the index position
+    IndirectIterator(DataIterator data, IndexIterator index)
+        : m_data(data), m_index(index)
+    {
+    }
+
+    // >>> INCREMENT, DECREMENT
+    //! Pre-increment
+    This& operator++()
+    {
+        ++m_index;
+        return *this;
+    }
+
+    //! Post-increment
+    This operator++(int) { return This(m_data, m_index++); }
+
+    //! Pre-decrement
+    This& operator--()
+    {
+        --m_index;
+        return *this;
+    }
+
+    //! Post-decrement
+    This operator--(int) { return This(m_data, m_index--); }
+
+    // >>> DEREFERENCE, INDEXING
+    //! Dereference the data at the current index
+    reference operator*() const { return m_data[*m_index]; }
+
+    //! Pointer to the data at the current index
+    pointer operator->() const { return std::addressof(**this); }
+
+    //! Dereference the data at the index n positions away
+    reference operator[](difference_type n) const
+    {
+        return m_data[m_index[n]];
+    }
+
+    // >>> COMPOUND ARITHMETIC
+    //! Advance by n indices
+    This& operator+=(difference_type n)
+    {
+        m_index += n;
+        return *this;
+    }
+
+    //! Move back by n indices
+    This& operator-=(difference_type n)
+    {
+        m_index -= n;
+        return *this;
+    }
+
+    // >>> ACCESSORS
+    //! Return the beginning of the data
+    const DataIterator& data() const { return m_data; }
+
+    //! Return the iterator over the indices
+    const IndexIterator& indexIter() const { return m_index; }
+
+    //! Return the current index
+    decltype(auto) index() const { return *m_index; }
+
+  private:
+    // >>> DATA
+    //! Stores the beginning of the data
+    DataIterator m_data{};
+
+    //! Stores the current position in the indices
+    IndexIterator m_index{};
+};
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between an indirect iterator and a distance
+ *
+ * \param[in] iter  The indirect iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n indices after \p iter
+ */
+template<typename DataIterator, typename IndexIterator>
+inline IndirectIterator<DataIterator, IndexIterator>
+operator+(IndirectIterator<DataIterator, IndexIterator> iter,
+          typename IndirectIterator<DataIterator,
+                                    IndexIterator>::difference_type n)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a distance and an indirect iterator
+ *
+ * \param[in] n     The distance
+ * \param[in] iter  The indirect iterator
+ *
+ * \return The iterator \p n indices after \p iter
+ */
+template<typename DataIterator, typename IndexIterator>
+inline IndirectIterator<DataIterator, IndexIterator>
+operator+(typename IndirectIterator<DataIterator,
+                                    IndexIterator>::difference_type n,
+          IndirectIterator<DataIterator, IndexIterator> iter)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between an indirect iterator and a distance
+ *
+ * \param[in] iter  The indirect iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n indices before \p iter
+ */
+template<typename DataIterator, typename IndexIterator>
+inline IndirectIterator<DataIterator, IndexIterator>
+operator-(IndirectIterator<DataIterator, IndexIterator> iter,
+          typename IndirectIterator<DataIterator,
+                                    IndexIterator>::difference_type n)
+{
+    return iter -= n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between two indirect iterators
+ *
+ * \param[in] iter1  The first indirect iterator
+ * \param[in] iter2  The second indirect iterator
+ *
+ * \return The number of indices from \p iter2 to \p iter1
+ */
+template<typename DataIterator, typename IndexIterator>
+inline typename IndirectIterator<DataIterator, IndexIterator>::difference_type
+operator-(const IndirectIterator<DataIterator, IndexIterator>& iter1,
+          const IndirectIterator<DataIterator, IndexIterator>& iter2)
+{
+    return iter1.indexIter() - iter2.indexIter();
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Equality operator
+ *
+ * \param[in] iter1  The first indirect iterator
+ * \param[in] iter2  The second indirect iterator
+ *
+ * \return True if the iterators are at the same index position
+ */
+template<typename DataIterator, typename IndexIterator>
+inline bool
+operator==(const IndirectIterator<DataIterator, IndexIterator>& iter1,
+           const IndirectIterator<DataIterator, IndexIterator>& iter2)
+{
+    return iter1.indexIter() == iter2.indexIter();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inequality operator
+ *
+ * \param[in] iter1  The first indirect iterator
+ * \param[in] iter2  The second indirect iterator
+ *
+ * \return True if the iterators are at different index positions
+ */
+template<typename DataIterator, typename IndexIterator>
+inline bool
+operator!=(const IndirectIterator<DataIterator, IndexIterator>& iter1,
+           const IndirectIterator<DataIterator, IndexIterator>& iter2)
+{
+    return !(iter1 == iter2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than operator
+ *
+ * \param[in] iter1  The first indirect iterator
+ * \param[in] iter2  The second indirect iterator
+ *
+ * \return True if \p iter1 precedes \p iter2
+ */
+template<typename DataIterator, typename IndexIterator>
+inline bool
+operator<(const IndirectIterator<DataIterator, IndexIterator>& iter1,
+          const IndirectIterator<DataIterator, IndexIterator>& iter2)
+{
+    return iter1.indexIter() < iter2.indexIter();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than or equal operator
+ *
+ * \param[in] iter1  The first indirect iterator
+ * \param[in] iter2  The second indirect iterator
+ *
+ * \return True if \p iter1 does not follow \p iter2
+ */
+template<typename DataIterator, typename IndexIterator>
+inline bool
+operator<=(const IndirectIterator<DataIterator, IndexIterator>& iter1,
+           const IndirectIterator<DataIterator, IndexIterator>& iter2)
+{
+    return !(iter2 < iter1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than operator
+ *
+ * \param[in] iter1  The first indirect iterator
+ * \param[in] iter2  The second indirect iterator
+ *
+ * \return True if \p iter1 follows \p iter2
+ */
+template<typename DataIterator, typename IndexIterator>
+inline bool
+operator>(const IndirectIterator<DataIterator, IndexIterator>& iter1,
+          const IndirectIterator<DataIterator, IndexIterator>& iter2)
+{
+    return iter2 < iter1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than or equal operator
+ *
+ * \param[in] iter1  The first indirect iterator
+ * \param[in] iter2  The second indirect iterator
+ *
+ * \return True if \p iter1 does not precede \p iter2
+ */
+template<typename DataIterator, typename IndexIterator>
+inline bool
+operator>=(const IndirectIterator<DataIterator, IndexIterator>& iter1,
+           const IndirectIterator<DataIterator, IndexIterator>& iter2)
+{
+    return !(iter1 < iter2);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_INDIRECTITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/IndirectIterator.hh
+//---------------------------------------------------------------------------//
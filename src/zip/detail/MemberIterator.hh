@@ -0,0 +1,295 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/MemberIterator.hh
+ * \brief  MemberIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_MEMBERITERATOR_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_MEMBERITERATOR_HH
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class MemberIterator
+ * \brief Iterates over one data member of a sequence of records
+ *
+ * Dereferencing yields <tt>(*iter).*Member</tt>, a reference to the member
+ * of the current record, so the member is read and written as if it were
+ * stored in its own array with a stride of one record.  The member pointer
+ * is a template parameter, so the iterator is a single record iterator and
+ * the member offset is a constant of the generated code.  It moves, compares
+ * and computes distances through the record iterator, and has its category.
+ *
+ * \example zip/tests/tstTranspose.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, auto Member>
+class MemberIterator
+{
+    static_assert(std::is_member_object_pointer_v<decltype(Member)>,
+                  "the member must be a pointer to a data member");
+
+  public:
+    //! Public type aliases
+    using This = MemberIterator<Iterator, Member>;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+    using reference
+        = decltype((*std::declval<const Iterator&>()).*Member);
+    using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+    using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
+    using iterator_category =
+        typename std::iterator_traits<Iterator>::iterator_category;
+
+  public:
+    // Default constructor
+    MemberIterator() = default;
+
+    //! Construct with the record iterator
+    explicit MemberIterator(Iterator iter) : m_iter(iter) {}
+
+    // >>> INCREMENT, DECREMENT
+    //! Pre-increment
+    This& operator++()
+    {
+        ++m_iter;
+        return *this;
+    }
+
+    //! Post-increment
+    This operator++(int) { return This(m_iter++); }
+
+    //! Pre-decrement
+    This& operator--()
+    {
+        --m_iter;
+        return *this;
+    }
+
+    //! Post-decrement
+    This operator--(int) { return This(m_iter--); }
+
+    // >>> DEREFERENCE, INDEXING
+    //! Dereference the member of the current record
+    reference operator*() const { return (*m_iter).*Member; }
+
+    //! Pointer to the member of the current record
+    pointer operator->() const { return std::addressof(**this); }
+
+    //! Dereference the member of the record n positions away
+    reference operator[](difference_type n) const
+    {
+        return m_iter[n].*Member;
+    }
+
+    // >>> COMPOUND ARITHMETIC
+    //! Advance by n records
+    This& operator+=(difference_type n)
+    {
+        m_iter += n;
+        return *this;
+    }
+
+    //! Move back by n records
+    This& operator-=(difference_type n)
+    {
+        m_iter -= n;
+        return *this;
+    }
+
+    // >>> ACCESSORS
+    //! Return the record iterator
+    const Iterator& base() const { return m_iter; }
+
+  private:
+    // >>> DATA
+    //! Stores the record iterator
+    Iterator m_iter{};
+};
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a member iterator and a distance
+ *
+ * \param[in] iter  The member iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n records after \p iter
+ */
+template<typename Iterator, auto Member>
+inline MemberIterator<Iterator, Member>
+operator+(MemberIterator<Iterator, Member> iter,
+          typename MemberIterator<Iterator, Member>::difference_type n)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a distance and a member iterator
+ *
+ * \param[in] n     The distance
+ * \param[in] iter  The member iterator
+ *
+ * \return The iterator \p n records after \p iter
+ */
+template<typename Iterator, auto Member>
+inline MemberIterator<Iterator, Member>
+operator+(typename MemberIterator<Iterator, Member>::difference_type n,
+          MemberIterator<Iterator, Member> iter)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between a member iterator and a distance
+ *
+ * \param[in] iter  The member iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n records before \p iter
+ */
+template<typename Iterator, auto Member>
+inline MemberIterator<Iterator, Member>
+operator-(MemberIterator<Iterator, Member> iter,
+          typename MemberIterator<Iterator, Member>::difference_type n)
+{
+    return iter -= n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between two member iterators
+ *
+ * \param[in] iter1  The first member iterator
+ * \param[in] iter2  The second member iterator
+ *
+ * \return The number of records from \p iter2 to \p iter1
+ */
+template<typename Iterator, auto Member>
+inline typename MemberIterator<Iterator, Member>::difference_type
+operator-(const MemberIterator<Iterator, Member>& iter1,
+          const MemberIterator<Iterator, Member>& iter2)
+{
+    return iter1.base() - iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Equality operator
+ *
+ * \param[in] iter1  The first member iterator
+ * \param[in] iter2  The second member iterator
+ *
+ * \return True if the iterators are at the same record
+ */
+template<typename Iterator, auto Member>
+inline bool operator==(const MemberIterator<Iterator, Member>& iter1,
+                       const MemberIterator<Iterator, Member>& iter2)
+{
+    return iter1.base() == iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inequality operator
+ *
+ * \param[in] iter1  The first member iterator
+ * \param[in] iter2  The second member iterator
+ *
+ * \return True if the iterators are at different records
+ */
+template<typename Iterator, auto Member>
+inline bool operator!=(const MemberIterator<Iterator, Member>& iter1,
+                       const MemberIterator<Iterator, Member>& iter2)
+{
+    return iter1.base() != iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than operator
+ *
+ * \param[in] iter1  The first member iterator
+ * \param[in] iter2  The second member iterator
+ *
+ * \return True if \p iter1 precedes \p iter2
+ */
+template<typename Iterator, auto Member>
+inline bool operator<(const MemberIterator<Iterator, Member>& iter1,
+                      const MemberIterator<Iterator, Member>& iter2)
+{
+    return iter1.base() < iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than or equal operator
+ *
+ * \param[in] iter1  The first member iterator
+ * \param[in] iter2  The second member iterator
+ *
+ * \return True if \p iter1 does not follow \p iter2
+ */
+template<typename Iterator, auto Member>
+inline bool operator<=(const MemberIterator<Iterator, Member>& iter1,
+                       const MemberIterator<Iterator, Member>& iter2)
+{
+    return iter1.base() <= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than operator
+ *
+ * \param[in] iter1  The first member iterator
+ * \param[in] iter2  The second member iterator
+ *
+ * \return True if \p iter1 follows \p iter2
+ */
+template<typename Iterator, auto Member>
+inline bool operator>(const MemberIterator<Iterator, Member>& iter1,
+                      const MemberIterator<Iterator, Member>& iter2)
+{
+    return iter1.base() > iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than or equal operator
+ *
+ * \param[in] iter1  The first member iterator
+ * \param[in] iter2  The second member iterator
+ *
+ * \return True if \p iter1 does not precede \p iter2
+ */
+template<typename Iterator, auto Member>
+inline bool operator>=(const MemberIterator<Iterator, Member>& iter1,
+                       const MemberIterator<Iterator, Member>& iter2)
+{
+    return iter1.base() >= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_MEMBERITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/MemberIterator.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,119 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/NonTemporal.hh
+ * \brief  Non-temporal cache line stores and store fence.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_NONTEMPORAL_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_NONTEMPORAL_HH
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define ITERTOOLS_NONTEMPORAL_X86 1
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_nontemporal_store)
+#define ITERTOOLS_NONTEMPORAL_BUILTIN 1
+#endif
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * \def ITERTOOLS_HAVE_NONTEMPORAL_STORES
+ * \brief Whether streamLine() bypasses the caches on the target.
+ *
+ * Non-temporal stores are issued with the SSE2/AVX/AVX-512 streaming
+ * intrinsics on x86, and with \c __builtin_nontemporal_store on other targets
+ * when the compiler provides it (Clang).  Elsewhere, streamLine() falls back
+ * to an ordinary copy and streamFence() does nothing.
+ */
+#if defined(ITERTOOLS_NONTEMPORAL_X86) \
+    || defined(ITERTOOLS_NONTEMPORAL_BUILTIN)
+#define ITERTOOLS_HAVE_NONTEMPORAL_STORES 1
+#else
+#define ITERTOOLS_HAVE_NONTEMPORAL_STORES 0
+#endif
+
+namespace itertools
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Size in bytes of the cache lines written by streamLine()
+constexpr std::size_t nontemporal_line_size = 64;
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Store a cache line to memory without bringing it into the caches
+ *
+ * The line is written whole, so the processor does not read it from memory
+ * first.  The destination must be aligned to \c nontemporal_line_size; the
+ * source may be unaligned.  The stores are weakly ordered: call streamFence()
+ * before other threads read the line.
+ *
+ * \param[out] dst  The destination line
+ * \param[in]  src  The source elements
+ */
+inline void streamLine(void* dst, const void* src)
+{
+#if defined(ITERTOOLS_NONTEMPORAL_X86) && defined(__AVX512F__)
+    _mm512_stream_si512(static_cast<__m512i*>(dst),
+                        _mm512_loadu_si512(src));
+#elif defined(ITERTOOLS_NONTEMPORAL_X86) && defined(__AVX__)
+    auto* out = static_cast<__m256i*>(dst);
+    const auto* in = static_cast<const __m256i*>(src);
+    _mm256_stream_si256(out, _mm256_loadu_si256(in));
+    _mm256_stream_si256(out + 1, _mm256_loadu_si256(in + 1));
+#elif defined(ITERTOOLS_NONTEMPORAL_X86)
+    auto* out = static_cast<__m128i*>(dst);
+    const auto* in = static_cast<const __m128i*>(src);
+    for (int i = 0; i < 4; ++i)
+    {
+        _mm_stream_si128(out + i, _mm_loadu_si128(in + i));
+    }
+#elif defined(ITERTOOLS_NONTEMPORAL_BUILTIN)
+    auto* out = static_cast<std::uint64_t*>(dst);
+    for (std::size_t i = 0; i < nontemporal_line_size / 8; ++i)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, static_cast<const char*>(src) + 8 * i, 8);
+        __builtin_nontemporal_store(word, out + i);
+    }
+#else
+    std::memcpy(dst, src, nontemporal_line_size);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Order the preceding non-temporal stores before any later store
+ *
+ * After the fence, the lines written by streamLine() are visible to a thread
+ * that observes a later store (e.g., the release of a lock or of an atomic).
+ */
+inline void streamFence()
+{
+#if defined(ITERTOOLS_NONTEMPORAL_X86)
+    _mm_sfence();
+#elif defined(ITERTOOLS_NONTEMPORAL_BUILTIN)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_NONTEMPORAL_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/NonTemporal.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,577 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/PrefetchIterator.hh
+ * \brief  PrefetchIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_PREFETCHITERATOR_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_PREFETCHITERATOR_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "core/Macros.hh"
+#include "ZipIteratorTraits.hh"
+
+namespace itertools
+{
+//---------------------------------------------------------------------------//
+//! Whether prefetched elements will be read or written
+enum class PrefetchAccess
+{
+    read = 0,
+    write = 1
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Size in bytes of the cache lines fetched by a prefetch
+constexpr std::size_t prefetch_line_size = 64;
+
+//===========================================================================//
+/*!
+ * \struct PrefetchStorage
+ * \brief Storage of the position of a prefetch iterator
+ *
+ * When \c Bounded is true, the end of the sequence is stored as well, so
+ * that elements past it are not addressed through the iterator.
+ */
+//===========================================================================//
+
+template<bool Bounded, typename Iterator>
+struct PrefetchStorage
+{
+    //! Stores the underlying iterator
+    Iterator iter{};
+};
+
+template<typename Iterator>
+struct PrefetchStorage<true, Iterator>
+{
+    //! Stores the underlying iterator
+    Iterator iter{};
+
+    //! Stores the end of the sequence
+    Iterator last{};
+};
+
+//===========================================================================//
+/*!
+ * \class PrefetchIterator
+ * \brief Random-access iterator that prefetches the element \c Distance ahead
+ *
+ * Every time the iterator advances, it hints the processor to fetch the
+ * element \c Distance positions ahead of the current one for reading or
+ * writing, as selected by \c Access.  Otherwise it behaves exactly as the
+ * underlying iterator.  Used as a stream of a zip, it prefetches that stream
+ * only, so each stream chooses its own distance and access:
+ * \code
+ * for (auto [xi, yi] : zip(prefetched<64>(x),
+ *                          prefetched<64, PrefetchAccess::write>(y)))
+ * \endcode
+ *
+ * For a contiguous iterator, incrementing issues a prefetch only when the
+ * prefetched element starts a new cache line, so small elements cost one
+ * prefetch per line rather than one per element; advancing by more than one
+ * element always prefetches.  Other random-access iterators, such as the
+ * indirect iterators of indirect() and the strided columns of aosColumns(),
+ * prefetch the address of <tt>iter[Distance]</tt> at every increment.  Since
+ * computing that address may read the sequence (e.g., the indices of an
+ * indirect iterator), they also store the end of the sequence and do not
+ * prefetch past it.
+ *
+ * The distance counts elements, not bytes, and should cover the memory
+ * latency: a good value is the number of iterations the loop executes in a
+ * few hundred nanoseconds.  A distance of zero disables prefetching.
+ * Prefetching never faults, so the prefetched element may lie past the end
+ * of a contiguous sequence.
+ *
+ * Since the iterator holds its own position, a zip over prefetch iterators
+ * advances each stream separately rather than through a shared index.
+ *
+ * \example zip/tests/tstPrefetch.cc
+ */
+//===========================================================================//
+
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+class PrefetchIterator
+{
+    static_assert(std::is_base_of_v<
+                      std::random_access_iterator_tag,
+                      typename std::iterator_traits<Iterator>::iterator_category>,
+                  "only random-access iterators can be prefetched");
+    static_assert(
+        std::is_lvalue_reference_v<
+            typename std::iterator_traits<Iterator>::reference>,
+        "only elements stored in memory can be prefetched");
+    static_assert(Distance >= 0);
+
+  public:
+    //! Public type aliases
+    using This = PrefetchIterator<Iterator, Distance, Access>;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    using pointer = typename std::iterator_traits<Iterator>::pointer;
+    using iterator_category = std::random_access_iterator_tag;
+
+    //! Whether the underlying iterator is contiguous
+    static constexpr bool is_contiguous = is_contiguous_iterator_v<Iterator>;
+
+  public:
+    // Default constructor
+    PrefetchIterator() = default;
+
+    // Construct with a contiguous underlying iterator
+    inline explicit PrefetchIterator(Iterator iter);
+
+    // Construct with the underlying iterator and the end of the sequence
+    inline PrefetchIterator(Iterator iter, Iterator last);
+
+    // >>> INCREMENT
+    // Pre-increment
+    inline This& operator++();
+
+    // Post-increment
+    inline This operator++(int);
+
+    // >>> DECREMENT
+    //! Pre-decrement
+    This& operator--()
+    {
+        --m_data.iter;
+        return *this;
+    }
+
+    // Post-decrement
+    inline This operator--(int);
+
+    // >>> DEREFERENCE, INDEXING
+    //! Dereference
+    reference operator*() const { return *m_data.iter; }
+
+    //! Pointer
+    pointer operator->() const { return std::addressof(*m_data.iter); }
+
+    //! Indexing
+    reference operator[](difference_type n) const { return m_data.iter[n]; }
+
+    // >>> COMPOUND ARITHMETIC
+    // Advance by n elements
+    inline This& operator+=(difference_type n);
+
+    //! Move back by n elements
+    This& operator-=(difference_type n)
+    {
+        m_data.iter -= n;
+        return *this;
+    }
+
+    // >>> ACCESSORS
+    //! Return the underlying iterator
+    const Iterator& base() const { return m_data.iter; }
+
+  private:
+    // Prefetch the element n + Distance positions ahead
+    inline void prefetch(difference_type n) const;
+
+    // >>> DATA
+    //! Stores the underlying iterator, and the end of a non-contiguous one
+    PrefetchStorage<!is_contiguous, Iterator> m_data;
+};
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+// Sum between a prefetch iterator and a distance
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline PrefetchIterator<Iterator, Distance, Access> operator+(
+    PrefetchIterator<Iterator, Distance, Access> iter,
+    typename PrefetchIterator<Iterator, Distance, Access>::difference_type n);
+
+// Sum between a distance and a prefetch iterator
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline PrefetchIterator<Iterator, Distance, Access> operator+(
+    typename PrefetchIterator<Iterator, Distance, Access>::difference_type n,
+    PrefetchIterator<Iterator, Distance, Access> iter);
+
+// Difference between a prefetch iterator and a distance
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline PrefetchIterator<Iterator, Distance, Access> operator-(
+    PrefetchIterator<Iterator, Distance, Access> iter,
+    typename PrefetchIterator<Iterator, Distance, Access>::difference_type n);
+
+// Difference between two prefetch iterators
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline typename PrefetchIterator<Iterator, Distance, Access>::difference_type
+operator-(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+          const PrefetchIterator<Iterator, Distance, Access>& iter2);
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+// Equality operator
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline bool
+operator==(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+           const PrefetchIterator<Iterator, Distance, Access>& iter2);
+
+// Inequality operator
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline bool
+operator!=(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+           const PrefetchIterator<Iterator, Distance, Access>& iter2);
+
+// Less-than operator
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline bool
+operator<(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+          const PrefetchIterator<Iterator, Distance, Access>& iter2);
+
+// Less-than or equal operator
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline bool
+operator<=(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+           const PrefetchIterator<Iterator, Distance, Access>& iter2);
+
+// Greater-than operator
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline bool
+operator>(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+          const PrefetchIterator<Iterator, Distance, Access>& iter2);
+
+// Greater-than or equal operator
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+inline bool
+operator>=(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+           const PrefetchIterator<Iterator, Distance, Access>& iter2);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct with a contiguous underlying iterator
+ *
+ * \param[in] iter  The underlying contiguous iterator
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+PrefetchIterator<Iterator, Distance, Access>::PrefetchIterator(Iterator iter)
+{
+    static_assert(is_contiguous,
+                  "the end of a non-contiguous sequence must be given");
+
+    m_data.iter = iter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct with the underlying iterator and the end of the sequence
+ *
+ * \param[in] iter  The underlying iterator
+ * \param[in] last  The end of the sequence, beyond which elements are not
+ *                  prefetched through a non-contiguous iterator
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+PrefetchIterator<Iterator, Distance, Access>::PrefetchIterator(Iterator iter,
+                                                               Iterator last)
+{
+    m_data.iter = iter;
+    if constexpr (!is_contiguous)
+    {
+        m_data.last = last;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// INCREMENT
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pre-increment, prefetching the element \c Distance ahead
+ *
+ * \return A reference to this iterator after the increment
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+auto PrefetchIterator<Iterator, Distance, Access>::operator++() -> This&
+{
+    this->prefetch(1);
+    ++m_data.iter;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-increment, prefetching the element \c Distance ahead
+ *
+ * \return A copy of this iterator before the increment
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+auto PrefetchIterator<Iterator, Distance, Access>::operator++(int) -> This
+{
+    This copy = *this;
+    ++(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-decrement
+ *
+ * \return A copy of this iterator before the decrement
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+auto PrefetchIterator<Iterator, Distance, Access>::operator--(int) -> This
+{
+    This copy = *this;
+    --m_data.iter;
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance by \p n elements, prefetching the element \c Distance ahead
+ *        of the new position
+ *
+ * \param[in] n  The number of elements
+ *
+ * \return A reference to this iterator
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+auto PrefetchIterator<Iterator, Distance, Access>::operator+=(
+    difference_type n) -> This&
+{
+    if (n > 0)
+    {
+        this->prefetch(n);
+    }
+    m_data.iter += n;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Prefetch the element \p n + \c Distance positions ahead
+ *
+ * The current position must be dereferenceable.  For a contiguous iterator,
+ * the address is computed on integers, as it may lie past the end of the
+ * sequence, and single increments skip the prefetch unless the element
+ * starts a cache line.  Otherwise, the address of the element is taken
+ * through the iterator if the element lies before the end of the sequence.
+ *
+ * \param[in] n  The number of elements the iterator is about to advance
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+void PrefetchIterator<Iterator, Distance, Access>::prefetch(
+    difference_type n) const
+{
+    if constexpr (Distance > 0 && is_contiguous)
+    {
+        const auto address
+            = reinterpret_cast<std::uintptr_t>(std::addressof(*m_data.iter))
+              + static_cast<std::uintptr_t>(n + Distance)
+                    * sizeof(value_type);
+        if (n == 1 && address % prefetch_line_size >= sizeof(value_type))
+        {
+            // The line was prefetched by an earlier increment
+            return;
+        }
+        ITERTOOLS_PREFETCH(reinterpret_cast<const void*>(address),
+                           static_cast<int>(Access),
+                           3);
+    }
+    else if constexpr (Distance > 0)
+    {
+        if (n + Distance < m_data.last - m_data.iter)
+        {
+            ITERTOOLS_PREFETCH(
+                static_cast<const void*>(std::addressof(m_data.iter[n + Distance])),
+                static_cast<int>(Access),
+                3);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a prefetch iterator and a distance
+ *
+ * \param[in] iter  The prefetch iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n elements after \p iter
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+PrefetchIterator<Iterator, Distance, Access> operator+(
+    PrefetchIterator<Iterator, Distance, Access> iter,
+    typename PrefetchIterator<Iterator, Distance, Access>::difference_type n)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a distance and a prefetch iterator
+ *
+ * \param[in] n     The distance
+ * \param[in] iter  The prefetch iterator
+ *
+ * \return The iterator \p n elements after \p iter
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+PrefetchIterator<Iterator, Distance, Access> operator+(
+    typename PrefetchIterator<Iterator, Distance, Access>::difference_type n,
+    PrefetchIterator<Iterator, Distance, Access> iter)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between a prefetch iterator and a distance
+ *
+ * \param[in] iter  The prefetch iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n elements before \p iter
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+PrefetchIterator<Iterator, Distance, Access> operator-(
+    PrefetchIterator<Iterator, Distance, Access> iter,
+    typename PrefetchIterator<Iterator, Distance, Access>::difference_type n)
+{
+    return iter -= n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between two prefetch iterators
+ *
+ * \param[in] iter1  The first prefetch iterator
+ * \param[in] iter2  The second prefetch iterator
+ *
+ * \return The number of elements from \p iter2 to \p iter1
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+typename PrefetchIterator<Iterator, Distance, Access>::difference_type
+operator-(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+          const PrefetchIterator<Iterator, Distance, Access>& iter2)
+{
+    return iter1.base() - iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Equality operator
+ *
+ * \param[in] iter1  The first prefetch iterator
+ * \param[in] iter2  The second prefetch iterator
+ *
+ * \return True if the underlying iterators are equal
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+bool operator==(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+                const PrefetchIterator<Iterator, Distance, Access>& iter2)
+{
+    return iter1.base() == iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inequality operator
+ *
+ * \param[in] iter1  The first prefetch iterator
+ * \param[in] iter2  The second prefetch iterator
+ *
+ * \return True if the underlying iterators differ
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+bool operator!=(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+                const PrefetchIterator<Iterator, Distance, Access>& iter2)
+{
+    return iter1.base() != iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than operator
+ *
+ * \param[in] iter1  The first prefetch iterator
+ * \param[in] iter2  The second prefetch iterator
+ *
+ * \return True if \p iter1 precedes \p iter2
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+bool operator<(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+               const PrefetchIterator<Iterator, Distance, Access>& iter2)
+{
+    return iter1.base() < iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than or equal operator
+ *
+ * \param[in] iter1  The first prefetch iterator
+ * \param[in] iter2  The second prefetch iterator
+ *
+ * \return True if \p iter1 does not follow \p iter2
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+bool operator<=(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+                const PrefetchIterator<Iterator, Distance, Access>& iter2)
+{
+    return iter1.base() <= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than operator
+ *
+ * \param[in] iter1  The first prefetch iterator
+ * \param[in] iter2  The second prefetch iterator
+ *
+ * \return True if \p iter1 follows \p iter2
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+bool operator>(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+               const PrefetchIterator<Iterator, Distance, Access>& iter2)
+{
+    return iter1.base() > iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than or equal operator
+ *
+ * \param[in] iter1  The first prefetch iterator
+ * \param[in] iter2  The second prefetch iterator
+ *
+ * \return True if \p iter1 does not precede \p iter2
+ */
+template<typename Iterator, std::ptrdiff_t Distance, PrefetchAccess Access>
+bool operator>=(const PrefetchIterator<Iterator, Distance, Access>& iter1,
+                const PrefetchIterator<Iterator, Distance, Access>& iter2)
+{
+    return iter1.base() >= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_PREFETCHITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/PrefetchIterator.hh
+//---------------------------------------------------------------------------//
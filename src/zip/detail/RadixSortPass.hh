@@ -0,0 +1,274 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/RadixSortPass.hh
+ * \brief  RadixKey class and radix sort pass declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_RADIXSORTPASS_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_RADIXSORTPASS_HH
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ZipIterator.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \struct RadixKey
+ * \brief Maps sort keys to unsigned integers of the same order
+ *
+ * Radix sorting compares the bits of the keys as unsigned integers, one digit
+ * of \c radix_bits bits at a time from the least significant.  Unsigned keys
+ * are sorted as they are; signed integers have their sign bit flipped; and
+ * floating-point numbers have their sign bit flipped when positive and every
+ * bit flipped when negative, which orders them as \c operator< does, except
+ * that -0 precedes +0 and NaNs sort after +inf (or before -inf if negative).
+ */
+//===========================================================================//
+
+template<typename Key, typename = void>
+struct RadixKey;
+
+template<typename Key>
+struct RadixKey<Key, std::enable_if_t<std::is_integral_v<Key>>>
+{
+    static_assert(!std::is_same_v<Key, bool>, "bool keys are not supported");
+
+    //! Unsigned integer holding the bits of the key
+    using Bits_t = std::make_unsigned_t<Key>;
+
+    //! Return the unsigned bits of a key
+    static constexpr Bits_t bits(Key key)
+    {
+        constexpr Bits_t sign_bit
+            = std::is_signed_v<Key>
+                  ? static_cast<Bits_t>(Bits_t(1) << (8 * sizeof(Key) - 1))
+                  : Bits_t(0);
+        return static_cast<Bits_t>(static_cast<Bits_t>(key) ^ sign_bit);
+    }
+};
+
+template<typename Key>
+struct RadixKey<Key, std::enable_if_t<std::is_floating_point_v<Key>>>
+{
+    static_assert(std::numeric_limits<Key>::is_iec559
+                      && (sizeof(Key) == 4 || sizeof(Key) == 8),
+                  "only IEEE single and double precision keys are supported");
+
+    //! Unsigned integer holding the bits of the key
+    using Bits_t
+        = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+
+    //! Return the unsigned bits of a key
+    static Bits_t bits(Key key)
+    {
+        constexpr Bits_t sign_bit = Bits_t(1) << (8 * sizeof(Key) - 1);
+        Bits_t result;
+        std::memcpy(&result, &key, sizeof(Key));
+        return (result & sign_bit) ? Bits_t(~result)
+                                   : Bits_t(result ^ sign_bit);
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Number of bits per digit
+constexpr unsigned int radix_bits = 8;
+
+//! Number of distinct digits
+constexpr std::size_t radix_size = std::size_t(1) << radix_bits;
+
+//! Count of the keys per digit value
+using RadixHistogram = std::array<std::size_t, radix_size>;
+
+//---------------------------------------------------------------------------//
+// Return the iterators of the columns sorted together, the keys first
+template<typename Iterator>
+inline auto radixColumns(const Iterator& iter)
+{
+    if constexpr (is_zip_iterator_v<Iterator>)
+    {
+        return iter.getIters();
+    }
+    else
+    {
+        return std::tuple<Iterator>(iter);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Type of the columns of a zip iterator or a single iterator
+template<typename Iterator>
+using radix_columns_t
+    = decltype(radixColumns(std::declval<const Iterator&>()));
+
+// Type of the keys
+template<typename Iterator>
+using radix_key_t = typename std::iterator_traits<
+    std::tuple_element_t<0, radix_columns_t<Iterator>>>::value_type;
+
+// Type of the digit histograms of every pass
+template<typename Iterator>
+using radix_histograms_t
+    = std::array<RadixHistogram, sizeof(radix_key_t<Iterator>)>;
+
+//---------------------------------------------------------------------------//
+// Return digit 'pass' of the bits of a key
+template<typename Bits>
+constexpr std::size_t radixDigit(Bits bits, std::size_t pass)
+{
+    return static_cast<std::size_t>((bits >> (pass * radix_bits))
+                                    & Bits(radix_size - 1));
+}
+
+//---------------------------------------------------------------------------//
+// Count the digits of every pass of the keys [begin, end)
+template<typename KeyIterator, typename Histograms>
+inline void radixCountAll(KeyIterator keys,
+                          std::size_t begin,
+                          std::size_t end,
+                          Histograms& histograms)
+{
+    using Key_t = typename std::iterator_traits<KeyIterator>::value_type;
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const auto bits = RadixKey<Key_t>::bits(keys[i]);
+        for (std::size_t pass = 0; pass < histograms.size(); ++pass)
+        {
+            ++histograms[pass][radixDigit(bits, pass)];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Count digit 'pass' of the keys [begin, end)
+template<typename KeyIterator>
+inline void radixCount(KeyIterator keys,
+                       std::size_t begin,
+                       std::size_t end,
+                       std::size_t pass,
+                       RadixHistogram& histogram)
+{
+    using Key_t = typename std::iterator_traits<KeyIterator>::value_type;
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        ++histogram[radixDigit(RadixKey<Key_t>::bits(keys[i]), pass)];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Whether every key has the same digit, so that the pass is a no-op
+inline bool radixPassIsTrivial(const RadixHistogram& histogram, std::size_t n)
+{
+    for (std::size_t count : histogram)
+    {
+        if (count != 0)
+        {
+            return count == n;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Move the elements [begin, end) of every source column to the position of
+// their digit in the destination columns, advancing the offsets
+template<typename Source, typename Destination, std::size_t... I>
+inline void radixScatter(const Source& src,
+                         const Destination& dst,
+                         std::size_t begin,
+                         std::size_t end,
+                         std::size_t pass,
+                         RadixHistogram& offsets,
+                         std::index_sequence<I...>)
+{
+    using Key_t = typename std::iterator_traits<
+        std::tuple_element_t<0, Source>>::value_type;
+
+    const auto keys = std::get<0>(src);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const std::size_t pos
+            = offsets[radixDigit(RadixKey<Key_t>::bits(keys[i]), pass)]++;
+        ((std::get<I>(dst)[pos] = std::move(std::get<I>(src)[i])), ...);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Move the elements [begin, end) of every source column to the destination
+template<typename Source, typename Destination, std::size_t... I>
+inline void radixMove(const Source& src,
+                      const Destination& dst,
+                      std::size_t begin,
+                      std::size_t end,
+                      std::index_sequence<I...>)
+{
+    (std::move(std::get<I>(src) + begin,
+               std::get<I>(src) + end,
+               std::get<I>(dst) + begin),
+     ...);
+}
+
+//===========================================================================//
+/*!
+ * \class RadixBuffers
+ * \brief Scratch columns of a radix sort
+ *
+ * The buffers hold one array per column, of the columns' value types, into
+ * which the elements are scattered every other pass.  Arithmetic elements
+ * are left uninitialized, since every pass overwrites all of them.
+ */
+//===========================================================================//
+
+template<typename Columns, typename = std::make_index_sequence<
+                               std::tuple_size_v<Columns>>>
+class RadixBuffers;
+
+template<typename Columns, std::size_t... I>
+class RadixBuffers<Columns, std::index_sequence<I...>>
+{
+    template<std::size_t J>
+    using Value_t = typename std::iterator_traits<
+        std::tuple_element_t<J, Columns>>::value_type;
+
+  public:
+    //! Allocate default-initialized columns of n elements
+    explicit RadixBuffers(std::size_t n)
+        : m_columns(std::unique_ptr<Value_t<I>[]>(new Value_t<I>[n])...)
+    {
+    }
+
+    //! Return pointers to the beginnings of the columns
+    std::tuple<Value_t<I>*...> columns()
+    {
+        return std::tuple<Value_t<I>*...>(std::get<I>(m_columns).get()...);
+    }
+
+  private:
+    // >>> DATA
+    std::tuple<std::unique_ptr<Value_t<I>[]>...> m_columns;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_RADIXSORTPASS_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/RadixSortPass.hh
+//---------------------------------------------------------------------------//
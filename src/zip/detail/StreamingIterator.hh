@@ -0,0 +1,780 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/StreamingIterator.hh
+ * \brief  StreamingBuffer, StreamingReference and StreamingIterator class
+ *         declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_STREAMINGITERATOR_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_STREAMINGITERATOR_HH
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "core/DBC.hh"
+#include "core/Macros.hh"
+#include "NonTemporal.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class StreamingBuffer
+ * \brief Write-combining buffer of one cache line of a sequence
+ *
+ * The buffer holds the elements assigned to one destination cache line.  When
+ * an element of another line is assigned, the buffered line is written out:
+ * with a non-temporal streamLine() when every element of the line was
+ * assigned, or with ordinary stores of the assigned elements otherwise
+ * (i.e., at the unaligned ends of the sequence or when elements are
+ * skipped).  Elements that were not assigned are never written.
+ *
+ * Blocks of elements computed together are stored with store(), which
+ * streams the whole lines of the block directly from the source and only
+ * buffers its partial first and last lines.
+ *
+ * flush() writes out the buffered line and fences the non-temporal stores;
+ * the destructor flushes.  The buffer is not synchronized: it may only be
+ * used by one thread at a time.
+ */
+//===========================================================================//
+
+template<typename T>
+class StreamingBuffer
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "only trivially copyable elements can be streamed");
+    static_assert(sizeof(T) <= nontemporal_line_size
+                      && nontemporal_line_size % sizeof(T) == 0,
+                  "the element size must divide the cache line size");
+
+  public:
+    //! Number of elements in a cache line
+    static constexpr std::size_t line_elements
+        = nontemporal_line_size / sizeof(T);
+
+  public:
+    //! Default constructor
+    StreamingBuffer() = default;
+
+    //! Flush on destruction
+    ~StreamingBuffer() { this->flush(); }
+
+    // Not copyable: iterators refer to the buffer
+    StreamingBuffer(const StreamingBuffer&) = delete;
+    StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+    // Assign the element at the address pos
+    inline void assign(T* pos, const T& value);
+
+    // Return the value of the element at the address pos
+    inline T get(const T* pos) const;
+
+    // Store count contiguous elements at the address dest
+    inline void store(T* dest, const T* values, std::size_t count);
+
+    // Write out the buffered line and fence the non-temporal stores
+    inline void flush();
+
+  private:
+    // Return the address of the cache line of the element at pos
+    inline static T* lineOf(const T* pos);
+
+    // Return the index of the element at pos in its cache line
+    inline static std::size_t indexOf(const T* pos);
+
+    // Write out the buffered line
+    inline void writeLine();
+
+    // Write out the assigned elements of a partial line
+    void writePartialLine();
+
+    // >>> DATA
+    //! Stores the buffered line
+    alignas(nontemporal_line_size) T m_line[line_elements] = {};
+
+    //! Stores the destination of the buffered line
+    T* m_dest = nullptr;
+
+    //! Stores whether each element of the line was assigned
+    unsigned char m_assigned[line_elements] = {};
+
+    //! Whether lines were streamed since the last fence
+    bool m_streamed = false;
+};
+
+//===========================================================================//
+/*!
+ * \class StreamingReference
+ * \brief Proxy reference to an element buffered by a StreamingBuffer
+ *
+ * Assigning through the reference writes the element into the buffer, so
+ * elements that are dereferenced but never assigned (e.g., when a loop body
+ * skips them or exits early) keep their values in memory.  Converting the
+ * reference to a value reads the element from the buffer if it is pending,
+ * and from memory otherwise.
+ */
+//===========================================================================//
+
+template<typename T>
+class StreamingReference
+{
+  public:
+    //! Construct with the buffer and the address of the element
+    StreamingReference(StreamingBuffer<T>* buffer, T* pos)
+        : m_buffer(buffer), m_pos(pos)
+    {
+    }
+
+    //! Copy constructor (refers to the same element)
+    StreamingReference(const StreamingReference&) = default;
+
+    //! Assign a value to the element
+    const StreamingReference& operator=(const T& value) const
+    {
+        m_buffer->assign(m_pos, value);
+        return *this;
+    }
+
+    //! Assign the value of another element
+    const StreamingReference& operator=(const StreamingReference& other) const
+    {
+        return *this = static_cast<T>(other);
+    }
+
+    //! Return the value of the element
+    operator T() const { return m_buffer->get(m_pos); }
+
+  private:
+    // >>> DATA
+    StreamingBuffer<T>* m_buffer;
+    T* m_pos;
+};
+
+//===========================================================================//
+/*!
+ * \class StreamingIterator
+ * \brief Output iterator writing a contiguous sequence through a
+ *        StreamingBuffer
+ *
+ * Dereferencing returns a StreamingReference to the buffered copy of the
+ * element, which reaches memory when the buffer moves to another cache line.
+ * Reaching the end of the sequence, by incrementing or advancing, flushes the
+ * buffer.  The elements can be assigned and read, but not updated in place
+ * through compound assignments.
+ *
+ * All the iterators of a sequence share its buffer, so they may only be used
+ * by one thread at a time.  They therefore declare the forward category even
+ * though they can be advanced and subtracted in constant time: parallelFor
+ * rejects them (and a zip containing them) at compile time, and the parallel
+ * standard algorithms process them serially rather than splitting them
+ * between threads.  The iterator is not contiguous either: a zip advances it
+ * separately.
+ *
+ * \example zip/tests/tstStreaming.cc
+ */
+//===========================================================================//
+
+template<typename T>
+class StreamingIterator
+{
+  public:
+    //! Public type aliases
+    using This = StreamingIterator<T>;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using reference = StreamingReference<T>;
+    using pointer = void;
+    using iterator_category = std::forward_iterator_tag;
+
+  public:
+    // Default constructor
+    StreamingIterator() = default;
+
+    // Construct with a position, the end of the sequence and the buffer
+    inline StreamingIterator(T* pos, T* last, StreamingBuffer<T>* buffer);
+
+    // >>> INCREMENT
+    // Pre-increment
+    inline This& operator++();
+
+    // Post-increment
+    inline This operator++(int);
+
+    // >>> DECREMENT
+    //! Pre-decrement
+    This& operator--()
+    {
+        --m_pos;
+        return *this;
+    }
+
+    // Post-decrement
+    inline This operator--(int);
+
+    // >>> DEREFERENCE, INDEXING
+    // Dereference
+    inline reference operator*() const;
+
+    //! Indexing
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    // >>> COMPOUND ARITHMETIC
+    // Advance by n elements
+    inline This& operator+=(difference_type n);
+
+    //! Move back by n elements
+    This& operator-=(difference_type n)
+    {
+        m_pos -= n;
+        return *this;
+    }
+
+    // >>> ACCESSORS
+    //! Return the destination of the current element
+    T* base() const { return m_pos; }
+
+  private:
+    // >>> DATA
+    //! Stores the current position
+    T* m_pos = nullptr;
+
+    //! Stores the end of the sequence
+    T* m_last = nullptr;
+
+    //! Stores the buffer of the sequence
+    StreamingBuffer<T>* m_buffer = nullptr;
+};
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+// Sum between a streaming iterator and a distance
+template<typename T>
+inline StreamingIterator<T>
+operator+(StreamingIterator<T> iter,
+          typename StreamingIterator<T>::difference_type n);
+
+// Sum between a distance and a streaming iterator
+template<typename T>
+inline StreamingIterator<T>
+operator+(typename StreamingIterator<T>::difference_type n,
+          StreamingIterator<T> iter);
+
+// Difference between a streaming iterator and a distance
+template<typename T>
+inline StreamingIterator<T>
+operator-(StreamingIterator<T> iter,
+          typename StreamingIterator<T>::difference_type n);
+
+// Difference between two streaming iterators
+template<typename T>
+inline typename StreamingIterator<T>::difference_type
+operator-(const StreamingIterator<T>& iter1,
+          const StreamingIterator<T>& iter2);
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+// Equality operator
+template<typename T>
+inline bool operator==(const StreamingIterator<T>& iter1,
+                       const StreamingIterator<T>& iter2);
+
+// Inequality operator
+template<typename T>
+inline bool operator!=(const StreamingIterator<T>& iter1,
+                       const StreamingIterator<T>& iter2);
+
+// Less-than operator
+template<typename T>
+inline bool operator<(const StreamingIterator<T>& iter1,
+                      const StreamingIterator<T>& iter2);
+
+// Less-than or equal operator
+template<typename T>
+inline bool operator<=(const StreamingIterator<T>& iter1,
+                       const StreamingIterator<T>& iter2);
+
+// Greater-than operator
+template<typename T>
+inline bool operator>(const StreamingIterator<T>& iter1,
+                      const StreamingIterator<T>& iter2);
+
+// Greater-than or equal operator
+template<typename T>
+inline bool operator>=(const StreamingIterator<T>& iter1,
+                       const StreamingIterator<T>& iter2);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+// STREAMINGBUFFER
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Assign the element at the address \p pos
+ *
+ * If \p pos lies in another cache line than the buffered one, the buffered
+ * line is written out first.  The address must be aligned to the size
+ * of the elements, so that no element straddles two lines.
+ *
+ * \param[in] pos    The destination of the element
+ * \param[in] value  The value of the element
+ */
+template<typename T>
+void StreamingBuffer<T>::assign(T* pos, const T& value)
+{
+    IT_REQUIRE(reinterpret_cast<std::uintptr_t>(pos) % sizeof(T) == 0);
+
+    T* const dest = lineOf(pos);
+    if (ITERTOOLS_UNLIKELY(dest != m_dest))
+    {
+        this->writeLine();
+        m_dest = dest;
+    }
+
+    // Flags are stored rather than or-ed into a mask, so that consecutive
+    // assignments do not depend on each other through memory
+    const std::size_t i = indexOf(pos);
+    m_line[i] = value;
+    m_assigned[i] = 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the value of the element at the address \p pos
+ *
+ * \param[in] pos  The address of the element
+ *
+ * \return The buffered value if the element was assigned and not yet
+ *         written out, the value in memory otherwise
+ */
+template<typename T>
+T StreamingBuffer<T>::get(const T* pos) const
+{
+    const std::size_t i = indexOf(pos);
+    if (lineOf(pos) == m_dest && m_assigned[i])
+    {
+        return m_line[i];
+    }
+    return *pos;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Store \p count contiguous elements at the address \p dest
+ *
+ * The elements before the first line boundary are assigned through the
+ * buffer, completing the line left partial by a previous block if any.  The
+ * whole lines that follow are streamed straight from \p values, without
+ * per-element bookkeeping, and the remaining elements are buffered again.
+ *
+ * \param[in] dest    The destination of the first element
+ * \param[in] values  The elements to store
+ * \param[in] count   The number of elements
+ */
+template<typename T>
+void StreamingBuffer<T>::store(T* dest, const T* values, std::size_t count)
+{
+    IT_REQUIRE(reinterpret_cast<std::uintptr_t>(dest) % sizeof(T) == 0);
+
+    for (; count > 0 && indexOf(dest) != 0; --count)
+    {
+        this->assign(dest++, *values++);
+    }
+    if (count >= line_elements)
+    {
+        // The buffered line is written out first, as it may be one of the
+        // lines overwritten below
+        this->writeLine();
+        m_dest = nullptr;
+        for (; count >= line_elements; count -= line_elements)
+        {
+            streamLine(dest, values);
+            dest += line_elements;
+            values += line_elements;
+        }
+        m_streamed = true;
+    }
+    for (; count > 0; --count)
+    {
+        this->assign(dest++, *values++);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write out the buffered line and fence the non-temporal stores
+ */
+template<typename T>
+void StreamingBuffer<T>::flush()
+{
+    this->writeLine();
+    if (m_streamed)
+    {
+        streamFence();
+        m_streamed = false;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the address of the cache line of the element at \p pos
+ *
+ * \param[in] pos  The address of the element
+ *
+ * \return The address of the beginning of the line
+ */
+template<typename T>
+T* StreamingBuffer<T>::lineOf(const T* pos)
+{
+    return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(pos)
+                                & ~std::uintptr_t(nontemporal_line_size - 1));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Return the index of the element at \p pos in its cache line
+ *
+ * \param[in] pos  The address of the element
+ *
+ * \return The index of the element in the line
+ */
+template<typename T>
+std::size_t StreamingBuffer<T>::indexOf(const T* pos)
+{
+    return (reinterpret_cast<std::uintptr_t>(pos) % nontemporal_line_size)
+           / sizeof(T);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write out the buffered line
+ *
+ * A fully assigned line is streamed; otherwise, the assigned elements are
+ * stored by writePartialLine().
+ */
+template<typename T>
+void StreamingBuffer<T>::writeLine()
+{
+    static constexpr auto all_assigned = [] {
+        std::array<unsigned char, line_elements> flags{};
+        for (auto& flag : flags)
+        {
+            flag = 1;
+        }
+        return flags;
+    }();
+
+    if (std::memcmp(m_assigned, all_assigned.data(), line_elements) == 0)
+    {
+        streamLine(m_dest, m_line);
+        m_streamed = true;
+        std::memset(m_assigned, 0, line_elements);
+    }
+    else
+    {
+        this->writePartialLine();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Write out the assigned elements of a partial line
+ *
+ * The elements are stored one by one so that their neighbors outside the
+ * sequence are left untouched.  Kept out of line, as partial lines only occur
+ * at the ends of a sequence or when elements are skipped.
+ */
+template<typename T>
+void StreamingBuffer<T>::writePartialLine()
+{
+    for (std::size_t i = 0; i < line_elements; ++i)
+    {
+        if (m_assigned[i])
+        {
+            m_dest[i] = m_line[i];
+            m_assigned[i] = 0;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// STREAMINGITERATOR
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct with a position, the end of the sequence and the buffer
+ *
+ * \param[in] pos     The destination of the current element
+ * \param[in] last    The end of the sequence
+ * \param[in] buffer  The buffer shared by the iterators of the sequence
+ */
+template<typename T>
+StreamingIterator<T>::StreamingIterator(T* pos,
+                                        T* last,
+                                        StreamingBuffer<T>* buffer)
+    : m_pos(pos), m_last(last), m_buffer(buffer)
+{
+    IT_REQUIRE(m_buffer);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pre-increment, flushing the buffer at the end of the sequence
+ *
+ * \return A reference to this iterator after the increment
+ */
+template<typename T>
+auto StreamingIterator<T>::operator++() -> This&
+{
+    if (ITERTOOLS_UNLIKELY(++m_pos == m_last))
+    {
+        m_buffer->flush();
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-increment
+ *
+ * \return A copy of this iterator before the increment
+ */
+template<typename T>
+auto StreamingIterator<T>::operator++(int) -> This
+{
+    This copy = *this;
+    ++(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-decrement
+ *
+ * \return A copy of this iterator before the decrement
+ */
+template<typename T>
+auto StreamingIterator<T>::operator--(int) -> This
+{
+    This copy = *this;
+    --m_pos;
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Dereference
+ *
+ * \return A proxy reference to the element
+ */
+template<typename T>
+auto StreamingIterator<T>::operator*() const -> reference
+{
+    IT_REQUIRE(m_buffer);
+    IT_REQUIRE(m_pos < m_last);
+    return reference(m_buffer, m_pos);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance by \p n elements, flushing the buffer at the end of the
+ *        sequence
+ *
+ * \param[in] n  The number of elements
+ *
+ * \return A reference to this iterator
+ */
+template<typename T>
+auto StreamingIterator<T>::operator+=(difference_type n) -> This&
+{
+    m_pos += n;
+    if (m_pos == m_last && m_buffer)
+    {
+        m_buffer->flush();
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+// ARITHMETIC OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a streaming iterator and a distance
+ *
+ * \param[in] iter  The streaming iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n elements after \p iter
+ */
+template<typename T>
+StreamingIterator<T> operator+(StreamingIterator<T> iter,
+                               typename StreamingIterator<T>::difference_type n)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Sum between a distance and a streaming iterator
+ *
+ * \param[in] n     The distance
+ * \param[in] iter  The streaming iterator
+ *
+ * \return The iterator \p n elements after \p iter
+ */
+template<typename T>
+StreamingIterator<T> operator+(typename StreamingIterator<T>::difference_type n,
+                               StreamingIterator<T> iter)
+{
+    return iter += n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between a streaming iterator and a distance
+ *
+ * \param[in] iter  The streaming iterator
+ * \param[in] n     The distance
+ *
+ * \return The iterator \p n elements before \p iter
+ */
+template<typename T>
+StreamingIterator<T> operator-(StreamingIterator<T> iter,
+                               typename StreamingIterator<T>::difference_type n)
+{
+    return iter -= n;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Difference between two streaming iterators
+ *
+ * \param[in] iter1  The first streaming iterator
+ * \param[in] iter2  The second streaming iterator
+ *
+ * \return The number of elements from \p iter2 to \p iter1
+ */
+template<typename T>
+typename StreamingIterator<T>::difference_type
+operator-(const StreamingIterator<T>& iter1, const StreamingIterator<T>& iter2)
+{
+    return iter1.base() - iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Equality operator
+ *
+ * \param[in] iter1  The first streaming iterator
+ * \param[in] iter2  The second streaming iterator
+ *
+ * \return True if the iterators are at the same position
+ */
+template<typename T>
+bool operator==(const StreamingIterator<T>& iter1,
+                const StreamingIterator<T>& iter2)
+{
+    return iter1.base() == iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Inequality operator
+ *
+ * \param[in] iter1  The first streaming iterator
+ * \param[in] iter2  The second streaming iterator
+ *
+ * \return True if the iterators are at different positions
+ */
+template<typename T>
+bool operator!=(const StreamingIterator<T>& iter1,
+                const StreamingIterator<T>& iter2)
+{
+    return iter1.base() != iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than operator
+ *
+ * \param[in] iter1  The first streaming iterator
+ * \param[in] iter2  The second streaming iterator
+ *
+ * \return True if \p iter1 precedes \p iter2
+ */
+template<typename T>
+bool operator<(const StreamingIterator<T>& iter1,
+               const StreamingIterator<T>& iter2)
+{
+    return iter1.base() < iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Less-than or equal operator
+ *
+ * \param[in] iter1  The first streaming iterator
+ * \param[in] iter2  The second streaming iterator
+ *
+ * \return True if \p iter1 does not follow \p iter2
+ */
+template<typename T>
+bool operator<=(const StreamingIterator<T>& iter1,
+                const StreamingIterator<T>& iter2)
+{
+    return iter1.base() <= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than operator
+ *
+ * \param[in] iter1  The first streaming iterator
+ * \param[in] iter2  The second streaming iterator
+ *
+ * \return True if \p iter1 follows \p iter2
+ */
+template<typename T>
+bool operator>(const StreamingIterator<T>& iter1,
+               const StreamingIterator<T>& iter2)
+{
+    return iter1.base() > iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Greater-than or equal operator
+ *
+ * \param[in] iter1  The first streaming iterator
+ * \param[in] iter2  The second streaming iterator
+ *
+ * \return True if \p iter1 does not precede \p iter2
+ */
+template<typename T>
+bool operator>=(const StreamingIterator<T>& iter1,
+                const StreamingIterator<T>& iter2)
+{
+    return iter1.base() >= iter2.base();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_STREAMINGITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/StreamingIterator.hh
+//---------------------------------------------------------------------------//
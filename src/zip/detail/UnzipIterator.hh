@@ -0,0 +1,144 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/UnzipIterator.hh
+ * \brief  UnzipIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_UNZIPITERATOR_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_UNZIPITERATOR_HH
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class UnzipIterator
+ * \brief Output iterator writing each element of a tuple to its own output
+ *
+ * The counterpart of ZipIterator for writing: assigning a tuple-like value
+ * (a \c std::tuple, \c std::pair, \c std::array or the ZipReference of a zip
+ * iterator) through an unzip iterator assigns its \c k-th element through the
+ * \c k-th output iterator, and incrementing advances every output.  It lets
+ * the standard algorithms split a sequence of tuples in one pass:
+ * \code
+ * std::transform(x.begin(), x.end(), makeUnzipIter(sin_x.begin(),
+ *                                                  cos_x.begin()),
+ *                [](double v) { return std::pair(sin(v), cos(v)); });
+ * \endcode
+ *
+ * \example zip/tests/tstUnzip.cc
+ */
+//===========================================================================//
+
+template<typename... Iterators>
+class UnzipIterator
+{
+    static_assert(sizeof...(Iterators) > 0, "no output iterator");
+
+  public:
+    //@{
+    //! Public type aliases
+    using This = UnzipIterator<Iterators...>;
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+    //@}
+
+  public:
+    // Default constructor
+    UnzipIterator() = default;
+
+    //! Construct with the output iterators
+    explicit UnzipIterator(Iterators... iters) : m_iters(std::move(iters)...)
+    {
+    }
+
+    // >>> ASSIGNMENT
+    //! Assign each element of a tuple-like value to its output
+    template<typename Tuple,
+             typename = std::enable_if_t<
+                 !std::is_same_v<std::decay_t<Tuple>, This>>>
+    This& operator=(Tuple&& values)
+    {
+        static_assert(
+            std::tuple_size<std::decay_t<Tuple>>::value
+                == sizeof...(Iterators),
+            "the values must have one element per output");
+        this->assign(std::forward<Tuple>(values),
+                     std::index_sequence_for<Iterators...>());
+        return *this;
+    }
+
+    // >>> DEREFERENCE, INCREMENT
+    //! Dereference to the iterator itself, which is assigned the values
+    This& operator*() { return *this; }
+
+    //! Pre-increment every output
+    This& operator++()
+    {
+        std::apply([](auto&... iter) { (++iter, ...); }, m_iters);
+        return *this;
+    }
+
+    //! Post-increment every output
+    This operator++(int)
+    {
+        This result(*this);
+        ++*this;
+        return result;
+    }
+
+    // >>> ACCESSORS
+    //! Return the output iterators
+    const std::tuple<Iterators...>& base() const { return m_iters; }
+
+  private:
+    // >>> IMPLEMENTATION
+    // Assign the elements of the values
+    template<typename Tuple, std::size_t... I>
+    void assign(Tuple&& values, std::index_sequence<I...>)
+    {
+        using std::get;
+        ((*std::get<I>(m_iters) = get<I>(std::forward<Tuple>(values))), ...);
+    }
+
+  private:
+    // >>> DATA
+    //! Stores the output iterators
+    std::tuple<Iterators...> m_iters;
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create an unzip iterator from multiple output iterators
+ *
+ * \param[in] iters  The output iterators, one per element of the tuples
+ *
+ * \return An unzip iterator over \p iters
+ */
+template<typename... Iterators>
+inline UnzipIterator<std::decay_t<Iterators>...>
+makeUnzipIter(Iterators&&... iters)
+{
+    return UnzipIterator<std::decay_t<Iterators>...>(
+        std::forward<Iterators>(iters)...);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_UNZIPITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/UnzipIterator.hh
+//---------------------------------------------------------------------------//
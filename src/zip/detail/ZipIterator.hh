@@ -8,16 +8,54 @@
 #ifndef ITERTOOLS_SRC_ZIP_DETAIL_ZIPITERATOR_HH
 #define ITERTOOLS_SRC_ZIP_DETAIL_ZIPITERATOR_HH
 
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "core/DBC.hh"
 #include "ZipIteratorTraits.hh"
+#include "ZipStorage.hh"
 
 namespace itertools
 {
 //===========================================================================//
 /*!
  * \class ZipIterator
- * \brief <++>
+ * \brief Iterates over several sequences in lockstep
+ *
+ * A zip iterator stores one iterator per sequence and advances all of them
+ * together.  Dereferencing yields a tuple of the references of the underlying
+ * iterators, so the elements can be read and written through structured
+ * bindings:
+ * \code
+ * auto iter = makeZipIter(x.begin(), y.begin());
+ * auto [xi, yi] = *iter;
+ * yi += a * xi;
+ * \endcode
+ *
+ * The iterator category is the weakest category of the underlying iterators.
+ * Two zip iterators are compared through their first iterator only; the
+ * remaining iterators are checked to agree under DBC.
+ *
+ * The iterators are stored by value in a standard-layout aggregate rather
+ * than in a \c std::tuple, so a zip of trivially copyable iterators is itself
+ * trivially copyable and standard-layout, and is passed to algorithms in
+ * registers where the ABI allows it.
  *
- * Long description or discussion goes here.
+ * Dereferencing returns a ZipReference, a tuple of references that assigns
+ * and swaps the referenced elements, so the standard sorting and
+ * partitioning algorithms reorder the zipped sequences together.  The
+ * iter_swap() and iter_move() overloads swap and move the elements of every
+ * stream.
+ *
+ * When every underlying iterator is contiguous (e.g., a pointer or a vector
+ * iterator), the zip keeps the iterators at their initial positions and
+ * advances a single shared index instead (see \c is_indexed).  Incrementing
+ * is then one addition whatever the number of streams, and dereferencing
+ * indexes each stream from its base, which keeps a single induction variable
+ * live in loops and lets the compiler vectorize them.
  *
  * \example zip/tests/tstZipIterator.cc
  */
@@ -26,33 +64,47 @@ namespace itertools
 template<typename Iterator1, typename... Iterators>
 class ZipIterator
 {
+    using Traits_t = detail::ZipIteratorTraits<Iterator1, Iterators...>;
+
   public:
     //! Public type aliases
-    using difference_type =
-        typename ZipIteratorTraits<Iterator1, Iterators...>::difference_type;
-    using reference =
-        typename ZipIteratorTraits<Iterator1, Iterators...>::reference;
-    using pointer =
-        typename ZipIteratorTraits<Iterator1, Iterators...>::pointer;
-    using value_type =
-        typename ZipIteratorsTraits<Iterator1, Iterators...>::value_type;
-    using iterator_category =
-        typename ZipIteratorTraits<Iterator1, Iterators...>::iterator_category;
+    using difference_type = typename Traits_t::difference_type;
+    using reference = typename Traits_t::reference;
+    using rvalue_reference = typename Traits_t::rvalue_reference;
+    using pointer = typename Traits_t::pointer;
+    using value_type = typename Traits_t::value_type;
+    using iterator_category = typename Traits_t::iterator_category;
     using This = ZipIterator<Iterator1, Iterators...>;
-    using Storage_t = std::tuple<Iterator1&&, Iterators&&...>;
+    using Storage_t = std::tuple<Iterator1, Iterators...>;
+
+    //! Whether the underlying iterators share a single index
+    static constexpr bool is_indexed
+        = (detail::is_contiguous_iterator_v<Iterator1> && ...
+           && detail::is_contiguous_iterator_v<Iterators>);
+
+  private:
+    // Index sequence over the underlying iterators
+    using Indices_t = std::index_sequence_for<Iterator1, Iterators...>;
+
+    // Storage of the underlying iterators and of their shared index
+    using Data_t = detail::
+        ZipStorage<is_indexed, difference_type, Iterator1, Iterators...>;
 
   public:
     // Default constructor
     ZipIterator() = default;
 
     // Construct with multiple iterators
-    template<typename OtherIterator1, typename... OtherIterators>
-    ZipIterator(OtherIterator1&& other_iter1, OtherIterators...&& other_iters);
-
-    // Copy operator taking iterators
-    template<typename OtherIterator1, typename... OtherIterators>
-    This&
-    operator=(OtherIterator1&& other_iter1, OtherIterators...&& other_iters);
+    template<typename OtherIterator1,
+             typename... OtherIterators,
+             std::enable_if_t<
+                 detail::is_zip_constructible_v<Storage_t,
+                                                OtherIterator1,
+                                                OtherIterators...>,
+                 bool>
+             = true>
+    inline explicit ZipIterator(OtherIterator1&& other_iter1,
+                                OtherIterators&&... other_iters);
 
     // >>> INCREMENT
     // Pre-increment operator
@@ -68,15 +120,12 @@ class ZipIterator
     // Post-decrement operator
     inline This operator--(int);
 
-    // >>> DEREFERENCE, POINTER, INDEX
-    // Dereference the pointer
-    inline reference operator*();
-
-    // Access underlying pointers
-    inline pointer operator->();
+    // >>> DEREFERENCE, INDEX
+    // Dereference the underlying iterators
+    inline reference operator*() const;
 
     // Index operation
-    inline reference operator[](difference_type n);
+    inline reference operator[](difference_type n) const;
 
     // >>> COMPOUND ARITHMETIC
     // Compound addition-assignment operator
@@ -86,24 +135,27 @@ class ZipIterator
     inline This& operator-=(difference_type n);
 
     // >>> ACCESSORS
-    // Access a particular underlying iterator
+    // Access a particular underlying iterator for modification
     template<std::size_t I>
-    std::tuple_element_t<I, Storage_t> get();
+    inline std::tuple_element_t<I, Storage_t>& get();
 
-    // Access a particular underlying iterator
+    // Get a particular underlying iterator
     template<std::size_t I>
-    std::tuple_element_t<I, Storage_t> get() const;
+    inline std::tuple_element_t<I, Storage_t> get() const;
 
-    //! Get the entire tuple of iterators
-    Storage_t& getIters() { return m_iterators; }
+    // Access the entire tuple of iterators for modification
+    inline std::tuple<Iterator1&, Iterators&...> getIters();
 
-    //! Get the entire tuple of iterators
-    const Storage_t& getIters() const { return m_iterators; }
+    // Get the entire tuple of iterators
+    inline Storage_t getIters() const;
 
   private:
+    // Move the underlying iterators to the shared index
+    inline void rebase();
+
     // >>> DATA
     //! Stores the underlying iterators
-    Storage_t m_iterators;
+    Data_t m_data;
 };
 
 //---------------------------------------------------------------------------//
@@ -132,7 +184,7 @@ template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
          typename... OtherIterators>
-std::common_type_t<
+inline std::common_type_t<
     typename ZipIterator<Iterator1, Iterators...>::difference_type,
     typename ZipIterator<OtherIterator1, OtherIterators...>::difference_type>
 operator-(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
@@ -198,61 +250,90 @@ operator>=(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
+// Create a zip iterator from multiple iterators
 template<typename Iterator1, typename... Iterators>
-ZipIterator<Iterator1, Iterators...>
-makeZipIter(Iterator1&& iter1, Iterators...&& iters);
+inline ZipIterator<std::decay_t<Iterator1>, std::decay_t<Iterators>...>
+makeZipIter(Iterator1&& iter1, Iterators&&... iters);
+
+// Swap the elements pointed to by two zip iterators
+template<typename Iterator1, typename... Iterators>
+inline void iter_swap(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
+                      const ZipIterator<Iterator1, Iterators...>& zip_iter2);
+
+// Cast the elements pointed to by a zip iterator to rvalues
+template<typename Iterator1, typename... Iterators>
+inline typename ZipIterator<Iterator1, Iterators...>::rvalue_reference
+iter_move(const ZipIterator<Iterator1, Iterators...>& zip_iter);
 
 //===========================================================================//
 // INLINE IMPLEMENTATION
 //===========================================================================//
 
-namespace
+namespace detail
 {
 //---------------------------------------------------------------------------//
-template<ckass ZipIterator, typename Op, std::size_t I...>
-void forEach(ZipIterator& zip_iter, Op&& op, std::index_sequence<I...>)
+// Whether an iterator is a zip iterator
+template<typename Iterator>
+struct is_zip_iterator : public std::false_type
+{
+};
+template<typename... Iterators>
+struct is_zip_iterator<ZipIterator<Iterators...>> : public std::true_type
 {
-    static_assert(std::tuple_size<Tup> == sizeof...(I));
+};
+template<typename Iterator>
+constexpr bool is_zip_iterator_v = is_zip_iterator<Iterator>::value;
 
-    (op(zip_iter.get<I>)...);
+//---------------------------------------------------------------------------//
+// Apply an operation to each element of a tuple or an iterator pack
+template<typename Tuple, typename Op, std::size_t... I>
+inline void forEach(Tuple& tup, Op&& op, std::index_sequence<I...>)
+{
+    static_assert(std::tuple_size_v<std::remove_const_t<Tuple>>
+                  == sizeof...(I));
+
+    using std::get;
+    (op(get<I>(tup)), ...);
 }
 
-template<typename ZipIterator, typename Op, std::size_t I...>
-decltype(auto)
-generate(ZipIterator& zip_iter, Op&& op, std::index_sequence<I...>)
+//---------------------------------------------------------------------------//
+// Construct a Result from the outcome of an operation on each element of a
+// tuple or an iterator pack
+template<typename Result, typename Tuple, typename Op, std::size_t... I>
+inline Result generate(Tuple& tup, Op&& op, std::index_sequence<I...>)
 {
-    static_assert(std::tuple_size<Tup> == sizeof...(I));
+    static_assert(std::tuple_size_v<std::remove_const_t<Tuple>>
+                  == sizeof...(I));
 
-    return std::make_tuple((op(zip_iter.std::get<I>())...));
+    using std::get;
+    return Result(op(get<I>(tup))...);
 }
 
-template<typename Tuple1, typename Tuple2, typename Op, std::size_t I>
-bool allOf_impl(const Tuple1& tup1, const Tuple2& tup2, Op&& op)
+//---------------------------------------------------------------------------//
+// Test whether a binary predicate holds for all pairs of tuple elements
+template<typename Tuple1, typename Tuple2, typename Op, std::size_t... I>
+inline bool allOf(const Tuple1& tup1,
+                  const Tuple2& tup2,
+                  Op&& op,
+                  std::index_sequence<I...>)
 {
     static_assert(std::tuple_size_v<Tuple1> == std::tuple_size_v<Tuple2>);
-    if constexpr (I == std::tuple_size_v<Tuple1>)
-    {
-        return true;
-    }
-    else
-    {
-        return op(std::get<I>(tup1), std::get<I>(tup2))
-               && allOf_impl<I + 1>(tup1, tup2, std::forward<Op>(op));
-    }
+
+    return (op(std::get<I>(tup1), std::get<I>(tup2)) && ...);
 }
 
-template<typename Tuple1, typename Tuple2, typename Op>
-bool allOf(const Tuple1& tup1, const Tuple2& tup2, Op&& op)
+//---------------------------------------------------------------------------//
+// Construct a Result of rvalue references from the elements of a tuple of
+// references
+template<typename Result, typename Tuple, std::size_t... I>
+inline Result moveElements(Tuple& tup, std::index_sequence<I...>)
 {
-    static_assert(std::tuple_size_v<Tuple1> == std::tuple_size_v<Tuple2>);
-
-    // Get result for first element
-    bool result = op(std::get<0>(tup1), std::get<0>(tup2));
-    return result && allOf_impl<1>(tup1, tup2, std::forward<Op>(op), result);
+    return Result(
+        static_cast<std::tuple_element_t<I, Result>>(std::get<I>(tup))...);
 }
 
 //---------------------------------------------------------------------------//
-}  // namespace
+}  // namespace detail
 
 //---------------------------------------------------------------------------//
 // CONSTRUCTOR
@@ -267,41 +348,23 @@ bool allOf(const Tuple1& tup1, const Tuple2& tup2, Op&& op)
  * \param[in] other_iter1  The first iterator to use for construction
  * \param[in] other_iters  The remaining iterators to use for construction
  */
-template<typename Iterator, typename... Iterators>
-template<typename OtherIterator1, typename... OtherIterators>
+template<typename Iterator1, typename... Iterators>
+template<typename OtherIterator1,
+         typename... OtherIterators,
+         std::enable_if_t<detail::is_zip_constructible_v<
+                              std::tuple<Iterator1, Iterators...>,
+                              OtherIterator1,
+                              OtherIterators...>,
+                          bool>>
 ZipIterator<Iterator1, Iterators...>::ZipIterator(
-    OtherIterator1&& other_iter1, OtherIterators...&& other_iters)
-    : m_iterators(std::forward<OtherIterator1>(other_iter1),
-                  std::forward<OtherIterators...>(other_iters...))
+    OtherIterator1&& other_iter1, OtherIterators&&... other_iters)
+    : m_data{{std::in_place,
+               std::forward<OtherIterator1>(other_iter1),
+               std::forward<OtherIterators>(other_iters)...}}
 {
     /* * */
 }
 
-//---------------------------------------------------------------------------//
-// COPY OPERATOR
-//---------------------------------------------------------------------------//
-/*!
- * \brief Copy from multiple iterators
- *
- * \tparam OtherIterator1  An iterator type convertible to Iterator1
- * \tparam OtherIterators  Parameter pack containing iterators convertible to
- *                         Iterators
- *
- * \param[in] other_iter1  The first iterator to copy
- * \param[in] other_iters  The remaining iterators to copy
- *
- * \return A reference to this ZipIterator
- */
-template<typename Iterator, typename... Iterators>
-template<typename OtherIterator1, typename... OtherIterators>
-auto ZipIterator<Iterator, Iterators...>::operator=(
-    OtherIterator1&& other_iter1, OtherIterators...&& other_iters) -> This&
-{
-    m_iterators = {std::forward<OtherIterator1>(other_iter1),
-                   std::forward<OtherIterators...>(other_iters)};
-    return *this;
-}
-
 //---------------------------------------------------------------------------//
 // INCREMENT
 //---------------------------------------------------------------------------//
@@ -313,10 +376,15 @@ auto ZipIterator<Iterator, Iterators...>::operator=(
 template<typename Iterator1, typename... Iterators>
 auto ZipIterator<Iterator1, Iterators...>::operator++() -> This&
 {
-    forEach(
-        m_iterators,
-        [](auto& v) { ++v; },
-        std::index_sequence_for<Iterator1, Iterators...>());
+    if constexpr (is_indexed)
+    {
+        ++m_data.index;
+    }
+    else
+    {
+        detail::forEach(
+            m_data.iterators, [](auto& v) { ++v; }, Indices_t());
+    }
     return *this;
 }
 
@@ -345,12 +413,17 @@ auto ZipIterator<Iterator1, Iterators...>::operator++(int) -> This
 template<typename Iterator1, typename... Iterators>
 auto ZipIterator<Iterator1, Iterators...>::operator--() -> This&
 {
-    static_assert(itertools::detail::is_bidir_zip_iter_v<This>);
+    static_assert(detail::is_bidir_zip_iter_v<This>);
 
-    forEach(
-        m_iterators,
-        [](auto& v) { --v; },
-        std::index_sequence_for<Iterator1, Iterators...>());
+    if constexpr (is_indexed)
+    {
+        --m_data.index;
+    }
+    else
+    {
+        detail::forEach(
+            m_data.iterators, [](auto& v) { --v; }, Indices_t());
+    }
     return *this;
 }
 
@@ -363,7 +436,7 @@ auto ZipIterator<Iterator1, Iterators...>::operator--() -> This&
 template<typename Iterator1, typename... Iterators>
 auto ZipIterator<Iterator1, Iterators...>::operator--(int) -> This
 {
-    static_assert(itertools::detail::is_bidir_zip_iter_v<This>);
+    static_assert(detail::is_bidir_zip_iter_v<This>);
 
     This copy = *this;
     --(*this);
@@ -371,118 +444,276 @@ auto ZipIterator<Iterator1, Iterators...>::operator--(int) -> This
 }
 
 //---------------------------------------------------------------------------//
-// DEREFERENCE, POINTER, INDEX
-//---------------------------------------------------------------------------//
-template<typename Iterator1, typename... Iterators>
-auto ZipIterator<Iterator1, Iterators...>::operator*() -> reference
-{
-    return apply(
-        m_iterators,
-        [](auto& v) { return *v; },
-        std::index_sequence_for<Iterator1, Iterators...>());
-}
-
+// DEREFERENCE, INDEX
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Dereference all of the underlying iterators
+ *
+ * \return A tuple of the references of the underlying iterators
+ */
 template<typename Iterator1, typename... Iterators>
-auto ZipIterator<Iterator1, Iterators...>::operator->() -> pointer
+auto ZipIterator<Iterator1, Iterators...>::operator*() const -> reference
 {
-    return apply(
-        m_iterators,
-        [](auto& v) { return &(*v); },
-        std::index_sequence_for<Iterator1, Iterators...>());
+    if constexpr (is_indexed)
+    {
+        return (*this)[0];
+    }
+    else
+    {
+        return detail::generate<reference>(
+            m_data.iterators,
+            [](const auto& v) -> decltype(auto) { return *v; },
+            Indices_t());
+    }
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Index all of the underlying iterators
+ *
+ * \param[in] n  The offset from the current position
+ *
+ * \return A tuple of the references of the underlying iterators at offset
+ *         \p n
+ */
 template<typename Iterator1, typename... Iterators>
-auto ZipIterator<Iterator1, Iterators...>::operator[](difference_type n)
+auto ZipIterator<Iterator1, Iterators...>::operator[](difference_type n) const
     -> reference
 {
-    static_assert(itertools::detail::is_random_access_zip_iter_v<This>);
+    static_assert(detail::is_random_access_zip_iter_v<This>);
 
-    return apply(
-        m_iterators,
-        [n](auto& v) { return v[n] l },
-        std::index_sequence_for<Iterator1, Iterators...>());
+    if constexpr (is_indexed)
+    {
+        n += m_data.index;
+    }
+    return detail::generate<reference>(
+        m_data.iterators,
+        [n](const auto& v) -> decltype(auto) { return v[n]; },
+        Indices_t());
 }
 
 //---------------------------------------------------------------------------//
+// COMPOUND ARITHMETIC
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance all of the underlying iterators by \p n
+ *
+ * \param[in] n  The offset to advance by
+ *
+ * \return A reference to this ZipIterator
+ */
 template<typename Iterator1, typename... Iterators>
 auto ZipIterator<Iterator1, Iterators...>::operator+=(difference_type n)
     -> This&
 {
-    static_assert(is_random_access_zip_iter_v<This>);
+    static_assert(detail::is_random_access_zip_iter_v<This>);
 
-    forEach(
-        m_iterators,
-        [n](auto& v) { v += n },
-        std::index_sequence_for<Iterator1, Iterators...>());
+    if constexpr (is_indexed)
+    {
+        m_data.index += n;
+    }
+    else
+    {
+        detail::forEach(
+            m_data.iterators, [n](auto& v) { v += n; }, Indices_t());
+    }
     return *this;
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Move all of the underlying iterators back by \p n
+ *
+ * \param[in] n  The offset to move back by
+ *
+ * \return A reference to this ZipIterator
+ */
 template<typename Iterator1, typename... Iterators>
 auto ZipIterator<Iterator1, Iterators...>::operator-=(difference_type n)
     -> This&
 {
-    static_assert(
-        std::is_base_of_v<std::random_access_iterator_tag, iterator_category>);
+    static_assert(detail::is_random_access_zip_iter_v<This>);
 
-    auto op = [n](auto& v) { v -= n; };
-    forEach(m_iterators,
-            std::move(op),
-            std::index_sequence_for<Iterator1, Iterators...>());
+    if constexpr (is_indexed)
+    {
+        m_data.index -= n;
+    }
+    else
+    {
+        detail::forEach(
+            m_data.iterators, [n](auto& v) { v -= n; }, Indices_t());
+    }
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+// ACCESSORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Access a particular underlying iterator for modification
+ *
+ * Iterators sharing an index are first moved to the current position, so
+ * modifying the returned iterator only moves stream \p I.
+ *
+ * \tparam I  The index of the underlying iterator
+ *
+ * \return A reference to the underlying iterator
+ */
+template<typename Iterator1, typename... Iterators>
+template<std::size_t I>
+auto ZipIterator<Iterator1, Iterators...>::get()
+    -> std::tuple_element_t<I, Storage_t>&
+{
+    rebase();
+    return detail::get<I>(m_data.iterators);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get a particular underlying iterator
+ *
+ * \tparam I  The index of the underlying iterator
+ *
+ * \return A copy of the underlying iterator at the current position
+ */
+template<typename Iterator1, typename... Iterators>
+template<std::size_t I>
+auto ZipIterator<Iterator1, Iterators...>::get() const
+    -> std::tuple_element_t<I, Storage_t>
+{
+    if constexpr (is_indexed)
+    {
+        return detail::get<I>(m_data.iterators) + m_data.index;
+    }
+    else
+    {
+        return detail::get<I>(m_data.iterators);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Access the entire tuple of iterators for modification
+ *
+ * \return A tuple of references to the underlying iterators at the current
+ *         position
+ */
+template<typename Iterator1, typename... Iterators>
+auto ZipIterator<Iterator1, Iterators...>::getIters()
+    -> std::tuple<Iterator1&, Iterators&...>
+{
+    rebase();
+    return detail::generate<std::tuple<Iterator1&, Iterators&...>>(
+        m_data.iterators, [](auto& v) -> auto& { return v; }, Indices_t());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the entire tuple of iterators
+ *
+ * \return A copy of the underlying iterators at the current position
+ */
+template<typename Iterator1, typename... Iterators>
+auto ZipIterator<Iterator1, Iterators...>::getIters() const -> Storage_t
+{
+    if constexpr (is_indexed)
+    {
+        return detail::generate<Storage_t>(
+            m_data.iterators,
+            [n = m_data.index](const auto& v) { return v + n; },
+            Indices_t());
+    }
+    else
+    {
+        return detail::generate<Storage_t>(
+            m_data.iterators, [](const auto& v) { return v; }, Indices_t());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move the underlying iterators to the shared index
+ *
+ * Afterwards the iterators hold the current position and the index is zero.
+ */
+template<typename Iterator1, typename... Iterators>
+void ZipIterator<Iterator1, Iterators...>::rebase()
+{
+    if constexpr (is_indexed)
+    {
+        detail::forEach(
+            m_data.iterators, [n = m_data.index](auto& v) { v += n; },
+            Indices_t());
+        m_data.index = 0;
+    }
+}
+
 //---------------------------------------------------------------------------//
 // ARITHMETIC OPERATORS
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Sum an iterator and an integral value
+ *
+ * \param[in] zip_iter  The zip iterator
+ * \param[in] n         The offset
+ *
+ * \return A zip iterator advanced by \p n
+ */
 template<typename Iterator1, typename... Iterators>
 ZipIterator<Iterator1, Iterators...>
 operator+(const ZipIterator<Iterator1, Iterators...>& zip_iter,
           typename ZipIterator<Iterator1, Iterators...>::difference_type n)
 {
-    static_assert(
-        std::is_base_of_v<
-            std::random_access_iterator_tag,
-            typename ZipIterator<Iterator1, Iterators...>::iterator_category>);
-
-    auto op = [n](auto& v) { return v + n; };
-    return ZipIterator(
-        apply(zip_iter,
-              std::move(op),
-              std::index_sequence_for<Iterator1, Iterators...>()));
+    ZipIterator<Iterator1, Iterators...> result(zip_iter);
+    result += n;
+    return result;
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Sum an integral value and an iterator
+ *
+ * \param[in] n         The offset
+ * \param[in] zip_iter  The zip iterator
+ *
+ * \return A zip iterator advanced by \p n
+ */
 template<typename Iterator1, typename... Iterators>
 ZipIterator<Iterator1, Iterators...>
 operator+(typename ZipIterator<Iterator1, Iterators...>::difference_type n,
           const ZipIterator<Iterator1, Iterators...>& zip_iter)
 {
-    static_assert(
-        std::is_base_of_v<
-            std::random_access_iterator_tag,
-            typename ZipIterator<Iterator1, Iterators...>::iterator_category>);
-
     return zip_iter + n;
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Subtract an integral value from an iterator
+ *
+ * \param[in] zip_iter  The zip iterator
+ * \param[in] n         The offset
+ *
+ * \return A zip iterator moved back by \p n
+ */
 template<typename Iterator1, typename... Iterators>
 ZipIterator<Iterator1, Iterators...>
 operator-(const ZipIterator<Iterator1, Iterators...>& zip_iter,
           typename ZipIterator<Iterator1, Iterators...>::difference_type n)
 {
-    static_assert(
-        std::is_base_of_v<
-            std::random_access_iterator_tag,
-            typename ZipIterator<Iterator1, Iterators...>::iterator_category>);
-
-    return zip_iter + (-n);
+    ZipIterator<Iterator1, Iterators...> result(zip_iter);
+    result -= n;
+    return result;
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the distance between two zip iterators
+ *
+ * \param[in] zip_iter1  The ending zip iterator
+ * \param[in] zip_iter2  The beginning zip iterator
+ *
+ * \return The distance from \p zip_iter2 to \p zip_iter1
+ */
 template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
@@ -491,19 +722,30 @@ auto operator-(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
                const ZipIterator<OtherIterator1, OtherIterators...>& zip_iter2)
     -> std::common_type_t<
         typename ZipIterator<Iterator1, Iterators...>::difference_type,
-        typename zipIterator<OtherIterator1, OtherIterators...>::difference_type>
+        typename ZipIterator<OtherIterator1,
+                             OtherIterators...>::difference_type>
 {
-    static_assert(
-        std::is_base_of_v<
-            std::random_access_iterator_tag,
-            typename ZipIterator<Iterator1, Iterators...>::iterator_category>);
+    static_assert(sizeof...(Iterators) == sizeof...(OtherIterators));
+    static_assert(detail::is_random_access_zip_iter_v<
+                  ZipIterator<Iterator1, Iterators...>>);
 
-    return zip_iter1.get<0>() - zip_iter2.get<0>();
+    return zip_iter1.template get<0>() - zip_iter2.template get<0>();
 }
 
 //---------------------------------------------------------------------------//
 // BOOLEAN OPERATORS
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Test equality between two zip iterators
+ *
+ * Only the first underlying iterators are compared; all underlying iterators
+ * are required to agree under DBC.
+ *
+ * \param[in] zip_iter1  The first zip iterator
+ * \param[in] zip_iter2  The second zip iterator
+ *
+ * \return True if the iterators point to the same position
+ */
 template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
@@ -511,17 +753,28 @@ template<typename Iterator1,
 bool operator==(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
                 const ZipIterator<OtherIterator1, OtherIterators...>& zip_iter2)
 {
-    static_assert(sizeof...(Iterator1, Iterators...)
-                  == sizeof...(OtherIterator1, OtherIterators...));
-
-    bool result = (zip_iter1.get<0>() == zip_iter2.get<0>());
-    IM_ENSURE(result == allOf(zip_iter1, zip_iter2, [](auto v, auto w) {
-                  return v == w;
-              }));
+    static_assert(sizeof...(Iterators) == sizeof...(OtherIterators));
+
+    const bool result = (zip_iter1.template get<0>()
+                         == zip_iter2.template get<0>());
+    IT_ENSURE(!result
+              || detail::allOf(
+                  zip_iter1.getIters(),
+                  zip_iter2.getIters(),
+                  [](const auto& v, const auto& w) { return v == w; },
+                  std::index_sequence_for<Iterator1, Iterators...>()));
     return result;
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Test inequality between two zip iterators
+ *
+ * \param[in] zip_iter1  The first zip iterator
+ * \param[in] zip_iter2  The second zip iterator
+ *
+ * \return True if the iterators point to different positions
+ */
 template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
@@ -529,10 +782,18 @@ template<typename Iterator1,
 bool operator!=(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
                 const ZipIterator<OtherIterator1, OtherIterators...>& zip_iter2)
 {
-    return !operator==(zip_iter1, zip_iter2);
+    return !(zip_iter1 == zip_iter2);
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Test if \p zip_iter1 is less than \p zip_iter2
+ *
+ * \param[in] zip_iter1  The first zip iterator
+ * \param[in] zip_iter2  The second zip iterator
+ *
+ * \return True if \p zip_iter1 precedes \p zip_iter2
+ */
 template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
@@ -540,17 +801,28 @@ template<typename Iterator1,
 bool operator<(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
                const ZipIterator<OtherIterator1, OtherIterators...>& zip_iter2)
 {
-    static_assert(sizeof...(Iterator1, Iterators...)
-                  == sizeof...(OtherIterator1, OtherIterators...));
-
-    bool result = (zip_iter1.get<0>() < zip_iter2.get<0>());
-    IM_ENSURE(result == allOf(zip_iter1, zip_iter2, [](auto v, auto w) {
-                  return v < w;
-              }));
+    static_assert(sizeof...(Iterators) == sizeof...(OtherIterators));
+
+    const bool result = (zip_iter1.template get<0>()
+                         < zip_iter2.template get<0>());
+    IT_ENSURE(!result
+              || detail::allOf(
+                  zip_iter1.getIters(),
+                  zip_iter2.getIters(),
+                  [](const auto& v, const auto& w) { return v < w; },
+                  std::index_sequence_for<Iterator1, Iterators...>()));
     return result;
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Test if \p zip_iter1 is less than or equal to \p zip_iter2
+ *
+ * \param[in] zip_iter1  The first zip iterator
+ * \param[in] zip_iter2  The second zip iterator
+ *
+ * \return True if \p zip_iter1 does not follow \p zip_iter2
+ */
 template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
@@ -558,12 +830,18 @@ template<typename Iterator1,
 bool operator<=(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
                 const ZipIterator<OtherIterator1, OtherIterators...>& zip_iter2)
 {
-    static_assert(sizeof...(Iterator1, Iterators...)
-                  == sizeof...(OtherIterator1, OtherIterators...));
-    return zip_iter1 < zip_iter2 || zip_iter1 == zip_iter2;
+    return !(zip_iter2 < zip_iter1);
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Test if \p zip_iter1 is greater than \p zip_iter2
+ *
+ * \param[in] zip_iter1  The first zip iterator
+ * \param[in] zip_iter2  The second zip iterator
+ *
+ * \return True if \p zip_iter1 follows \p zip_iter2
+ */
 template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
@@ -571,12 +849,18 @@ template<typename Iterator1,
 bool operator>(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
                const ZipIterator<OtherIterator1, OtherIterators...>& zip_iter2)
 {
-    static_assert(sizeof...(Iterator1, Iterators...)
-                  == sizeof...(OtherIterator1, OtherIterators...));
-    return !(zip_iter1 <= zip_iter2);
+    return zip_iter2 < zip_iter1;
 }
 
 //---------------------------------------------------------------------------//
+/*!
+ * \brief Test if \p zip_iter1 is greater than or equal to \p zip_iter2
+ *
+ * \param[in] zip_iter1  The first zip iterator
+ * \param[in] zip_iter2  The second zip iterator
+ *
+ * \return True if \p zip_iter1 does not precede \p zip_iter2
+ */
 template<typename Iterator1,
          typename OtherIterator1,
          typename... Iterators,
@@ -584,11 +868,66 @@ template<typename Iterator1,
 bool operator>=(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
                 const ZipIterator<OtherIterator1, OtherIterators...>& zip_iter2)
 {
-    static_assert(sizeof...(Iterator1, Iterators...)
-                  == sizeof...(OtherIterator1, OtherIterators...));
     return !(zip_iter1 < zip_iter2);
 }
 
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Create a zip iterator from multiple iterators
+ *
+ * \param[in] iter1  The first iterator
+ * \param[in] iters  The remaining iterators
+ *
+ * \return A zip iterator over copies of the iterators
+ */
+template<typename Iterator1, typename... Iterators>
+ZipIterator<std::decay_t<Iterator1>, std::decay_t<Iterators>...>
+makeZipIter(Iterator1&& iter1, Iterators&&... iters)
+{
+    return ZipIterator<std::decay_t<Iterator1>, std::decay_t<Iterators>...>(
+        std::forward<Iterator1>(iter1), std::forward<Iterators>(iters)...);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Swap the elements pointed to by two zip iterators
+ *
+ * Found by argument-dependent lookup from \c std::iter_swap and the standard
+ * algorithms, this swaps the elements of every stream rather than the
+ * references returned by dereferencing.
+ *
+ * \param[in] zip_iter1  The first zip iterator
+ * \param[in] zip_iter2  The second zip iterator
+ */
+template<typename Iterator1, typename... Iterators>
+void iter_swap(const ZipIterator<Iterator1, Iterators...>& zip_iter1,
+               const ZipIterator<Iterator1, Iterators...>& zip_iter2)
+{
+    swap(*zip_iter1, *zip_iter2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Cast the elements pointed to by a zip iterator to rvalues
+ *
+ * \param[in] zip_iter  The zip iterator
+ *
+ * \return A tuple of rvalue references to the elements of every stream
+ */
+template<typename Iterator1, typename... Iterators>
+typename ZipIterator<Iterator1, Iterators...>::rvalue_reference
+iter_move(const ZipIterator<Iterator1, Iterators...>& zip_iter)
+{
+    using Result_t =
+        typename ZipIterator<Iterator1, Iterators...>::rvalue_reference;
+
+    auto ref = *zip_iter;
+    return detail::moveElements<Result_t>(
+        ref, std::index_sequence_for<Iterator1, Iterators...>());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace itertools
 
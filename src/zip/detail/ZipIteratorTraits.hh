@@ -10,75 +10,115 @@
 
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ZipReference.hh"
 
 namespace itertools
 {
 namespace detail
 {
+//===========================================================================//
+/*!
+ * \struct ZipIteratorTraits
+ * \brief Iterator traits of a zip over the iterators \c Iterators
+ *
+ * The value type is a tuple of the value types of the underlying iterators,
+ * and the reference type is a ZipReference over their reference types.  The
+ * iterator category is the weakest category of the underlying iterators, and
+ * the difference type is their common difference type.  The rvalue reference
+ * type, returned by iter_move(), is a tuple of rvalue references to the
+ * elements (or of the values of iterators that return them by value).
+ */
+//===========================================================================//
 
-template<typename...>
+template<typename... Iterators>
 struct ZipIteratorTraits
 {
-    /* not used */
+    static_assert(sizeof...(Iterators) > 0);
+
+    using difference_type = std::common_type_t<
+        typename std::iterator_traits<Iterators>::difference_type...>;
+    using reference = ZipReference<
+        typename std::iterator_traits<Iterators>::reference...>;
+    using rvalue_reference
+        = std::tuple<std::conditional_t<
+            std::is_reference_v<
+                typename std::iterator_traits<Iterators>::reference>,
+            std::remove_reference_t<
+                typename std::iterator_traits<Iterators>::reference>&&,
+            typename std::iterator_traits<Iterators>::reference>...>;
+    using pointer = void;
+    using value_type
+        = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+    using iterator_category = std::common_type_t<
+        typename std::iterator_traits<Iterators>::iterator_category...>;
 };
 
-template<typename Iterator>
-struct ZipIteratorTraits
+//---------------------------------------------------------------------------//
+// Whether a tuple of iterators is constructed element-wise from the arguments
+template<typename Storage, typename... Args>
+struct is_zip_constructible
+    : public std::conjunction<
+          std::bool_constant<std::tuple_size_v<Storage> == sizeof...(Args)>,
+          std::is_constructible<Storage, Args&&...>>
 {
-    using difference_type =
-        typename std::iterator_traits<Iterator>::difference_type;
-    using reference = typename std::iterator_traits<Iterator>::reference;
-    using pointer = typename std::iterator_traits<Iterator>::pointer;
-    using value_type = typename std::iterator_traits<Iterator>::value_type;
-    using iterator_category =
-        typename std::iterator_traits<Iterator>::iterator_category
 };
+template<typename Storage, typename... Args>
+constexpr bool is_zip_constructible_v
+    = is_zip_constructible<Storage, Args...>::value;
 
-template<typename Iterator1, typename Iterator2>
-struct ZipIteratorTraits
+//---------------------------------------------------------------------------//
+// Whether an iterator addresses contiguous storage
+template<typename Iterator>
+struct is_contiguous_iterator
+#if defined(__cpp_lib_concepts)
+    : public std::bool_constant<std::contiguous_iterator<Iterator>>
+#else
+    : public std::is_pointer<Iterator>
+#endif
 {
-    using difference_type = std::common_type_t<
-        typename std::iterator_traits<Iterator1>::difference_type,
-        typename std::iterator_traits<Iterator2>::difference_type>;
-    using reference
-        = std::tuple<typename std::iterator_traits<Iterator1>::reference,
-                     typename std::iterator_traits<Iterator2>::reference>;
-    using pointer
-        = std::tuple<typename std::iterator_traits<Iterator1>::pointer,
-                     typename std::iterator_traits<Iterator2>::pointer>;
-    using value_type
-        = std::tuple<typename std::iterator_traits<Iterator1>::value_type,
-                     typename std::iterator_traits<Iterator2>::value_type>;
-    using iterator_category = std::common_type_t<
-        typename std::iterator_traits<Iterator1>::iterator_category,
-        typename std::iterator_traits<Iterator2>::iterator_category>;
 };
-
-template<typename Iterator1, typename... Iterators>
-struct ZipIteratorTraits
+#if !defined(__cpp_lib_concepts) && defined(__GLIBCXX__)
+template<typename T, typename Container>
+struct is_contiguous_iterator<__gnu_cxx::__normal_iterator<T*, Container>>
+    : public std::true_type
+{
+};
+#elif !defined(__cpp_lib_concepts) && defined(_LIBCPP_VERSION)
+template<typename T>
+struct is_contiguous_iterator<std::__wrap_iter<T*>> : public std::true_type
 {
-  private:
-    using ref1
-        = std::tuple<typename std::iterator_traits<Iterator1>::reference>;
-    using refs = typename ZipIteratorTraits<Iterators...>::reference;
-    using ptr1 = std::tuple<typename std::iterator_traits<Iterator1>::pointer>;
-    using ptrs = typename ZipIteratorTraits<Iterators...>::pointer;
-    using vt1
-        = std::tuple<typename std::iterator_traits<Iterator1>::value_type>;
-    using vts = typename ZipIteratorTraits<Iterators...>::value_type;
+};
+#endif
+template<typename Iterator>
+constexpr bool is_contiguous_iterator_v
+    = is_contiguous_iterator<Iterator>::value;
 
-  public:
-    using difference_type = std::common_type_t<
-        typename std::iterator_traits<Iterator1>::difference_type,
-        typename ZipIteratorTraits<Iterators...>::difference_type>;
-    using reference
-        = decltype(std::tuple_cat(declval<ref1>(), declval<refs>()));
-    using pointer = decltype(std::tuple_cat(declval<ptr1>(), declval<ptrs>());
-    using value_type = decltype(std::tuple_cat(declval<vt1>(), declval<vts>()));
-    using iterator_category = std::common_type_t<typename std::iterator_traits<Iterator1>::iterator_category,
-    typename ZipIteratorTraits<Iterators...>::iterator_category>;
+//---------------------------------------------------------------------------//
+// Iterator and sentinel types of a range
+template<typename Range>
+using range_iterator_t = decltype(std::begin(std::declval<Range&>()));
+template<typename Range>
+using range_sentinel_t = decltype(std::end(std::declval<Range&>()));
+
+//---------------------------------------------------------------------------//
+// Whether the size of a range is known without iterating over it
+template<typename Range, typename = void>
+struct is_sized_range : public std::false_type
+{
 };
+template<typename Range>
+struct is_sized_range<Range,
+                      std::void_t<decltype(std::size(std::declval<Range&>()))>>
+    : public std::true_type
+{
+};
+template<typename Range>
+constexpr bool is_sized_range_v = is_sized_range<Range>::value;
 
+//---------------------------------------------------------------------------//
 template<class ZipIterator>
 struct is_bidir_zip_iter
     : public std::is_base_of<std::bidirectional_iterator_tag,
@@ -88,6 +128,7 @@ struct is_bidir_zip_iter
 template<class ZipIterator>
 constexpr bool is_bidir_zip_iter_v = is_bidir_zip_iter<ZipIterator>::value;
 
+//---------------------------------------------------------------------------//
 template<class ZipIterator>
 struct is_random_access_zip_iter
     : public std::is_base_of<std::random_access_iterator_tag,
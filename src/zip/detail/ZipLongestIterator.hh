@@ -0,0 +1,301 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/ZipLongestIterator.hh
+ * \brief  ZipLongestIterator class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_ZIPLONGESTITERATOR_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_ZIPLONGESTITERATOR_HH
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+#include "core/DBC.hh"
+#include "ZipStorage.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class ZipLongestIterator
+ * \brief Iterates over several sequences in lockstep until all of them end
+ *
+ * The iterator stores the current and ending iterators of every sequence.
+ * Sequences that reached their ending stay there, and their elements are
+ * replaced by a fill value converted to their value type.  Dereferencing
+ * therefore yields a tuple of values rather than references.
+ *
+ * Two iterators over the same sequences are equal when all of their
+ * underlying iterators are, so the iteration stops after the longest
+ * sequence.
+ *
+ * \example zip/tests/tstZip.cc
+ */
+//===========================================================================//
+
+template<typename Fill, typename... Iterators>
+class ZipLongestIterator
+{
+  public:
+    //! Public type aliases
+    using difference_type = std::ptrdiff_t;
+    using value_type
+        = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+    using reference = value_type;
+    using pointer = void;
+    using iterator_category = std::forward_iterator_tag;
+    using This = ZipLongestIterator<Fill, Iterators...>;
+
+  private:
+    // Index sequence over the underlying iterators
+    using Indices_t = std::index_sequence_for<Iterators...>;
+
+  public:
+    // Default constructor
+    ZipLongestIterator() = default;
+
+    // Construct with the current and ending iterators and the fill value
+    inline ZipLongestIterator(IteratorPack<Iterators...> iters,
+                              IteratorPack<Iterators...> ends,
+                              Fill fill);
+
+    // >>> INCREMENT
+    // Pre-increment operator
+    inline This& operator++();
+
+    // Post-increment operator
+    inline This operator++(int);
+
+    // >>> DEREFERENCE
+    // Dereference the underlying iterators
+    inline reference operator*() const;
+
+    // >>> COMPARISON
+    // Test whether all underlying iterators are equal
+    inline bool equals(const This& other) const;
+
+  private:
+    // Advance the sequences I... that did not end
+    template<std::size_t... I>
+    inline void increment(std::index_sequence<I...>);
+
+    // Dereference the sequences I...
+    template<std::size_t... I>
+    inline reference dereference(std::index_sequence<I...>) const;
+
+    // Compare the sequences I...
+    template<std::size_t... I>
+    inline bool equals(const This& other, std::index_sequence<I...>) const;
+
+    // >>> DATA
+    //! Stores the current iterators
+    IteratorPack<Iterators...> m_iters;
+
+    //! Stores the ending iterators
+    IteratorPack<Iterators...> m_ends;
+
+    //! Stores the value of the ended sequences
+    Fill m_fill;
+};
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+// Test equality between two iterators
+template<typename Fill, typename... Iterators>
+inline bool operator==(const ZipLongestIterator<Fill, Iterators...>& iter1,
+                       const ZipLongestIterator<Fill, Iterators...>& iter2);
+
+// Test inequality between two iterators
+template<typename Fill, typename... Iterators>
+inline bool operator!=(const ZipLongestIterator<Fill, Iterators...>& iter1,
+                       const ZipLongestIterator<Fill, Iterators...>& iter2);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct with the current and ending iterators and the fill value
+ *
+ * \param[in] iters  The current iterators
+ * \param[in] ends   The ending iterators
+ * \param[in] fill   The value of the sequences that ended
+ */
+template<typename Fill, typename... Iterators>
+ZipLongestIterator<Fill, Iterators...>::ZipLongestIterator(
+    IteratorPack<Iterators...> iters,
+    IteratorPack<Iterators...> ends,
+    Fill fill)
+    : m_iters(std::move(iters))
+    , m_ends(std::move(ends))
+    , m_fill(std::move(fill))
+{
+    /* * */
+}
+
+//---------------------------------------------------------------------------//
+// INCREMENT
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pre-increment operator advancing the sequences that did not end
+ *
+ * \return A reference to this iterator after the increment is performed
+ */
+template<typename Fill, typename... Iterators>
+auto ZipLongestIterator<Fill, Iterators...>::operator++() -> This&
+{
+    IT_REQUIRE(!this->equals(This(m_ends, m_ends, m_fill)));
+
+    this->increment(Indices_t());
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Post-increment operator advancing the sequences that did not end
+ *
+ * \return A copy of this iterator before the increment is performed
+ */
+template<typename Fill, typename... Iterators>
+auto ZipLongestIterator<Fill, Iterators...>::operator++(int) -> This
+{
+    This copy = *this;
+    ++(*this);
+    return copy;
+}
+
+//---------------------------------------------------------------------------//
+// DEREFERENCE
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Dereference the underlying iterators
+ *
+ * \return A tuple of the current values, with the fill value standing in
+ *         for the sequences that ended
+ */
+template<typename Fill, typename... Iterators>
+auto ZipLongestIterator<Fill, Iterators...>::operator*() const -> reference
+{
+    return this->dereference(Indices_t());
+}
+
+//---------------------------------------------------------------------------//
+// COMPARISON
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test whether all underlying iterators are equal
+ *
+ * \param[in] other  The iterator to compare with
+ *
+ * \return True if the iterators point to the same position
+ */
+template<typename Fill, typename... Iterators>
+bool ZipLongestIterator<Fill, Iterators...>::equals(const This& other) const
+{
+    return this->equals(other, Indices_t());
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Advance the sequences \c I... that did not end
+ */
+template<typename Fill, typename... Iterators>
+template<std::size_t... I>
+void ZipLongestIterator<Fill, Iterators...>::increment(
+    std::index_sequence<I...>)
+{
+    auto advance = [](auto& iter, const auto& end) {
+        if (iter != end)
+        {
+            ++iter;
+        }
+    };
+    (advance(get<I>(m_iters), get<I>(m_ends)), ...);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Dereference the sequences \c I...
+ *
+ * \return A tuple of the current values
+ */
+template<typename Fill, typename... Iterators>
+template<std::size_t... I>
+auto ZipLongestIterator<Fill, Iterators...>::dereference(
+    std::index_sequence<I...>) const -> reference
+{
+    return reference(
+        (get<I>(m_iters) != get<I>(m_ends)
+             ? static_cast<std::tuple_element_t<I, value_type>>(
+                 *get<I>(m_iters))
+             : static_cast<std::tuple_element_t<I, value_type>>(m_fill))...);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compare the sequences \c I...
+ *
+ * \param[in] other  The iterator to compare with
+ *
+ * \return True if all underlying iterators are equal
+ */
+template<typename Fill, typename... Iterators>
+template<std::size_t... I>
+bool ZipLongestIterator<Fill, Iterators...>::equals(
+    const This& other, std::index_sequence<I...>) const
+{
+    return ((get<I>(m_iters) == get<I>(other.m_iters)) && ...);
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test equality between two iterators
+ *
+ * \param[in] iter1  The first iterator
+ * \param[in] iter2  The second iterator
+ *
+ * \return True if the iterators point to the same position
+ */
+template<typename Fill, typename... Iterators>
+bool operator==(const ZipLongestIterator<Fill, Iterators...>& iter1,
+                const ZipLongestIterator<Fill, Iterators...>& iter2)
+{
+    return iter1.equals(iter2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test inequality between two iterators
+ *
+ * \param[in] iter1  The first iterator
+ * \param[in] iter2  The second iterator
+ *
+ * \return True if the iterators point to different positions
+ */
+template<typename Fill, typename... Iterators>
+bool operator!=(const ZipLongestIterator<Fill, Iterators...>& iter1,
+                const ZipLongestIterator<Fill, Iterators...>& iter2)
+{
+    return !iter1.equals(iter2);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_ZIPLONGESTITERATOR_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/ZipLongestIterator.hh
+//---------------------------------------------------------------------------//
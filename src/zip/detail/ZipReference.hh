@@ -0,0 +1,285 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/ZipReference.hh
+ * \brief  ZipReference class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_ZIPREFERENCE_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_ZIPREFERENCE_HH
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace itertools
+{
+//===========================================================================//
+/*!
+ * \class ZipReference
+ * \brief Proxy reference to the elements of zipped sequences
+ *
+ * A zip reference is a tuple of the references of the underlying iterators
+ * that behaves as a reference to the tuple of their values:
+ *
+ * - assigning to it, from another zip reference or from a tuple of values,
+ *   assigns to the referenced elements;
+ * - swapping two zip references swaps the referenced elements, whether the
+ *   references are lvalues or temporaries returned by dereferencing;
+ * - the value type of the zip, a tuple of values, is constructed from it;
+ * - an rvalue zip reference, e.g., <tt>std::move(*iter)</tt>, is moved from
+ *   when assigned to another zip reference or converted to a tuple of
+ *   values, as an element of a container is.
+ *
+ * Together, these let the standard algorithms that permute elements (e.g.,
+ * \c std::sort, \c std::stable_sort, \c std::nth_element and
+ * \c std::partition) reorder zipped sequences in place:
+ * \code
+ * auto keys = zip(k, x, y);
+ * std::sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) {
+ *     return std::get<0>(a) < std::get<0>(b);
+ * });
+ * \endcode
+ *
+ * Moving from rvalue zip references lets them reorder sequences of
+ * move-only elements, such as \c std::unique_ptr.  As
+ * dereferencing returns a temporary, <tt>*out = *iter</tt> and
+ * <tt>value_type value = *iter</tt> move the elements too; bind the
+ * reference to a variable (<tt>auto ref = *iter</tt>) to copy them.
+ *
+ * \example zip/tests/tstZipIterator.cc
+ */
+//===========================================================================//
+
+template<typename... References>
+class ZipReference : public std::tuple<References...>
+{
+    using Base_t = std::tuple<References...>;
+
+    // Tuple of the referenced values
+    using Value_t
+        = std::tuple<std::remove_cv_t<std::remove_reference_t<References>>...>;
+
+  public:
+    //! Public type aliases
+    using This = ZipReference<References...>;
+
+  public:
+    //! Construct from the references
+    using Base_t::Base_t;
+
+    //! Copy constructor (binds the same elements)
+    ZipReference(const ZipReference&) = default;
+
+    //! Assign the values of tuples to the referenced elements
+    using Base_t::operator=;
+
+    // Assign the referenced elements of another zip reference
+    inline ZipReference& operator=(const ZipReference& other);
+
+    // Assign the referenced elements of another zip reference
+    inline ZipReference& operator=(ZipReference&& other);
+
+    // Swap the referenced elements with those of another zip reference
+    inline void swap(ZipReference& other);
+
+    // Move the referenced elements into a tuple of values
+    inline operator Value_t() &&;
+
+  private:
+    // Move-assign the elements I... of another zip reference
+    template<std::size_t... I>
+    inline void moveAssign(ZipReference& other, std::index_sequence<I...>);
+
+    // Move the elements I... into a tuple of values
+    template<std::size_t... I>
+    inline Value_t moveValues(std::index_sequence<I...>);
+
+    // Swap the elements I...
+    template<std::size_t... I>
+    inline void swap(ZipReference& other, std::index_sequence<I...>);
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Swap the elements referenced by two zip references
+template<typename... References>
+inline void swap(ZipReference<References...>& ref1,
+                 ZipReference<References...>& ref2);
+
+// Swap the elements referenced by two zip references
+template<typename... References>
+inline void swap(ZipReference<References...>&& ref1,
+                 ZipReference<References...>&& ref2);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Assign the referenced elements of another zip reference
+ *
+ * \param[in] other  The zip reference whose elements are copied
+ *
+ * \return A reference to this zip reference
+ */
+template<typename... References>
+auto ZipReference<References...>::operator=(const ZipReference& other)
+    -> ZipReference&
+{
+    Base_t::operator=(static_cast<const Base_t&>(other));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move-assign the referenced elements of another zip reference
+ *
+ * \param[in] other  The zip reference whose elements are moved
+ *
+ * \return A reference to this zip reference
+ */
+template<typename... References>
+auto ZipReference<References...>::operator=(ZipReference&& other)
+    -> ZipReference&
+{
+    this->moveAssign(other, std::index_sequence_for<References...>());
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Swap the referenced elements with those of another zip reference
+ *
+ * \param[in] other  The other zip reference
+ */
+template<typename... References>
+void ZipReference<References...>::swap(ZipReference& other)
+{
+    this->swap(other, std::index_sequence_for<References...>());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move the referenced elements into a tuple of values
+ *
+ * This conversion is chosen over the tuple constructors, which copy, when a
+ * tuple of values is copy-initialized from an rvalue zip reference, and when
+ * the elements cannot be copied.
+ *
+ * \return The moved elements
+ */
+template<typename... References>
+ZipReference<References...>::operator Value_t() &&
+{
+    return this->moveValues(std::index_sequence_for<References...>());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move-assign the elements \c I... of another zip reference
+ *
+ * \param[in] other  The other zip reference
+ */
+template<typename... References>
+template<std::size_t... I>
+void ZipReference<References...>::moveAssign(ZipReference& other,
+                                             std::index_sequence<I...>)
+{
+    ((std::get<I>(*this) = std::move(std::get<I>(other))), ...);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move the elements \c I... into a tuple of values
+ *
+ * \return The moved elements
+ */
+template<typename... References>
+template<std::size_t... I>
+auto ZipReference<References...>::moveValues(std::index_sequence<I...>)
+    -> Value_t
+{
+    return Value_t(std::move(std::get<I>(*this))...);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Swap the elements \c I...
+ *
+ * \param[in] other  The other zip reference
+ */
+template<typename... References>
+template<std::size_t... I>
+void ZipReference<References...>::swap(ZipReference& other,
+                                       std::index_sequence<I...>)
+{
+    using std::swap;
+    (swap(std::get<I>(*this), std::get<I>(other)), ...);
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Swap the elements referenced by two zip references
+ *
+ * This overload takes precedence over \c std::swap, which would exchange the
+ * references rather than the elements.
+ *
+ * \param[in] ref1  The first zip reference
+ * \param[in] ref2  The second zip reference
+ */
+template<typename... References>
+void swap(ZipReference<References...>& ref1,
+          ZipReference<References...>& ref2)
+{
+    ref1.swap(ref2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Swap the elements referenced by two zip references
+ *
+ * \param[in] ref1  The first zip reference
+ * \param[in] ref2  The second zip reference
+ */
+template<typename... References>
+void swap(ZipReference<References...>&& ref1,
+          ZipReference<References...>&& ref2)
+{
+    ref1.swap(ref2);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace itertools
+
+namespace std
+{
+//---------------------------------------------------------------------------//
+// The number of elements of a zip reference
+template<typename... References>
+struct tuple_size<itertools::ZipReference<References...>>
+    : public integral_constant<size_t, sizeof...(References)>
+{
+};
+
+//---------------------------------------------------------------------------//
+// The types of the elements of a zip reference
+template<size_t I, typename... References>
+struct tuple_element<I, itertools::ZipReference<References...>>
+    : public tuple_element<I, tuple<References...>>
+{
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace std
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_ZIPREFERENCE_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/ZipReference.hh
+//---------------------------------------------------------------------------//
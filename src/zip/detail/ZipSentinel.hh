@@ -0,0 +1,227 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/ZipSentinel.hh
+ * \brief  ZipSentinel class declaration.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_ZIPSENTINEL_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_ZIPSENTINEL_HH
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ZipIterator.hh"
+#include "ZipIteratorTraits.hh"
+#include "ZipStorage.hh"
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \class ZipSentinel
+ * \brief End marker of a zip over sequences of unknown lengths
+ *
+ * The sentinel stores the ending iterator of every sequence, and a zip
+ * iterator compares equal to it as soon as any of its underlying iterators
+ * reaches the corresponding ending.  Iterating up to the sentinel therefore
+ * stops at the end of the shortest sequence, at the cost of one comparison
+ * per sequence and iteration.
+ *
+ * \example zip/tests/tstZip.cc
+ */
+//===========================================================================//
+
+template<typename... Iterators>
+class ZipSentinel
+{
+  public:
+    //! Public type aliases
+    using This = ZipSentinel<Iterators...>;
+
+  public:
+    // Default constructor
+    ZipSentinel() = default;
+
+    // Construct with the ending iterators of the sequences
+    template<typename... OtherIterators,
+             std::enable_if_t<
+                 is_zip_constructible_v<std::tuple<Iterators...>,
+                                        OtherIterators...>,
+                 bool>
+             = true>
+    inline explicit ZipSentinel(OtherIterators&&... other_iters);
+
+    // Test whether a zip iterator reached the end of any sequence
+    template<typename... OtherIterators>
+    inline bool reached(const ZipIterator<OtherIterators...>& zip_iter) const;
+
+  private:
+    // Test the sequences I... for their ending
+    template<typename ZipIter, std::size_t... I>
+    inline bool reached(const ZipIter& zip_iter,
+                        std::index_sequence<I...>) const;
+
+    // >>> DATA
+    //! Stores the ending iterators
+    IteratorPack<Iterators...> m_ends;
+};
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+// Test whether a zip iterator reached a sentinel
+template<typename... Iterators, typename... OtherIterators>
+inline bool operator==(const ZipIterator<Iterators...>& zip_iter,
+                       const ZipSentinel<OtherIterators...>& sentinel);
+
+// Test whether a zip iterator reached a sentinel
+template<typename... Iterators, typename... OtherIterators>
+inline bool operator==(const ZipSentinel<OtherIterators...>& sentinel,
+                       const ZipIterator<Iterators...>& zip_iter);
+
+// Test whether a zip iterator did not reach a sentinel
+template<typename... Iterators, typename... OtherIterators>
+inline bool operator!=(const ZipIterator<Iterators...>& zip_iter,
+                       const ZipSentinel<OtherIterators...>& sentinel);
+
+// Test whether a zip iterator did not reach a sentinel
+template<typename... Iterators, typename... OtherIterators>
+inline bool operator!=(const ZipSentinel<OtherIterators...>& sentinel,
+                       const ZipIterator<Iterators...>& zip_iter);
+
+//===========================================================================//
+// INLINE FUNCTION IMPLEMENTATION
+//===========================================================================//
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Construct with the ending iterators of the sequences
+ *
+ * \param[in] other_iters  The ending iterators
+ */
+template<typename... Iterators>
+template<typename... OtherIterators,
+         std::enable_if_t<
+             is_zip_constructible_v<std::tuple<Iterators...>,
+                                    OtherIterators...>,
+             bool>>
+ZipSentinel<Iterators...>::ZipSentinel(OtherIterators&&... other_iters)
+    : m_ends(std::in_place, std::forward<OtherIterators>(other_iters)...)
+{
+    /* * */
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test whether a zip iterator reached the end of any sequence
+ *
+ * \param[in] zip_iter  The zip iterator
+ *
+ * \return True if any underlying iterator equals its ending iterator
+ */
+template<typename... Iterators>
+template<typename... OtherIterators>
+bool ZipSentinel<Iterators...>::reached(
+    const ZipIterator<OtherIterators...>& zip_iter) const
+{
+    static_assert(sizeof...(OtherIterators) == sizeof...(Iterators));
+
+    return this->reached(zip_iter, std::index_sequence_for<Iterators...>());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test the sequences \c I... for their ending
+ *
+ * \param[in] zip_iter  The zip iterator
+ *
+ * \return True if any underlying iterator equals its ending iterator
+ */
+template<typename... Iterators>
+template<typename ZipIter, std::size_t... I>
+bool ZipSentinel<Iterators...>::reached(const ZipIter& zip_iter,
+                                        std::index_sequence<I...>) const
+{
+    return ((zip_iter.template get<I>() == get<I>(m_ends)) || ...);
+}
+
+//---------------------------------------------------------------------------//
+// BOOLEAN OPERATORS
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test whether a zip iterator reached a sentinel
+ *
+ * \param[in] zip_iter  The zip iterator
+ * \param[in] sentinel  The sentinel
+ *
+ * \return True if any underlying iterator reached the end of its sequence
+ */
+template<typename... Iterators, typename... OtherIterators>
+bool operator==(const ZipIterator<Iterators...>& zip_iter,
+                const ZipSentinel<OtherIterators...>& sentinel)
+{
+    return sentinel.reached(zip_iter);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test whether a zip iterator reached a sentinel
+ *
+ * \param[in] sentinel  The sentinel
+ * \param[in] zip_iter  The zip iterator
+ *
+ * \return True if any underlying iterator reached the end of its sequence
+ */
+template<typename... Iterators, typename... OtherIterators>
+bool operator==(const ZipSentinel<OtherIterators...>& sentinel,
+                const ZipIterator<Iterators...>& zip_iter)
+{
+    return sentinel.reached(zip_iter);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test whether a zip iterator did not reach a sentinel
+ *
+ * \param[in] zip_iter  The zip iterator
+ * \param[in] sentinel  The sentinel
+ *
+ * \return True if no underlying iterator reached the end of its sequence
+ */
+template<typename... Iterators, typename... OtherIterators>
+bool operator!=(const ZipIterator<Iterators...>& zip_iter,
+                const ZipSentinel<OtherIterators...>& sentinel)
+{
+    return !sentinel.reached(zip_iter);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Test whether a zip iterator did not reach a sentinel
+ *
+ * \param[in] sentinel  The sentinel
+ * \param[in] zip_iter  The zip iterator
+ *
+ * \return True if no underlying iterator reached the end of its sequence
+ */
+template<typename... Iterators, typename... OtherIterators>
+bool operator!=(const ZipSentinel<OtherIterators...>& sentinel,
+                const ZipIterator<Iterators...>& zip_iter)
+{
+    return !sentinel.reached(zip_iter);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_ZIPSENTINEL_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/ZipSentinel.hh
+//---------------------------------------------------------------------------//
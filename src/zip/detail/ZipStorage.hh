@@ -0,0 +1,158 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/detail/ZipStorage.hh
+ * \brief  IteratorPack and ZipStorage class declarations.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle, LLC.
+ */
+//---------------------------------------------------------------------------//
+#ifndef ITERTOOLS_SRC_ZIP_DETAIL_ZIPSTORAGE_HH
+#define ITERTOOLS_SRC_ZIP_DETAIL_ZIPSTORAGE_HH
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace itertools
+{
+namespace detail
+{
+//===========================================================================//
+/*!
+ * \struct IteratorPack
+ * \brief Stores a heterogeneous list of iterators by value
+ *
+ * Unlike \c std::tuple, the pack nests its elements as data members rather
+ * than as base classes and declares no copy operations.  A pack of trivially
+ * copyable, standard-layout iterators is therefore itself trivially copyable
+ * and standard-layout, so it can be copied with \c memcpy and passed in
+ * registers.  The elements are accessed with \c detail::get.
+ */
+//===========================================================================//
+
+template<typename... Iterators>
+struct IteratorPack;
+
+template<typename Head>
+struct IteratorPack<Head>
+{
+    //! Default constructor
+    IteratorPack() = default;
+
+    //! Construct the element in place
+    template<typename Arg>
+    constexpr IteratorPack(std::in_place_t, Arg&& arg)
+        : head(std::forward<Arg>(arg))
+    {
+    }
+
+    //! Stores the element
+    Head head;
+};
+
+template<typename Head, typename... Tail>
+struct IteratorPack<Head, Tail...>
+{
+    //! Default constructor
+    IteratorPack() = default;
+
+    //! Construct the elements in place
+    template<typename Arg, typename... Args>
+    constexpr IteratorPack(std::in_place_t, Arg&& arg, Args&&... args)
+        : head(std::forward<Arg>(arg))
+        , tail(std::in_place, std::forward<Args>(args)...)
+    {
+    }
+
+    //! Stores the first element
+    Head head;
+
+    //! Stores the remaining elements
+    IteratorPack<Tail...> tail;
+};
+
+//---------------------------------------------------------------------------//
+// Access element I of a pack
+template<std::size_t I, typename... Iterators>
+constexpr auto& get(IteratorPack<Iterators...>& pack)
+{
+    static_assert(I < sizeof...(Iterators));
+
+    if constexpr (I == 0)
+    {
+        return pack.head;
+    }
+    else
+    {
+        return get<I - 1>(pack.tail);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Access element I of a constant pack
+template<std::size_t I, typename... Iterators>
+constexpr const auto& get(const IteratorPack<Iterators...>& pack)
+{
+    static_assert(I < sizeof...(Iterators));
+
+    if constexpr (I == 0)
+    {
+        return pack.head;
+    }
+    else
+    {
+        return get<I - 1>(pack.tail);
+    }
+}
+
+//===========================================================================//
+/*!
+ * \struct ZipStorage
+ * \brief Storage of the iterators of a zip
+ *
+ * When \c Indexed is true, the iterators stay at their initial positions and
+ * share the offset \c index, which is the only member updated when the zip
+ * advances.  Otherwise, each iterator holds its own position.  The storage
+ * is trivially copyable and standard-layout whenever the iterators are.
+ */
+//===========================================================================//
+
+template<bool Indexed, typename Difference, typename... Iterators>
+struct ZipStorage
+{
+    //! Stores the underlying iterators at their current positions
+    IteratorPack<Iterators...> iterators;
+};
+
+template<typename Difference, typename... Iterators>
+struct ZipStorage<true, Difference, Iterators...>
+{
+    //! Stores the underlying iterators at their initial positions
+    IteratorPack<Iterators...> iterators;
+
+    //! Stores the offset of the current position shared by the iterators
+    Difference index = 0;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace itertools
+
+namespace std
+{
+//---------------------------------------------------------------------------//
+// The number of elements of an iterator pack
+template<typename... Iterators>
+struct tuple_size<itertools::detail::IteratorPack<Iterators...>>
+    : public integral_constant<size_t, sizeof...(Iterators)>
+{
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace std
+
+//---------------------------------------------------------------------------//
+#endif  // ITERTOOLS_SRC_ZIP_DETAIL_ZIPSTORAGE_HH
+//---------------------------------------------------------------------------//
+// end of src/zip/detail/ZipStorage.hh
+//---------------------------------------------------------------------------//
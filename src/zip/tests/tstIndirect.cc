@@ -0,0 +1,228 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstIndirect.cc
+ * \brief  Tests for indirect ranges and gatherForEach.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Indirect.hh"
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../Zip.hh"
+#include "enumerate/Enumerate.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(IndirectTest, Iterator)
+{
+    std::vector<int> data = {10, 11, 12, 13, 14, 15};
+    const std::vector<std::size_t> indices = {5, 0, 3, 3, 1};
+
+    auto range = itertools::indirect(data, indices);
+    using Iter = decltype(range.begin());
+    static_assert(std::is_same_v<Iter::reference, int&>);
+    static_assert(std::is_same_v<Iter::iterator_category,
+                                 std::random_access_iterator_tag>);
+    EXPECT_EQ(5u, range.size());
+    EXPECT_FALSE(range.empty());
+
+    auto iter = range.begin();
+    EXPECT_EQ(15, *iter);
+    EXPECT_EQ(5u, iter.index());
+    EXPECT_EQ(13, iter[2]);
+    iter += 3;
+    EXPECT_EQ(13, *iter);
+    --iter;
+    EXPECT_EQ(13, *iter++);
+    EXPECT_EQ(13, *iter++);
+    EXPECT_EQ(11, *iter);
+    EXPECT_EQ(range.end(), iter + 1);
+    EXPECT_EQ(range.end(), 1 + iter);
+    EXPECT_EQ(range.begin(), iter - 4);
+    EXPECT_EQ(4, iter - range.begin());
+    EXPECT_TRUE(range.begin() < iter);
+    EXPECT_TRUE(iter >= range.begin());
+    EXPECT_EQ(12, range[3] - 1);
+
+    // Gather
+    std::vector<int> gathered(range.begin(), range.end());
+    EXPECT_EQ((std::vector<int>{15, 10, 13, 13, 11}), gathered);
+
+    // Scatter
+    for (int& elem : range)
+    {
+        elem *= -1;
+    }
+    EXPECT_EQ((std::vector<int>{-10, -11, 12, 13, 14, -15}), data);
+
+    // Member access goes through the data
+    std::vector<std::string> words = {"a", "bb", "ccc"};
+    const std::vector<int> pick = {2, 0};
+    EXPECT_EQ(3u, itertools::indirect(words, pick).begin()->size());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(IndirectTest, Empty)
+{
+    std::vector<double> data = {1.0, 2.0};
+    const std::vector<int> indices;
+
+    auto range = itertools::indirect(data, indices);
+    EXPECT_TRUE(range.empty());
+    EXPECT_EQ(0u, range.size());
+    EXPECT_EQ(range.begin(), range.end());
+
+    int count = 0;
+    itertools::gatherForEach(range, [&count](double) { ++count; });
+    EXPECT_EQ(0, count);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(IndirectTest, Zip)
+{
+    const std::vector<double> x = {0.5, 1.5, 2.5, 3.5};
+    const std::vector<int> idx = {3, 1, 1, 0, 2};
+    std::vector<double> y(idx.size());
+
+    // The indirect range is sized, so the zip has a precomputed length
+    auto zipped = itertools::zip(itertools::indirect(x, idx), y);
+    EXPECT_EQ(idx.size(), zipped.size());
+    for (auto [xi, yi] : zipped)
+    {
+        yi = 2 * xi;
+    }
+    EXPECT_EQ((std::vector<double>{7.0, 3.0, 3.0, 1.0, 5.0}), y);
+
+    // Scatter-add through the indirect stream
+    std::vector<double> sums(x.size(), 0.0);
+    for (auto [si, yi] : itertools::zip(itertools::indirect(sums, idx), y))
+    {
+        si += yi;
+    }
+    EXPECT_EQ((std::vector<double>{1.0, 6.0, 5.0, 7.0}), sums);
+}
+
+//---------------------------------------------------------------------------//
+TEST(IndirectTest, Enumerate)
+{
+    std::vector<int> x = {10, 11, 12, 13};
+    const std::vector<int> idx = {3, 1, 1, 0};
+
+    // Gathered elements are not contiguous: the count is kept separately
+    auto e = itertools::enumerate(itertools::indirect(x, idx), 1);
+    static_assert(!decltype(e)::iterator::is_indexed);
+    EXPECT_EQ(idx.size(), e.size());
+    std::vector<int> counts;
+    std::vector<int> values;
+    for (auto [i, xi] : e)
+    {
+        counts.push_back(i);
+        values.push_back(xi);
+        xi += i;
+    }
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4}), counts);
+    EXPECT_EQ((std::vector<int>{13, 11, 13, 10}), values);
+
+    // Writes go through the indices, repeated ones accumulating
+    EXPECT_EQ((std::vector<int>{14, 16, 12, 14}), x);
+    auto [i, xi] = e.begin()[2];
+    EXPECT_EQ(3, i);
+    EXPECT_EQ(16, xi);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(IndirectTest, GatherForEach)
+{
+    const std::size_t n = 1000;
+    const std::size_t m = 2503;
+
+    std::vector<long> x(n);
+    std::iota(x.begin(), x.end(), 0L);
+    std::vector<std::size_t> idx(m);
+    std::mt19937 engine(3);
+    for (auto& i : idx)
+    {
+        i = engine() % n;
+    }
+
+    std::vector<long> expected(m);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        expected[i] = 3 * x[idx[i]];
+    }
+
+    for (auto order :
+         {itertools::GatherOrder::original, itertools::GatherOrder::sorted})
+    {
+        // Batches that do and do not divide the length
+        for (std::size_t batch : {1, 7, 64, 5000})
+        {
+            std::vector<long> y(m, 0L);
+            std::vector<long> indices_seen;
+            itertools::gatherForEach(
+                itertools::zip(itertools::indirect(x, idx), y),
+                [&indices_seen](auto elem) {
+                    auto [xi, yi] = elem;
+                    yi = 3 * xi;
+                    indices_seen.push_back(xi);
+                },
+                batch,
+                order);
+
+            // The outputs land at their original positions
+            EXPECT_EQ(expected, y);
+            ASSERT_EQ(m, indices_seen.size());
+
+            // Sorted batches are visited by increasing index
+            if (order == itertools::GatherOrder::sorted)
+            {
+                for (std::size_t i = 0; i < m; ++i)
+                {
+                    if (i % batch != 0)
+                    {
+                        ASSERT_LE(indices_seen[i - 1], indices_seen[i])
+                            << "at position " << i << " of batch " << batch;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(IndirectTest, GatherForEachIterators)
+{
+    std::vector<int> data = {4, 3, 2, 1};
+    const std::vector<int> idx = {0, 2, 0, 3};
+
+    auto range = itertools::indirect(data, idx);
+    itertools::gatherForEach(
+        range.begin(), range.end(), [](int& elem) { elem += 10; }, 2);
+    EXPECT_EQ((std::vector<int>{24, 3, 12, 11}), data);
+
+    // Plain contiguous ranges are prefetched at their positions
+    int sum = 0;
+    itertools::gatherForEach(data, [&sum](int elem) { sum += elem; });
+    EXPECT_EQ(50, sum);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstIndirect.cc
+//---------------------------------------------------------------------------//
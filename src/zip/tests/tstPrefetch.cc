@@ -0,0 +1,171 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstPrefetch.cc
+ * \brief  Tests for prefetched iterators and ranges.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Prefetch.hh"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../Indirect.hh"
+#include "../Transpose.hh"
+#include "../Zip.hh"
+#include "enumerate/Enumerate.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(PrefetchTest, Iterator)
+{
+    std::vector<int> v = {0, 1, 2, 3, 4, 5, 6, 7};
+    using itertools::PrefetchAccess;
+
+    auto iter = itertools::prefetched<4>(v.begin());
+    using Iter = decltype(iter);
+    static_assert(std::is_same_v<Iter::reference, int&>);
+    static_assert(std::is_same_v<Iter::iterator_category,
+                                 std::random_access_iterator_tag>);
+    EXPECT_EQ(v.begin(), iter.base());
+
+    // Prefetching past the end is harmless
+    auto last = itertools::prefetched<4>(v.end());
+    EXPECT_EQ(8, last - iter);
+    EXPECT_EQ(28, std::accumulate(iter, last, 0));
+
+    ++iter;
+    EXPECT_EQ(1, *iter);
+    iter += 5;
+    EXPECT_EQ(6, *iter);
+    EXPECT_EQ(7, iter[1]);
+    --iter;
+    iter -= 2;
+    EXPECT_EQ(3, *iter);
+    EXPECT_TRUE(iter < last);
+    EXPECT_EQ(last, iter + 5);
+    EXPECT_EQ(last, 5 + iter);
+    EXPECT_EQ(iter, last - 5);
+
+    // Writes go through
+    auto out = itertools::prefetched<16, PrefetchAccess::write>(v.data());
+    for (int i = 0; i < 8; ++i, ++out)
+    {
+        *out = 2 * i;
+    }
+    EXPECT_EQ((std::vector<int>{0, 2, 4, 6, 8, 10, 12, 14}), v);
+
+    // A distance of zero disables prefetching
+    auto plain = itertools::prefetched<0>(v.data());
+    EXPECT_EQ(4, *(plain + 2));
+}
+
+//---------------------------------------------------------------------------//
+TEST(PrefetchTest, Zip)
+{
+    using itertools::PrefetchAccess;
+    std::vector<float> x = {1, 2, 3, 4, 5};
+    std::array<float, 4> y = {1, 1, 1, 1};
+
+    // Each stream has its own distance and access
+    auto z = itertools::zip(
+        itertools::prefetched<8>(x),
+        itertools::prefetched<32, PrefetchAccess::write>(y));
+    static_assert(decltype(z)::is_sized);
+    EXPECT_EQ(4u, z.size());
+    for (auto [xi, yi] : z)
+    {
+        yi += 2.0f * xi;
+    }
+    EXPECT_EQ((std::array<float, 4>{3, 5, 7, 9}), y);
+
+    // Zipped prefetched ranges can be sorted
+    std::sort(z.begin(), z.end(), [](const auto& a, const auto& b) {
+        return std::get<1>(a) > std::get<1>(b);
+    });
+    EXPECT_EQ((std::array<float, 4>{9, 7, 5, 3}), y);
+    EXPECT_EQ((std::vector<float>{4, 3, 2, 1, 5}), x);
+}
+
+//---------------------------------------------------------------------------//
+TEST(PrefetchTest, Enumerate)
+{
+    std::vector<float> x = {1, 2, 3, 4, 5, 6};
+
+    // The prefetch iterator is not a pointer: the count is kept separately
+    auto e = itertools::enumerate(itertools::prefetched<4>(x));
+    static_assert(!decltype(e)::iterator::is_indexed);
+    EXPECT_EQ(x.size(), e.size());
+    for (auto [i, xi] : e)
+    {
+        xi *= static_cast<float>(i);
+    }
+    EXPECT_EQ((std::vector<float>{0, 2, 6, 12, 20, 30}), x);
+
+    // Random access, e.g., to split the enumeration
+    auto first = e.begin();
+    auto [i, xi] = first[5];
+    EXPECT_EQ(5u, i);
+    EXPECT_EQ(30.0f, xi);
+    EXPECT_EQ(6, e.end() - first);
+}
+
+//---------------------------------------------------------------------------//
+TEST(PrefetchTest, NonContiguous)
+{
+    using itertools::PrefetchAccess;
+    using itertools::prefetched;
+
+    // Indirect streams: indices are not read past the end
+    std::vector<double> data = {10, 11, 12, 13, 14};
+    std::vector<int> indices = {4, 0, 3};
+    auto gathered = prefetched<2>(itertools::indirect(data, indices));
+    using Iter = decltype(gathered.begin());
+    static_assert(!Iter::is_contiguous);
+    static_assert(std::is_same_v<Iter::reference, double&>);
+    EXPECT_EQ(3u, gathered.size());
+    std::vector<double> out;
+    for (double value : gathered)
+    {
+        out.push_back(value);
+    }
+    EXPECT_EQ((std::vector<double>{14, 10, 13}), out);
+
+    auto iter = gathered.begin();
+    iter += 2;
+    EXPECT_EQ(13, *iter);
+    EXPECT_EQ(10, iter[-1]);
+    EXPECT_EQ(gathered.end(), iter + 1);
+
+    // Strided streams, zipped with a contiguous one
+    struct Record
+    {
+        int id;
+        float mass;
+    };
+    std::vector<Record> records = {{0, 1.0f}, {1, 2.0f}, {2, 3.0f}};
+    std::vector<float> scale = {2, 2, 2};
+    auto [mass] = itertools::aosColumns<&Record::mass>(records);
+    for (auto&& [mi, si] :
+         itertools::zip(prefetched<8, PrefetchAccess::write>(mass), scale))
+    {
+        mi *= si;
+    }
+    EXPECT_EQ(2.0f, records[0].mass);
+    EXPECT_EQ(6.0f, records[2].mass);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstPrefetch.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,171 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstRadixSort.cc
+ * \brief  Tests for radixSort.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../RadixSort.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+// Random keys spanning the whole range of the type
+template<typename Key>
+std::vector<Key> randomKeys(std::size_t n)
+{
+    std::mt19937_64 engine(42);
+    std::vector<Key> keys(n);
+    for (Key& key : keys)
+    {
+        if constexpr (std::is_floating_point_v<Key>)
+        {
+            key = std::uniform_real_distribution<Key>(-1e6, 1e6)(engine);
+        }
+        else
+        {
+            key = static_cast<Key>(engine());
+        }
+    }
+    return keys;
+}
+
+// Sort keys and their original positions, then check against a stable sort
+template<typename Key>
+void testKeys(std::vector<Key> keys)
+{
+    std::vector<std::size_t> order(keys.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::vector<Key> expected_keys = keys;
+    std::vector<std::size_t> expected_order = order;
+    auto z = itertools::zip(expected_keys, expected_order);
+    std::stable_sort(z.begin(), z.end(), [](const auto& a, const auto& b) {
+        return std::get<0>(a) < std::get<0>(b);
+    });
+
+    itertools::radixSort(itertools::zip(keys, order));
+    EXPECT_EQ(expected_keys, keys);
+    EXPECT_EQ(expected_order, order);
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(RadixSortTest, Keys)
+{
+    static_assert(itertools::detail::RadixKey<int>::bits(-1)
+                  < itertools::detail::RadixKey<int>::bits(0));
+    using Float = itertools::detail::RadixKey<float>;
+    EXPECT_LT(Float::bits(-2.0f), Float::bits(-1.0f));
+    EXPECT_LT(Float::bits(-1.0f), Float::bits(-0.0f));
+    EXPECT_LT(Float::bits(-0.0f), Float::bits(0.0f));
+    EXPECT_LT(Float::bits(0.0f), Float::bits(1e-30f));
+    EXPECT_LT(Float::bits(1.0f),
+              Float::bits(std::numeric_limits<float>::infinity()));
+}
+
+//---------------------------------------------------------------------------//
+TEST(RadixSortTest, IntegerKeys)
+{
+    const std::size_t n = 10000;
+    testKeys(randomKeys<std::uint32_t>(n));
+    testKeys(randomKeys<std::int32_t>(n));
+    testKeys(randomKeys<std::int64_t>(n));
+    testKeys(randomKeys<std::uint8_t>(n));
+    testKeys(randomKeys<short>(n));
+
+    // Many duplicates and only one significant digit
+    std::vector<int> small(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        small[i] = static_cast<int>((i * 7919) % 13);
+    }
+    testKeys(small);
+}
+
+//---------------------------------------------------------------------------//
+TEST(RadixSortTest, FloatingPointKeys)
+{
+    const std::size_t n = 10000;
+    testKeys(randomKeys<float>(n));
+    testKeys(randomKeys<double>(n));
+
+    std::vector<double> special = randomKeys<double>(1000);
+    special[10] = std::numeric_limits<double>::infinity();
+    special[20] = -std::numeric_limits<double>::infinity();
+    special[30] = std::numeric_limits<double>::lowest();
+    special[40] = std::numeric_limits<double>::denorm_min();
+    special[50] = 0.0;
+    testKeys(special);
+}
+
+//---------------------------------------------------------------------------//
+TEST(RadixSortTest, Payloads)
+{
+    const std::size_t n = 5000;
+    std::vector<std::int64_t> keys = randomKeys<std::int64_t>(n);
+    std::vector<double> x(n);
+    std::vector<float> y(n);
+    std::vector<std::string> s(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = 0.5 * static_cast<double>(keys[i]);
+        y[i] = static_cast<float>(i);
+        s[i] = std::to_string(keys[i]);
+    }
+
+    itertools::radixSort(itertools::zip(keys, x, y, s));
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(0.5 * static_cast<double>(keys[i]), x[i]);
+        ASSERT_EQ(std::to_string(keys[i]), s[i]);
+    }
+    std::vector<float> sorted_y = y;
+    std::sort(sorted_y.begin(), sorted_y.end());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(static_cast<float>(i), sorted_y[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(RadixSortTest, SingleColumn)
+{
+    // Below and above the comparison sort cutoff
+    for (std::size_t n : {0, 1, 100, 100000})
+    {
+        std::vector<int> keys = randomKeys<int>(n);
+        std::vector<int> expected = keys;
+        std::sort(expected.begin(), expected.end());
+        itertools::radixSort(keys);
+        EXPECT_EQ(expected, keys);
+        itertools::radixSort(keys.begin(), keys.end());
+        EXPECT_EQ(expected, keys);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstRadixSort.cc
+//---------------------------------------------------------------------------//
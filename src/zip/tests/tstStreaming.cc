@@ -0,0 +1,219 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstStreaming.cc
+ * \brief  Tests for streaming ranges and iterators.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Streaming.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(StreamingTest, Iterator)
+{
+    std::vector<int> v(8, -1);
+    auto out = itertools::streamed(v);
+    static_assert(std::is_same_v<decltype(out)::value_type, int>);
+    EXPECT_EQ(8u, out.size());
+
+    using Iter = decltype(out)::iterator;
+    static_assert(std::is_same_v<Iter::reference,
+                                 itertools::detail::StreamingReference<int>>);
+    // The iterators share a buffer: parallel algorithms must not split them
+    static_assert(std::is_same_v<Iter::iterator_category,
+                                 std::forward_iterator_tag>);
+    static_assert(std::is_trivially_copyable_v<Iter>);
+
+    auto iter = out.begin();
+    auto last = out.end();
+    EXPECT_EQ(8, last - iter);
+    EXPECT_EQ(v.data(), iter.base());
+    EXPECT_EQ(last, iter + 8);
+    EXPECT_TRUE(iter < last);
+
+    // Pending and written elements read back their values
+    *iter = 10;
+    iter[1] = iter[0];
+    EXPECT_EQ(10, *iter);
+    EXPECT_EQ(10, iter[1]);
+    EXPECT_EQ(-1, iter[2]);
+
+    // The elements are buffered until the end is reached
+    for (int i = 0; i < 8; ++i, ++iter)
+    {
+        *iter = i;
+    }
+    EXPECT_EQ(last, iter);
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}), v);
+    EXPECT_EQ(7, *(iter - 1));
+}
+
+//---------------------------------------------------------------------------//
+TEST(StreamingTest, Zip)
+{
+    const std::size_t n = 1000;
+    std::vector<double> x(n);
+    std::iota(x.begin(), x.end(), 0.0);
+    std::vector<double> y(n, -1.0);
+    std::vector<float> z(n + 3, -1.0f);
+
+    {
+        auto out_y = itertools::streamed(y);
+        auto out_z = itertools::streamed(z);
+        auto zipped = itertools::zip(x, out_y, out_z);
+        static_assert(decltype(zipped)::is_sized);
+        static_assert(
+            std::is_same_v<decltype(zipped.begin())::iterator_category,
+                           std::forward_iterator_tag>);
+        EXPECT_EQ(n, zipped.size());
+        for (auto [xi, yi, zi] : zipped)
+        {
+            yi = 2.0 * xi;
+            zi = static_cast<float>(xi * xi);
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(2.0 * x[i], y[i]);
+        EXPECT_EQ(static_cast<float>(x[i] * x[i]), z[i]);
+    }
+
+    // The zip stops at the shortest stream
+    EXPECT_EQ(std::vector<float>(3, -1.0f),
+              std::vector<float>(z.begin() + n, z.end()));
+}
+
+//---------------------------------------------------------------------------//
+TEST(StreamingTest, Unaligned)
+{
+    // Neighbors of a sequence that does not start or end on a line are kept
+    std::vector<std::uint8_t> v(300, 0xff);
+    for (std::size_t offset : {0, 1, 63, 64, 65})
+    {
+        std::fill(v.begin(), v.end(), 0xff);
+        const std::size_t n = 200 - offset;
+        {
+            itertools::StreamingRange<std::uint8_t> out(
+                v.data() + offset, v.data() + offset + n);
+            std::transform(v.begin(),
+                           v.begin() + n,
+                           out.begin(),
+                           [](std::uint8_t) { return std::uint8_t(7); });
+        }
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            const bool inside = i >= offset && i < offset + n;
+            EXPECT_EQ(inside ? 7 : 0xff, v[i]) << "offset " << offset;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(StreamingTest, Sparse)
+{
+    // Elements that are not written keep their values
+    std::vector<long> v(100, -1);
+    {
+        auto out = itertools::streamed(v);
+        for (auto iter = out.begin(); iter != out.end(); iter += 2)
+        {
+            *iter = iter.base() - v.data();
+        }
+    }
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        EXPECT_EQ(i % 2 ? -1 : static_cast<long>(i), v[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(StreamingTest, EarlyExit)
+{
+    std::vector<int> x(100);
+    std::iota(x.begin(), x.end(), 0);
+    std::vector<int> y(100, -1);
+
+    auto out = itertools::streamed(y);
+    for (auto [xi, yi] : itertools::zip(x, out))
+    {
+        if (xi == 50)
+        {
+            break;
+        }
+        yi = xi;
+    }
+
+    // The last elements are written by flush()
+    out.flush();
+    EXPECT_EQ(49, *(out.begin() + 49));
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(i < 50 ? i : -1, y[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(StreamingTest, Store)
+{
+    // Blocks that do not start or end on a line, around a pending element
+    std::vector<float> v(400, -1.0f);
+    std::vector<float> values(400);
+    std::iota(values.begin(), values.end(), 0.0f);
+    for (std::size_t offset : {0, 1, 5, 16, 17})
+    {
+        std::fill(v.begin(), v.end(), -1.0f);
+        const std::size_t n = 300;
+        {
+            itertools::StreamingRange<float> out(v.data() + offset,
+                                                 v.data() + offset + n);
+
+            // An element buffered before a block that overwrites its line
+            *(out.begin() + 40) = 1000.0f;
+            for (std::size_t pos = 0; pos < n;)
+            {
+                const std::size_t count = std::min<std::size_t>(37, n - pos);
+                out.store(pos, values.data() + pos, count);
+                pos += count;
+            }
+        }
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            const bool inside = i >= offset && i < offset + n;
+            EXPECT_EQ(inside ? values[i - offset] : -1.0f, v[i])
+                << "offset " << offset << ", element " << i;
+        }
+    }
+
+    // A partial block combined with element-wise assignments
+    std::vector<int> w(40, -1);
+    {
+        auto out = itertools::streamed(w);
+        const int block[] = {10, 11, 12};
+        out.store(10, block, 3);
+        out.begin()[13] = 13;
+        EXPECT_EQ(12, out.begin()[12]);
+    }
+    for (int i = 0; i < 40; ++i)
+    {
+        EXPECT_EQ(i >= 10 && i < 14 ? i : -1, w[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstStreaming.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,248 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstTranspose.cc
+ * \brief  Tests for column views and AoS/SoA transposition.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Transpose.hh"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// HELPERS
+//---------------------------------------------------------------------------//
+
+struct Vec3
+{
+    double x;
+    double y;
+    double z;
+};
+
+// Members declared in a different order than they are usually listed
+struct Color
+{
+    float b;
+    float g;
+    float r;
+    float a;
+};
+
+struct Particle
+{
+    int id;
+    double energy;
+    std::string name;
+};
+
+//---------------------------------------------------------------------------//
+std::vector<Vec3> makePoints(std::size_t n)
+{
+    std::vector<Vec3> points(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto v = static_cast<double>(i);
+        points[i] = {v, 10.0 * v, 100.0 * v};
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(TransposeTest, MemberIterator)
+{
+    auto points = makePoints(5);
+    using Iter = itertools::detail::MemberIterator<std::vector<Vec3>::iterator,
+                                                   &Vec3::y>;
+    static_assert(std::is_same_v<Iter::reference, double&>);
+    static_assert(std::is_same_v<Iter::value_type, double>);
+    static_assert(std::is_same_v<Iter::iterator_category,
+                                 std::random_access_iterator_tag>);
+
+    Iter first(points.begin());
+    Iter last(points.end());
+    EXPECT_EQ(5, last - first);
+    EXPECT_EQ(10.0, *(first + 1));
+    EXPECT_EQ(40.0, first[4]);
+    EXPECT_EQ(&points[2].y, (first + 2).operator->());
+    EXPECT_TRUE(first < last);
+    EXPECT_EQ(last, 5 + first);
+
+    *first = -1.0;
+    EXPECT_EQ(-1.0, points[0].y);
+
+    using ConstIter
+        = itertools::detail::MemberIterator<std::vector<Vec3>::const_iterator,
+                                            &Vec3::y>;
+    static_assert(std::is_same_v<ConstIter::reference, const double&>);
+}
+
+//---------------------------------------------------------------------------//
+TEST(TransposeTest, AosColumns)
+{
+    auto points = makePoints(4);
+    auto [x, z] = itertools::aosColumns<&Vec3::x, &Vec3::z>(points);
+    EXPECT_EQ(4u, x.size());
+    EXPECT_FALSE(z.empty());
+    EXPECT_EQ(300.0, z[3]);
+    EXPECT_TRUE(std::equal(x.begin(), x.end(), std::vector{0., 1., 2., 3.}.begin()));
+
+    // Columns zip with each other and with ordinary arrays
+    std::vector<double> sum(4);
+    auto zipped = itertools::zip(x, z, sum);
+    static_assert(decltype(zipped)::is_sized);
+    for (auto [xi, zi, si] : zipped)
+    {
+        si = xi + zi;
+        xi = -xi;
+    }
+    EXPECT_EQ((std::vector<double>{0., 101., 202., 303.}), sum);
+    EXPECT_EQ(-3.0, points[3].x);
+
+    // Columns of records without random access
+    std::list<Particle> particles{{1, 2.0, "e"}, {2, 3.0, "p"}};
+    auto [names] = itertools::aosColumns<&Particle::name>(particles);
+    EXPECT_EQ(2u, names.size());
+    EXPECT_EQ("p", *std::next(names.begin()));
+}
+
+//---------------------------------------------------------------------------//
+TEST(TransposeTest, SoaView)
+{
+    std::vector<int> ids{1, 2, 3};
+    std::vector<double> energies{0.5, 1.5, 2.5, 3.5};
+
+    auto columns = std::tie(ids, energies);
+    auto records = itertools::soaView(columns);
+    EXPECT_EQ(3u, records.size());
+    for (auto [id, energy] : records)
+    {
+        energy *= id;
+    }
+    EXPECT_EQ((std::vector<double>{0.5, 3.0, 7.5, 3.5}), energies);
+
+    // Read-only columns
+    const auto& cids = ids;
+    auto [id, energy] = *itertools::soaView(std::tie(cids, energies)).begin();
+    static_assert(std::is_same_v<decltype(id), const int&>);
+    EXPECT_EQ(0.5, energy);
+}
+
+//---------------------------------------------------------------------------//
+TEST(TransposeTest, Homogeneous)
+{
+    // Records that are arrays of one type use the kernels
+    for (std::size_t n : {0, 1, 3, 17, 1000})
+    {
+        const auto points = makePoints(n);
+        std::vector<double> x(n, -1.0), y(n, -1.0), z(n + 1, -1.0);
+        itertools::transposeInto<&Vec3::x, &Vec3::y, &Vec3::z>(
+            points, std::tie(x, y, z));
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(points[i].x, x[i]);
+            EXPECT_EQ(points[i].y, y[i]);
+            EXPECT_EQ(points[i].z, z[i]);
+        }
+        EXPECT_EQ(-1.0, z.back());
+
+        std::vector<Vec3> copy(n, Vec3{-1.0, -1.0, -1.0});
+        itertools::transposeInto<&Vec3::x, &Vec3::y, &Vec3::z>(
+            std::tie(x, y, z), copy);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(points[i].x, copy[i].x);
+            EXPECT_EQ(points[i].y, copy[i].y);
+            EXPECT_EQ(points[i].z, copy[i].z);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(TransposeTest, Permuted)
+{
+    // Members are listed in a different order than they are stored
+    std::vector<Color> colors(37);
+    for (std::size_t i = 0; i < colors.size(); ++i)
+    {
+        const auto v = static_cast<float>(i);
+        colors[i] = {v, v + 0.25f, v + 0.5f, v + 0.75f};
+    }
+
+    std::vector<float> r(37), g(37), b(37), a(37);
+    itertools::transposeInto<&Color::r, &Color::g, &Color::b, &Color::a>(
+        colors, std::tie(r, g, b, a));
+    for (std::size_t i = 0; i < colors.size(); ++i)
+    {
+        EXPECT_EQ(colors[i].r, r[i]);
+        EXPECT_EQ(colors[i].g, g[i]);
+        EXPECT_EQ(colors[i].b, b[i]);
+        EXPECT_EQ(colors[i].a, a[i]);
+    }
+
+    std::vector<Color> copy(37);
+    itertools::transposeInto<&Color::a, &Color::b, &Color::r, &Color::g>(
+        std::tie(a, b, r, g), copy);
+    for (std::size_t i = 0; i < colors.size(); ++i)
+    {
+        EXPECT_EQ(colors[i].r, copy[i].r);
+        EXPECT_EQ(colors[i].g, copy[i].g);
+        EXPECT_EQ(colors[i].b, copy[i].b);
+        EXPECT_EQ(colors[i].a, copy[i].a);
+    }
+
+    // A member selected twice does not cover the record
+    std::vector<float> r2(37);
+    itertools::transposeInto<&Color::r, &Color::g, &Color::r, &Color::a>(
+        colors, std::tie(r, g, r2, a));
+    EXPECT_EQ(r, r2);
+}
+
+//---------------------------------------------------------------------------//
+TEST(TransposeTest, Heterogeneous)
+{
+    // Records with members of several types are copied record by record
+    const std::vector<Particle> particles{
+        {1, 2.0, "electron"}, {2, 3.0, "proton"}, {3, 4.0, "neutron"}};
+    std::vector<int> ids(3);
+    std::vector<std::string> names(3);
+    itertools::transposeInto<&Particle::id, &Particle::name>(
+        particles, std::tie(ids, names));
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), ids);
+    EXPECT_EQ("proton", names[1]);
+
+    // Members that are not selected are left untouched
+    std::list<Particle> copy(3, Particle{0, -1.0, ""});
+    std::reverse(names.begin(), names.end());
+    itertools::transposeInto<&Particle::name, &Particle::id>(
+        std::tie(names, ids), copy);
+    auto iter = copy.begin();
+    EXPECT_EQ("neutron", iter->name);
+    EXPECT_EQ(1, iter->id);
+    EXPECT_EQ(-1.0, iter->energy);
+
+    // A subset of the members of a homogeneous record
+    auto points = makePoints(10);
+    std::vector<double> z(10);
+    itertools::transposeInto<&Vec3::z>(points, std::tie(z));
+    EXPECT_EQ(900.0, z[9]);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstTranspose.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,141 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstUnzip.cc
+ * \brief  Tests for unzip and unzip iterators.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Unzip.hh"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../Zip.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(UnzipTest, Contiguous)
+{
+    for (std::size_t n : {0, 1, 5, 100})
+    {
+        std::vector<std::tuple<int, double, float>> tuples(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            tuples[i] = {static_cast<int>(i), 0.5 * i, 2.0f * i};
+        }
+
+        std::vector<int> a(n);
+        std::vector<double> b(n + 2, -1.0);
+        float c[100];
+        auto [a_end, b_end, c_end]
+            = itertools::unzip(tuples, a.begin(), b.begin(), c);
+        EXPECT_EQ(a.end(), a_end);
+        EXPECT_EQ(b.begin() + n, b_end);
+        EXPECT_EQ(c + n, c_end);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(std::get<0>(tuples[i]), a[i]);
+            EXPECT_EQ(std::get<1>(tuples[i]), b[i]);
+            EXPECT_EQ(std::get<2>(tuples[i]), c[i]);
+        }
+        EXPECT_EQ(-1.0, b.back());
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(UnzipTest, TupleLike)
+{
+    // Pairs and arrays
+    const std::vector<std::pair<std::string, int>> pairs{{"a", 1}, {"b", 2}};
+    std::vector<std::string> keys(2);
+    std::vector<int> values(2);
+    itertools::unzip(pairs, keys.begin(), values.begin());
+    EXPECT_EQ((std::vector<std::string>{"a", "b"}), keys);
+    EXPECT_EQ((std::vector<int>{1, 2}), values);
+
+    const std::vector<std::array<short, 2>> arrays{{1, 2}, {3, 4}, {5, 6}};
+    std::vector<short> even(3), odd(3);
+    itertools::unzip(arrays, odd.begin(), even.begin());
+    EXPECT_EQ((std::vector<short>{2, 4, 6}), even);
+
+    // Zip ranges, which unzip back into their streams
+    std::vector<int> x(10);
+    std::iota(x.begin(), x.end(), 0);
+    std::vector<long> y(10, 3);
+    std::vector<int> x_copy(10);
+    std::vector<long> y_copy(10);
+    itertools::unzip(
+        itertools::zip(x, y), x_copy.begin(), y_copy.begin());
+    EXPECT_EQ(x, x_copy);
+    EXPECT_EQ(y, y_copy);
+}
+
+//---------------------------------------------------------------------------//
+TEST(UnzipTest, OutputIterators)
+{
+    // Sequences without random access and output-only iterators
+    const std::list<std::tuple<int, char>> tuples{{1, 'a'}, {2, 'b'}};
+    std::vector<int> ints;
+    std::string chars;
+    auto [ints_end, chars_end] = itertools::unzip(
+        tuples, std::back_inserter(ints), std::back_inserter(chars));
+    *chars_end = 'c';
+    EXPECT_EQ((std::vector<int>{1, 2}), ints);
+    EXPECT_EQ("abc", chars);
+
+    std::list<int> list(2);
+    std::vector<char> vec(2);
+    itertools::unzip(tuples, list.begin(), vec.begin());
+    EXPECT_EQ(2, list.back());
+    EXPECT_EQ('a', vec.front());
+}
+
+//---------------------------------------------------------------------------//
+TEST(UnzipTest, Iterator)
+{
+    using Iter = decltype(itertools::makeUnzipIter(
+        std::declval<int*>(), std::declval<double*>()));
+    static_assert(std::is_same_v<std::iterator_traits<Iter>::iterator_category,
+                                 std::output_iterator_tag>);
+
+    // Split the results of an algorithm in one pass
+    std::vector<int> x{1, 2, 3, 4};
+    std::vector<int> squares(4);
+    std::vector<double> halves(4);
+    auto out = std::transform(
+        x.begin(),
+        x.end(),
+        itertools::makeUnzipIter(squares.begin(), halves.begin()),
+        [](int v) { return std::make_tuple(v * v, 0.5 * v); });
+    EXPECT_EQ(squares.end(), std::get<0>(out.base()));
+    EXPECT_EQ((std::vector<int>{1, 4, 9, 16}), squares);
+    EXPECT_EQ((std::vector<double>{0.5, 1.0, 1.5, 2.0}), halves);
+
+    // Moved values
+    std::vector<std::string> names;
+    std::vector<int> ids;
+    auto iter = itertools::makeUnzipIter(std::back_inserter(names),
+                                         std::back_inserter(ids));
+    std::string name(100, 'x');
+    *iter++ = std::make_pair(std::move(name), 7);
+    EXPECT_EQ(100u, names.front().size());
+    EXPECT_EQ(7, ids.front());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstUnzip.cc
+//---------------------------------------------------------------------------//
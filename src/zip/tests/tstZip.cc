@@ -0,0 +1,274 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstZip.cc
+ * \brief  Tests for the zip and zipLongest ranges.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Zip.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "range/Range.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ZipTest, Sized)
+{
+    std::vector<int> a = {1, 2, 3, 4};
+    std::vector<double> b = {0.5, 1.5, 2.5};
+
+    // The zip ends with the shortest sequence in either order
+    auto ab = itertools::zip(a, b);
+    static_assert(decltype(ab)::is_sized);
+    static_assert(std::is_same_v<decltype(ab.begin()), decltype(ab.end())>);
+    EXPECT_EQ(3u, ab.size());
+    EXPECT_EQ(3, std::distance(ab.begin(), ab.end()));
+    EXPECT_EQ(3u, itertools::zip(b, a).size());
+
+    std::vector<double> sums;
+    for (auto [ai, bi] : ab)
+    {
+        sums.push_back(ai + bi);
+    }
+    EXPECT_EQ((std::vector<double>{1.5, 3.5, 5.5}), sums);
+
+    // Writing through the zip
+    for (auto [bi, ai] : itertools::zip(b, a))
+    {
+        ai *= 10;
+        bi += 1.0;
+    }
+    EXPECT_EQ((std::vector<int>{10, 20, 30, 4}), a);
+    EXPECT_EQ((std::vector<double>{1.5, 2.5, 3.5}), b);
+
+    // Standard algorithms over a random-access zip
+    auto z = itertools::zip(a, b);
+    const auto iter = std::find_if(z.begin(), z.end(), [](const auto& t) {
+        return std::get<1>(t) > 2.0;
+    });
+    EXPECT_EQ(1, iter - z.begin());
+
+    // Empty sequences
+    std::vector<int> empty;
+    EXPECT_TRUE(itertools::zip(a, empty).empty());
+    EXPECT_FALSE(itertools::zip(a, b).empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipTest, SizedBidirectional)
+{
+    std::list<int> a = {1, 2, 3};
+    std::vector<char> b = {'a', 'b', 'c', 'd', 'e'};
+    const auto r = itertools::range(10, 15);
+
+    auto z = itertools::zip(b, a, r);
+    static_assert(decltype(z)::is_sized);
+    EXPECT_EQ(3u, z.size());
+
+    std::vector<std::tuple<char, int, int>> result;
+    for (auto [bi, ai, ri] : z)
+    {
+        result.emplace_back(bi, ai, ri);
+    }
+    EXPECT_EQ((std::vector<std::tuple<char, int, int>>{
+                  {'a', 1, 10}, {'b', 2, 11}, {'c', 3, 12}}),
+              result);
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipTest, Unsized)
+{
+    std::forward_list<int> a = {1, 2, 3};
+    std::vector<int> b = {4, 5, 6, 7};
+    std::vector<int> c = {8, 9};
+
+    // The sentinel tests every sequence
+    auto ab = itertools::zip(a, b);
+    static_assert(!decltype(ab)::is_sized);
+    std::vector<int> sums;
+    for (auto [ai, bi] : ab)
+    {
+        sums.push_back(ai + bi);
+    }
+    EXPECT_EQ((std::vector<int>{5, 7, 9}), sums);
+
+    sums.clear();
+    for (auto [bi, ai, ci] : itertools::zip(b, a, c))
+    {
+        sums.push_back(ai + bi + ci);
+    }
+    EXPECT_EQ((std::vector<int>{13, 16}), sums);
+
+    EXPECT_TRUE(itertools::zip(a, std::vector<int>{}).empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipTest, Longest)
+{
+    std::vector<int> a = {1, 2, 3, 4};
+    std::list<double> b = {0.5, 1.5};
+
+    auto z = itertools::zipLongest(-1, a, b);
+    static_assert(decltype(z)::is_sized);
+    static_assert(
+        std::is_same_v<decltype(*z.begin()), std::tuple<int, double>>);
+    EXPECT_EQ(4u, z.size());
+
+    std::vector<std::tuple<int, double>> result(z.begin(), z.end());
+    EXPECT_EQ((std::vector<std::tuple<int, double>>{
+                  {1, 0.5}, {2, 1.5}, {3, -1.0}, {4, -1.0}}),
+              result);
+
+    // Unsized sequences
+    std::forward_list<int> c = {7, 8, 9};
+    std::vector<int> sums;
+    for (auto [bi, ci] : itertools::zipLongest(0, b, c))
+    {
+        sums.push_back(static_cast<int>(2 * bi) + ci);
+    }
+    EXPECT_EQ((std::vector<int>{8, 11, 9}), sums);
+
+    std::vector<int> empty;
+    EXPECT_TRUE(itertools::zipLongest(0, empty, empty).empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipTest, Sort)
+{
+    std::vector<int> keys = {3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<double> x = {30, 10, 40, 11, 50, 90, 20, 60};
+    std::vector<std::string> s = {"c", "a", "d", "a'", "e", "i", "b", "f"};
+
+    // Tuples compare lexicographically, so the payloads break ties
+    auto z = itertools::zip(keys, x, s);
+    std::sort(z.begin(), z.end());
+    EXPECT_EQ((std::vector<int>{1, 1, 2, 3, 4, 5, 6, 9}), keys);
+    EXPECT_EQ((std::vector<double>{10, 11, 20, 30, 40, 50, 60, 90}), x);
+    EXPECT_EQ((std::vector<std::string>{"a", "a'", "b", "c", "d", "e", "f",
+                                        "i"}),
+              s);
+
+    // Sort by a payload with a comparator
+    std::sort(z.begin(), z.end(), [](const auto& lhs, const auto& rhs) {
+        return std::get<1>(lhs) > std::get<1>(rhs);
+    });
+    EXPECT_EQ((std::vector<int>{9, 6, 5, 4, 3, 2, 1, 1}), keys);
+    EXPECT_EQ((std::vector<std::string>{"i", "f", "e", "d", "c", "b", "a'",
+                                        "a"}),
+              s);
+    EXPECT_TRUE(std::is_sorted(x.rbegin(), x.rend()));
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipTest, StableSort)
+{
+    std::vector<int> keys = {2, 1, 2, 0, 1, 2, 0};
+    std::vector<int> order = {0, 1, 2, 3, 4, 5, 6};
+
+    auto z = itertools::zip(keys, order);
+    std::stable_sort(z.begin(), z.end(), [](const auto& lhs, const auto& rhs) {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    });
+    EXPECT_EQ((std::vector<int>{0, 0, 1, 1, 2, 2, 2}), keys);
+    EXPECT_EQ((std::vector<int>{3, 6, 1, 4, 0, 2, 5}), order);
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipTest, SelectPartition)
+{
+    std::vector<int> keys = {7, 2, 9, 4, 1, 8, 3};
+    std::vector<int> twice = {14, 4, 18, 8, 2, 16, 6};
+    auto z = itertools::zip(keys, twice);
+    auto consistent = [&keys, &twice] {
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if (twice[i] != 2 * keys[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::nth_element(z.begin(), z.begin() + 3, z.end());
+    EXPECT_EQ(4, keys[3]);
+    EXPECT_TRUE(consistent());
+
+    auto mid = std::partition(z.begin(), z.end(), [](const auto& elem) {
+        return std::get<0>(elem) % 2 == 0;
+    });
+    EXPECT_EQ(3, mid - z.begin());
+    EXPECT_TRUE(std::all_of(keys.begin(), keys.begin() + 3, [](int k) {
+        return k % 2 == 0;
+    }));
+    EXPECT_TRUE(consistent());
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipTest, MoveOnly)
+{
+    std::vector<int> keys = {3, 1, 4, 0, 5, 2};
+    std::vector<std::unique_ptr<int>> payload;
+    for (int key : keys)
+    {
+        payload.push_back(std::make_unique<int>(10 * key));
+    }
+    auto z = itertools::zip(keys, payload);
+    auto by_key = [](const auto& lhs, const auto& rhs) {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    };
+    auto consistent = [&keys, &payload] {
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if (!payload[i] || *payload[i] != 10 * keys[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // The payloads are moved, never copied
+    std::sort(z.begin(), z.end(), by_key);
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5}), keys);
+    EXPECT_TRUE(consistent());
+
+    std::reverse(z.begin(), z.end());
+    std::stable_sort(z.begin(), z.end(), by_key);
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5}), keys);
+    EXPECT_TRUE(consistent());
+
+    std::reverse(z.begin(), z.end());
+    std::nth_element(z.begin(), z.begin() + 2, z.end(), by_key);
+    EXPECT_EQ(2, keys[2]);
+    EXPECT_TRUE(consistent());
+
+    auto mid = std::partition(z.begin(), z.end(), [](const auto& elem) {
+        return std::get<0>(elem) % 2 == 0;
+    });
+    EXPECT_EQ(3, mid - z.begin());
+    EXPECT_TRUE(std::all_of(keys.begin(), keys.begin() + 3, [](int k) {
+        return k % 2 == 0;
+    }));
+    EXPECT_TRUE(consistent());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstZip.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,301 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/tstZipIterator.cc
+ * \brief  Tests for class ZipIterator.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../detail/ZipIterator.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "range/Range.hh"
+#include "range/StaticRange.hh"
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ZipIteratorTest, Traits)
+{
+    using VecIter = std::vector<double>::iterator;
+    using ListIter = std::list<int>::const_iterator;
+
+    using RandomZip = itertools::ZipIterator<VecIter, int*>;
+    static_assert(std::is_same_v<RandomZip::reference,
+                                 itertools::ZipReference<double&, int&>>);
+    static_assert(std::is_base_of_v<std::tuple<double&, int&>,
+                                    RandomZip::reference>);
+    static_assert(std::is_same_v<RandomZip::rvalue_reference,
+                                 std::tuple<double&&, int&&>>);
+    static_assert(
+        std::is_same_v<RandomZip::value_type, std::tuple<double, int>>);
+    static_assert(std::is_same_v<RandomZip::iterator_category,
+                                 std::random_access_iterator_tag>);
+
+    using BidirZip = itertools::ZipIterator<VecIter, ListIter>;
+    static_assert(
+        std::is_same_v<BidirZip::reference,
+                       itertools::ZipReference<double&, const int&>>);
+    static_assert(std::is_same_v<BidirZip::iterator_category,
+                                 std::bidirectional_iterator_tag>);
+
+    // Only contiguous iterators share an index
+    static_assert(RandomZip::is_indexed);
+    static_assert(!BidirZip::is_indexed);
+    static_assert(
+        !itertools::ZipIterator<int*, itertools::detail::RangeIterator<int>>::
+            is_indexed);
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, Layout)
+{
+    using IndexedZip = itertools::ZipIterator<double*, const int*>;
+    static_assert(std::is_trivially_copyable_v<IndexedZip>);
+    static_assert(std::is_standard_layout_v<IndexedZip>);
+    static_assert(sizeof(IndexedZip)
+                  == 2 * sizeof(double*) + sizeof(std::ptrdiff_t));
+
+    using BidirZip = itertools::ZipIterator<std::vector<double>::iterator,
+                                            std::list<int>::iterator>;
+    static_assert(std::is_trivially_copyable_v<BidirZip>);
+    static_assert(std::is_standard_layout_v<BidirZip>);
+    static_assert(sizeof(BidirZip)
+                  == sizeof(std::vector<double>::iterator)
+                         + sizeof(std::list<int>::iterator));
+
+    // A copy through memory keeps the position
+    std::vector<double> x = {1.0, 2.0, 3.0};
+    std::vector<int> y = {4, 5, 6};
+    const IndexedZip iter = IndexedZip(x.data(), y.data()) + 1;
+    IndexedZip copy;
+    std::memcpy(&copy, &iter, sizeof(IndexedZip));
+    EXPECT_EQ(std::make_tuple(2.0, 5), *copy);
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, Increment)
+{
+    std::vector<int> a = {1, 2, 3};
+    std::vector<double> b = {0.5, 1.5, 2.5};
+
+    auto iter = itertools::makeZipIter(a.begin(), b.begin());
+    const auto last = itertools::makeZipIter(a.end(), b.end());
+
+    std::vector<double> sums;
+    for (; iter != last; ++iter)
+    {
+        auto [ai, bi] = *iter;
+        sums.push_back(ai + bi);
+    }
+    EXPECT_EQ((std::vector<double>{1.5, 3.5, 5.5}), sums);
+
+    auto post = itertools::makeZipIter(a.begin(), b.begin());
+    auto prev = post++;
+    EXPECT_EQ(1, std::get<0>(*prev));
+    EXPECT_EQ(2, std::get<0>(*post));
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, Decrement)
+{
+    std::list<int> a = {1, 2, 3};
+    std::vector<char> b = {'a', 'b', 'c'};
+
+    auto iter = itertools::makeZipIter(a.end(), b.end());
+    --iter;
+    EXPECT_EQ(3, std::get<0>(*iter));
+    EXPECT_EQ('c', std::get<1>(*iter));
+
+    auto next = iter--;
+    EXPECT_EQ(3, std::get<0>(*next));
+    EXPECT_EQ(2, std::get<0>(*iter));
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, WriteThrough)
+{
+    std::vector<double> x = {1.0, 2.0, 3.0};
+    std::vector<double> y = {10.0, 20.0, 30.0};
+
+    auto first = itertools::makeZipIter(x.begin(), y.begin());
+    auto last = itertools::makeZipIter(x.end(), y.end());
+    std::for_each(first, last, [](auto elem) {
+        auto [xi, yi] = elem;
+        yi += 2.0 * xi;
+    });
+    EXPECT_EQ((std::vector<double>{12.0, 24.0, 36.0}), y);
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, SwapMove)
+{
+    std::vector<int> a = {1, 2};
+    std::vector<std::vector<int>> b = {{10}, {20, 30}};
+    auto iter = itertools::makeZipIter(a.begin(), b.begin());
+    using Value = decltype(iter)::value_type;
+
+    // Swapping references, lvalues or temporaries, swaps the elements
+    auto ref0 = *iter;
+    auto ref1 = *(iter + 1);
+    swap(ref0, ref1);
+    EXPECT_EQ((std::vector<int>{2, 1}), a);
+    EXPECT_EQ((std::vector<std::vector<int>>{{20, 30}, {10}}), b);
+
+    swap(*iter, *(iter + 1));
+    EXPECT_EQ((std::vector<int>{1, 2}), a);
+    std::iter_swap(iter, iter + 1);
+    EXPECT_EQ((std::vector<int>{2, 1}), a);
+    EXPECT_EQ((std::vector<std::vector<int>>{{20, 30}, {10}}), b);
+
+    // Converting a named reference copies; iter_move moves
+    auto ref = *iter;
+    Value copy = ref;
+    EXPECT_EQ((std::vector<int>{20, 30}), b[0]);
+    Value moved = iter_move(iter);
+    EXPECT_EQ((Value{2, {20, 30}}), moved);
+    EXPECT_EQ(copy, moved);
+    EXPECT_TRUE(b[0].empty());
+
+    // Assigning a tuple of values writes through
+    *(iter + 1) = std::move(moved);
+    EXPECT_EQ(2, a[1]);
+    EXPECT_EQ((std::vector<int>{20, 30}), b[1]);
+
+    // Converting or assigning an rvalue reference moves
+    Value taken = std::move(*(iter + 1));
+    EXPECT_EQ((Value{2, {20, 30}}), taken);
+    EXPECT_TRUE(b[1].empty());
+    *(iter + 1) = std::move(taken);
+    *iter = std::move(*(iter + 1));
+    EXPECT_EQ((std::vector<int>{20, 30}), b[0]);
+    EXPECT_TRUE(b[1].empty());
+
+    // Iterators returning values are moved from by value
+    auto range_iter
+        = itertools::makeZipIter(a.begin(), itertools::range(5).begin());
+    static_assert(std::is_same_v<decltype(iter_move(range_iter)),
+                                 std::tuple<int&&, int>>);
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, RandomAccess)
+{
+    std::vector<int> a = {0, 1, 2, 3, 4, 5};
+    const auto r = itertools::range(0, 12, 2);
+
+    auto first = itertools::makeZipIter(a.begin(), r.begin());
+    auto last = itertools::makeZipIter(a.end(), r.end());
+
+    EXPECT_EQ(6, last - first);
+    EXPECT_EQ(6, std::distance(first, last));
+    EXPECT_EQ(3, std::get<0>(first[3]));
+    EXPECT_EQ(6, std::get<1>(first[3]));
+
+    auto mid = first + 4;
+    EXPECT_EQ(4, std::get<0>(*mid));
+    EXPECT_EQ(8, std::get<1>(*mid));
+    EXPECT_EQ(mid, 4 + first);
+    EXPECT_EQ(first, mid - 4);
+
+    mid -= 1;
+    EXPECT_EQ(3, std::get<0>(*mid));
+    mid += 2;
+    EXPECT_EQ(5, std::get<0>(*mid));
+
+    EXPECT_TRUE(first < mid);
+    EXPECT_TRUE(first <= mid);
+    EXPECT_TRUE(mid > first);
+    EXPECT_TRUE(mid >= first);
+    EXPECT_FALSE(mid < first);
+    EXPECT_TRUE(mid <= mid);
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, Accessors)
+{
+    std::vector<int> a = {1, 2};
+    std::vector<float> b = {3.0f, 4.0f};
+
+    auto iter = itertools::makeZipIter(a.begin(), b.begin());
+    EXPECT_EQ(a.begin(), iter.get<0>());
+    EXPECT_EQ(b.begin(), iter.get<1>());
+
+    ++iter.get<0>();
+    ++iter.get<1>();
+    EXPECT_EQ(std::make_tuple(a.begin() + 1, b.begin() + 1), iter.getIters());
+
+    const itertools::ZipIterator<std::vector<int>::iterator,
+                                 std::vector<float>::iterator>
+        copy(a.begin(), b.begin());
+    EXPECT_EQ(a.begin(), copy.get<0>());
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, SharedIndex)
+{
+    std::vector<int> a = {1, 2, 3, 4};
+    std::vector<float> b = {5.0f, 6.0f, 7.0f, 8.0f};
+
+    auto iter = itertools::makeZipIter(a.data(), b.data());
+    static_assert(decltype(iter)::is_indexed);
+
+    iter += 3;
+    --iter;
+    EXPECT_EQ(std::make_tuple(3, 7.0f), *iter);
+    EXPECT_EQ(std::make_tuple(2, 6.0f), iter[-1]);
+    EXPECT_EQ(a.data() + 2, iter.get<0>());
+    EXPECT_EQ(std::make_tuple(a.data() + 2, b.data() + 2),
+              std::as_const(iter).getIters());
+
+    // Comparisons with iterators of another type and base
+    const auto last = itertools::makeZipIter(
+        static_cast<const int*>(a.data() + 4), b.data() + 4);
+    EXPECT_EQ(2, last - iter);
+    EXPECT_TRUE(iter < last);
+    EXPECT_TRUE(iter + 2 == last);
+
+    // Modifying one stream moves it alone from the current position
+    ++iter.get<1>();
+    EXPECT_EQ(std::make_tuple(3, 8.0f), *iter);
+    --iter;
+    EXPECT_EQ(std::make_tuple(2, 7.0f), *iter);
+    EXPECT_EQ(b.data() + 2, iter.get<1>());
+}
+
+//---------------------------------------------------------------------------//
+TEST(ZipIteratorTest, StaticRange)
+{
+    std::vector<float> x = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<float> y(8, 1.0f);
+
+    // Unrolled over a fixed-size block of zipped streams
+    auto first = itertools::makeZipIter(x.data(), y.data());
+    itertools::StaticRange<0, 8>::forEach(first, [](auto elem) {
+        auto [xi, yi] = elem;
+        yi += 2.0f * xi;
+    });
+    EXPECT_EQ((std::vector<float>{3, 5, 7, 9, 11, 13, 15, 17}), y);
+
+    // Indices as integral constants
+    itertools::StaticRange<0, 8, 4>::forEach(
+        [&first](auto i) { std::get<1>(first[i]) = 0.0f; });
+    EXPECT_EQ((std::vector<float>{0, 5, 7, 9, 0, 13, 15, 17}), y);
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/tstZipIterator.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,120 @@
+//---------------------------------*-C++-*-----------------------------------//
+/*!
+ * \file   src/zip/tests/vecZipIterator.cc
+ * \brief  Kernels that must vectorize when looping over a ZipIterator.
+ * \note   Copyright (c) 2025 Oak Ridge National Laboratory, UT-Battelle,
+ * LLC.
+ */
+//---------------------------------------------------------------------------//
+
+#include "../Zip.hh"
+#include "../detail/ZipIterator.hh"
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../Transpose.hh"
+#include "../Unzip.hh"
+
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+// The loops marked "// vectorized" are checked by the vecZipIterator test,
+// together with the marked loops of the headers that these kernels call.
+
+void saxpy(float a, const float* x, float* y, std::ptrdiff_t n)
+{
+    auto iter = itertools::makeZipIter(x, y);
+    const auto last = itertools::makeZipIter(x + n, y + n);
+    for (; iter != last; ++iter)  // vectorized
+    {
+        auto&& [xi, yi] = *iter;
+        yi = a * xi + yi;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void multiplyAdd(float* w, const float* x, const float* y, const float* z,
+                 std::ptrdiff_t n)
+{
+    auto iter = itertools::makeZipIter(w, x, y, z);
+    const auto last = itertools::makeZipIter(w + n, x + n, y + n, z + n);
+    for (; iter != last; ++iter)  // vectorized
+    {
+        auto&& [wi, xi, yi, zi] = *iter;
+        wi = xi * yi + zi;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void scale(std::vector<double>& x, const std::vector<double>& y)
+{
+    auto iter = itertools::makeZipIter(x.begin(), y.cbegin());
+    const auto last = itertools::makeZipIter(x.end(), y.cend());
+    for (; iter != last; ++iter)  // vectorized
+    {
+        auto&& [xi, yi] = *iter;
+        xi *= yi;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void zipRange(std::vector<float>& x, const std::vector<float>& y)
+{
+    for (auto [xi, yi] : itertools::zip(x, y))  // vectorized
+    {
+        xi += 2.0f * yi;
+    }
+}
+
+//---------------------------------------------------------------------------//
+struct Point
+{
+    double x, y, z;
+};
+
+// De-interleaving kernel of transposeInto
+void aosToSoa(const std::vector<Point>& points,
+              std::vector<double>& x,
+              std::vector<double>& y,
+              std::vector<double>& z)
+{
+    itertools::transposeInto<&Point::x, &Point::y, &Point::z>(
+        points, std::tie(x, y, z));
+}
+
+//---------------------------------------------------------------------------//
+// Interleaving kernel of transposeInto
+void soaToAos(const std::vector<double>& x,
+              const std::vector<double>& y,
+              const std::vector<double>& z,
+              std::vector<Point>& points)
+{
+    itertools::transposeInto<&Point::x, &Point::y, &Point::z>(
+        std::tie(x, y, z), points);
+}
+
+//---------------------------------------------------------------------------//
+// Indexed kernel of unzip, from pairs
+void unzipPairs(const std::vector<std::pair<int, float>>& pairs,
+                std::vector<int>& keys,
+                std::vector<float>& values)
+{
+    itertools::unzip(pairs, keys.begin(), values.begin());
+}
+
+//---------------------------------------------------------------------------//
+// Indexed kernel of unzip, from a zip range
+void unzipZip(const std::vector<float>& x,
+              const std::vector<float>& y,
+              std::vector<float>& u,
+              std::vector<float>& v)
+{
+    itertools::unzip(itertools::zip(x, y), u.data(), v.data());
+}
+
+//---------------------------------------------------------------------------//
+// end of src/zip/tests/vecZipIterator.cc
+//---------------------------------------------------------------------------//